@@ -0,0 +1,195 @@
+#include <benchmark/benchmark.h>
+// The tables and kernels under mywctype.h, measured directly
+#include "bulk_kernels.h"
+#include "case_mapping_staged.h"
+#include "table_footprint.h"
+#include <emmintrin.h>
+#include <random>
+#include <vector>
+
+// Lookups of scattered codepoints, like dictionary keys or symbol tables.
+// Cold runs evict the tables from every cache level before each batch so
+// that both dependent loads of a lookup go to memory.
+
+static constexpr size_t kBatchSize = 512;
+
+template <typename T, size_t N>
+static void FlushTable(const T (&table)[N]) {
+  const char *begin = reinterpret_cast<const char *>(table);
+  for (size_t offset = 0; offset < sizeof(table); offset += 64) {
+    _mm_clflush(begin + offset);
+  }
+}
+
+static void FlushClassificationTables() {
+#if WCTYPE_TABLE_LAYOUT == WCTYPE_LAYOUT_FLAT_BMP
+  FlushTable(wctype_flat_bmp::bmp);
+#elif WCTYPE_TABLE_LAYOUT == WCTYPE_LAYOUT_THREE_STAGE
+  FlushTable(wctype_three_stage::level3);
+#endif
+  FlushTable(wctype_layout::level1);
+  FlushTable(wctype_layout::level2);
+  _mm_mfence();
+}
+
+static void FlushCaseTables() {
+  FlushTable(to_upper_level1);
+  FlushTable(to_upper_level2);
+  _mm_mfence();
+}
+
+// Random codepoints out of those accepted by pred
+template <typename Pred>
+static std::vector<wchar_t> MakeScattered(Pred pred) {
+  std::vector<wchar_t> pool;
+  for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    if (pred(cp)) {
+      pool.push_back(static_cast<wchar_t>(cp));
+    }
+  }
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<size_t> pick(0, pool.size() - 1);
+  std::vector<wchar_t> batch(kBatchSize);
+  for (auto &wc : batch) {
+    wc = pool[pick(rng)];
+  }
+  return batch;
+}
+
+static const std::vector<wchar_t> kAssigned =
+    MakeScattered([](uint32_t cp) { return lookup_properties(cp) != 0; });
+static const std::vector<wchar_t> kCased =
+    MakeScattered([](uint32_t cp) { return towupper_impl(cp) != cp; });
+
+static void BM_Properties_PerCall(benchmark::State &state, bool cold) {
+  std::vector<uint16_t> props(kAssigned.size());
+  for (auto _ : state) {
+    if (cold) {
+      state.PauseTiming();
+      FlushClassificationTables();
+      state.ResumeTiming();
+    }
+    for (size_t i = 0; i < kAssigned.size(); ++i) {
+      props[i] = lookup_properties(kAssigned[i]);
+    }
+    benchmark::DoNotOptimize(props.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kAssigned.size());
+}
+
+BENCHMARK_CAPTURE(BM_Properties_PerCall, Cold, true);
+BENCHMARK_CAPTURE(BM_Properties_PerCall, Warm, false);
+
+static void BM_Properties_Batch(benchmark::State &state, bool cold) {
+  std::vector<uint16_t> props(kAssigned.size());
+  for (auto _ : state) {
+    if (cold) {
+      state.PauseTiming();
+      FlushClassificationTables();
+      state.ResumeTiming();
+    }
+    my_wctype::detail::lookup_properties_pipelined(
+        kAssigned.data(), kAssigned.size(), props.data());
+    benchmark::DoNotOptimize(props.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kAssigned.size());
+}
+
+BENCHMARK_CAPTURE(BM_Properties_Batch, Cold, true);
+BENCHMARK_CAPTURE(BM_Properties_Batch, Warm, false);
+
+// Lookups sharing the cache with the caller's own data: every lookup also
+// reads the next line of a hot buffer of state.range(0) KB. table_KB is how
+// much of the tables the batch pulls into the cache.
+template <uint16_t (*Lookup)(wint_t),
+          void (*TouchLayout)(TableFootprint &, uint32_t)>
+static void LayoutContended(benchmark::State &state) {
+  std::vector<uint8_t> hot(state.range(0) * 1024 + 64, 1);
+  const size_t lines = hot.size() / 64;
+  size_t line = 0;
+  for (auto _ : state) {
+    unsigned acc = 0;
+    for (wchar_t wc : kAssigned) {
+      acc += Lookup(wc) + hot[line * 64];
+      line = line + 1 < lines ? line + 1 : 0;
+    }
+    benchmark::DoNotOptimize(acc);
+  }
+  state.SetItemsProcessed(state.iterations() * kAssigned.size());
+
+  TableFootprint footprint;
+  for (wchar_t wc : kAssigned) {
+    TouchLayout(footprint, wc);
+  }
+  state.counters["table_KB"] = footprint.lines.size() * 64 / 1024.0;
+}
+
+static void BM_Layout_TwoLevel_Contended(benchmark::State &state) {
+  LayoutContended<wctype_two_level::lookup_properties, TouchTwoLevel>(state);
+}
+
+static void BM_Layout_FlatBmp_Contended(benchmark::State &state) {
+  LayoutContended<wctype_flat_bmp::lookup_properties, TouchFlatBmp>(state);
+}
+
+static void BM_Layout_ThreeStage_Contended(benchmark::State &state) {
+  LayoutContended<wctype_three_stage::lookup_properties, TouchThreeStage>(
+      state);
+}
+
+BENCHMARK(BM_Layout_TwoLevel_Contended)->Arg(0)->Arg(32)->Arg(1536);
+BENCHMARK(BM_Layout_FlatBmp_Contended)->Arg(0)->Arg(32)->Arg(1536);
+BENCHMARK(BM_Layout_ThreeStage_Contended)->Arg(0)->Arg(32)->Arg(1536);
+
+static void BM_Towupper_Staged_PerCall(benchmark::State &state, bool cold) {
+  std::vector<wint_t> out(kCased.size());
+  for (auto _ : state) {
+    if (cold) {
+      state.PauseTiming();
+      FlushCaseTables();
+      state.ResumeTiming();
+    }
+    for (size_t i = 0; i < kCased.size(); ++i) {
+      out[i] = towupper_impl(kCased[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCased.size());
+}
+
+BENCHMARK_CAPTURE(BM_Towupper_Staged_PerCall, Cold, true);
+BENCHMARK_CAPTURE(BM_Towupper_Staged_PerCall, Warm, false);
+
+static void BM_Towupper_Staged_Batch(benchmark::State &state, bool cold) {
+  const std::vector<wint_t> in(kCased.begin(), kCased.end());
+  std::vector<wint_t> out(in.size());
+
+  // The batch must agree with the per-call lookup before it is timed
+  towupper_batch_impl(in.data(), out.data(), in.size());
+  for (size_t i = 0; i < in.size(); ++i) {
+    if (out[i] != towupper_impl(in[i])) {
+      state.SkipWithError("towupper_batch_impl mismatch");
+      return;
+    }
+  }
+
+  for (auto _ : state) {
+    if (cold) {
+      state.PauseTiming();
+      FlushCaseTables();
+      state.ResumeTiming();
+    }
+    towupper_batch_impl(in.data(), out.data(), in.size());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * in.size());
+}
+
+BENCHMARK_CAPTURE(BM_Towupper_Staged_Batch, Cold, true);
+BENCHMARK_CAPTURE(BM_Towupper_Staged_Batch, Warm, false);
+
+BENCHMARK_MAIN();
@@ -1,10 +1,17 @@
 #include <benchmark/benchmark.h>
 #include "mywctype.h"
+#include "mywctype_locale.h"
+#include "dispatch.h"
+#include <array>
+#include <fstream>
+#include <sstream>
 #include <cwctype>
 #include <vector>
 #include <random>
 #include <locale>
+#include <wctype.h>
 #include "v8/v8_unicode.h"
+#include "table_footprint.h"
 
 static void SetupBenchmarks() {
   // std::locale::global(std::locale("C.UTF-8"));
@@ -430,6 +437,686 @@ static void BM_Iswgraph_Std_Bulk_Mixed(benchmark::State &state) {
 
 BENCHMARK(BM_Iswgraph_Std_Bulk_Mixed);
 
+// ============================================================================
+// bulk classification benchmarks
+// ============================================================================
+
+static std::vector<wchar_t> MakeBulkText(const wchar_t *sample) {
+  std::vector<wchar_t> text;
+  while (text.size() < 64 * 1024) {
+    for (const wchar_t *p = sample; *p; ++p) {
+      text.push_back(*p);
+    }
+  }
+  return text;
+}
+
+static const wchar_t *kBulkASCII =
+    L"2024-01-01 12:00:00 INFO request id=42 path=/index.html status=200\n";
+static const wchar_t *kBulkMixed =
+    L"Grüße aus München! Привет, мир. Γειά σου κόσμε. 你好，世界。 123\n";
+
+static void BM_Classify_My_PerCall(benchmark::State &state,
+                                   const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  std::vector<uint16_t> props(text.size());
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < text.size(); ++i) {
+      props[i] = lookup_properties(text[i]);
+    }
+    benchmark::DoNotOptimize(props.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_Classify_My_PerCall, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_Classify_My_PerCall, Mixed, kBulkMixed);
+
+static void BM_Classify_My_Bulk(benchmark::State &state,
+                                const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  std::vector<uint16_t> props(text.size());
+
+  for (auto _ : state) {
+    my_wctype::classify(text, props);
+    benchmark::DoNotOptimize(props.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_Classify_My_Bulk, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_Classify_My_Bulk, Mixed, kBulkMixed);
+
+// A regex class such as [[:alpha:][:digit:]]: one descriptor for the union
+// against one test per class
+static void BM_IswctypeUnion_My(benchmark::State &state,
+                                const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  const my_wctype::mywctype_t desc =
+      my_wctype::WCTYPE_ALPHA | my_wctype::WCTYPE_DIGIT;
+
+  for (auto _ : state) {
+    size_t count = 0;
+    for (wchar_t wc : text) {
+      count += my_wctype::iswctype(wc, desc) != 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_IswctypeUnion_My, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_IswctypeUnion_My, Mixed, kBulkMixed);
+
+static void BM_IswctypeUnion_Std(benchmark::State &state,
+                                 const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  const std::wctype_t alpha = std::wctype("alpha");
+  const std::wctype_t digit = std::wctype("digit");
+
+  for (auto _ : state) {
+    size_t count = 0;
+    for (wchar_t wc : text) {
+      count += std::iswctype(wc, alpha) || std::iswctype(wc, digit);
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_IswctypeUnion_Std, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_IswctypeUnion_Std, Mixed, kBulkMixed);
+
+static const my_wctype::mywctype_t kTokenizerClasses[] = {
+    my_wctype::WCTYPE_SPACE, my_wctype::WCTYPE_ALPHA, my_wctype::WCTYPE_PUNCT};
+
+static void BM_IswctypeBitmap_My_PerCall(benchmark::State &state,
+                                         const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  const size_t words = my_wctype::bitmap_words(text.size());
+  std::vector<uint64_t> bitmaps(std::size(kTokenizerClasses) * words);
+
+  for (auto _ : state) {
+    std::fill(bitmaps.begin(), bitmaps.end(), 0);
+    for (size_t k = 0; k < std::size(kTokenizerClasses); ++k) {
+      for (size_t i = 0; i < text.size(); ++i) {
+        if (my_wctype::iswctype(text[i], kTokenizerClasses[k])) {
+          bitmaps[k * words + i / 64] |= uint64_t{1} << (i % 64);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(bitmaps.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_IswctypeBitmap_My_PerCall, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_IswctypeBitmap_My_PerCall, Mixed, kBulkMixed);
+
+static void BM_IswctypeBitmap_My_Bulk(benchmark::State &state,
+                                      const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  const size_t words = my_wctype::bitmap_words(text.size());
+  std::vector<uint64_t> bitmaps(std::size(kTokenizerClasses) * words);
+
+  for (auto _ : state) {
+    my_wctype::iswctype_bitmap(text, kTokenizerClasses, bitmaps);
+    benchmark::DoNotOptimize(bitmaps.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_IswctypeBitmap_My_Bulk, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_IswctypeBitmap_My_Bulk, Mixed, kBulkMixed);
+
+// Single-class scans (spaces only, as for splitting on whitespace): the
+// byte table path vs the per-property bit-planes
+static void BM_SpaceBitmap_ByteTable(benchmark::State &state,
+                                     const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  const my_wctype::mywctype_t space[] = {my_wctype::WCTYPE_SPACE};
+  std::vector<uint64_t> bitmap(my_wctype::bitmap_words(text.size()));
+
+  for (auto _ : state) {
+    my_wctype::iswctype_bitmap(text, space, bitmap);
+    benchmark::DoNotOptimize(bitmap.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+static void BM_SpaceBitmap_BitPlanes(benchmark::State &state,
+                                     const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  std::vector<uint64_t> bitmap(my_wctype::bitmap_words(text.size()));
+
+  for (auto _ : state) {
+    my_wctype::class_bitmap_lookup(text, my_wctype::WCTYPE_SPACE, bitmap);
+    benchmark::DoNotOptimize(bitmap.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_SpaceBitmap_ByteTable, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_SpaceBitmap_BitPlanes, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_SpaceBitmap_ByteTable, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_SpaceBitmap_BitPlanes, Mixed, kBulkMixed);
+
+// The bit-plane lookup for a class fixed at compile time: the Latin-1 lanes
+// are a constant table instead of being expanded per call
+static void BM_SpaceBitmap_BitPlanes_PerClass(benchmark::State &state,
+                                              const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  std::vector<uint64_t> bitmap(my_wctype::bitmap_words(text.size()));
+
+  for (auto _ : state) {
+    my_wctype::class_bitmap_lookup<my_wctype::WCTYPE_SPACE>(text, bitmap);
+    benchmark::DoNotOptimize(bitmap.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_SpaceBitmap_BitPlanes_PerClass, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_SpaceBitmap_BitPlanes_PerClass, Mixed, kBulkMixed);
+
+// Skip a leading word: stops after a few characters
+static const wchar_t *kShortWord = L"token  rest of the line";
+// Skip over a whole buffer of letters: never stops early
+static const wchar_t *kLongWord = L"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTU";
+
+static void BM_FindFirstNotOfClass_My_PerCall(benchmark::State &state,
+                                              const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+
+  for (auto _ : state) {
+    size_t i = 0;
+    while (i < text.size() && my_wctype::iswalpha(text[i])) {
+      ++i;
+    }
+    benchmark::DoNotOptimize(i);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_FindFirstNotOfClass_My_PerCall, Short, kShortWord);
+BENCHMARK_CAPTURE(BM_FindFirstNotOfClass_My_PerCall, Long, kLongWord);
+
+static void BM_FindFirstNotOfClass_My_Bulk(benchmark::State &state,
+                                           const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+
+  for (auto _ : state) {
+    size_t i = my_wctype::find_first_not_of_class(text, my_wctype::WCTYPE_ALPHA);
+    benchmark::DoNotOptimize(i);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_FindFirstNotOfClass_My_Bulk, Short, kShortWord);
+BENCHMARK_CAPTURE(BM_FindFirstNotOfClass_My_Bulk, Long, kLongWord);
+
+static void BM_FindFirstNotOfClass_My_PerClass(benchmark::State &state,
+                                               const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+
+  for (auto _ : state) {
+    size_t i =
+        my_wctype::find_first_not_of_class<my_wctype::WCTYPE_ALPHA>(text);
+    benchmark::DoNotOptimize(i);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_FindFirstNotOfClass_My_PerClass, Short, kShortWord);
+BENCHMARK_CAPTURE(BM_FindFirstNotOfClass_My_PerClass, Long, kLongWord);
+
+// iswctype in an inner loop with the descriptor known only at runtime, as
+// when it comes from wctype(name), against the same class as a template
+// argument
+static void BM_Iswctype_My_RuntimeDesc(benchmark::State &state,
+                                       const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  my_wctype::mywctype_t desc = my_wctype::wctype("punct");
+  benchmark::DoNotOptimize(desc);
+
+  for (auto _ : state) {
+    size_t count = 0;
+    for (wchar_t wc : text) {
+      count += my_wctype::iswctype(wc, desc) != 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_Iswctype_My_RuntimeDesc, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_Iswctype_My_RuntimeDesc, Mixed, kBulkMixed);
+
+static void BM_Iswctype_My_PerClass(benchmark::State &state,
+                                    const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+
+  for (auto _ : state) {
+    size_t count = 0;
+    for (wchar_t wc : text) {
+      count += my_wctype::iswctype<my_wctype::wctype<"punct">()>(wc) != 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_Iswctype_My_PerClass, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_Iswctype_My_PerClass, Mixed, kBulkMixed);
+
+static void BM_ClassHistogram_My_PerCall(benchmark::State &state,
+                                        const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+
+  for (auto _ : state) {
+    // One sweep per class, as callers had to do before class_histogram
+    std::array<size_t, 12> counts{};
+    for (unsigned bit = 0; bit < 12; ++bit) {
+      for (wchar_t wc : text) {
+        counts[bit] += my_wctype::iswctype(wc, 1 << bit) != 0;
+      }
+    }
+    benchmark::DoNotOptimize(counts.data());
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_ClassHistogram_My_PerCall, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_ClassHistogram_My_PerCall, Mixed, kBulkMixed);
+
+static void BM_ClassHistogram_My_Bulk(benchmark::State &state,
+                                      const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+
+  for (auto _ : state) {
+    auto histogram = my_wctype::class_histogram(text);
+    benchmark::DoNotOptimize(histogram);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_ClassHistogram_My_Bulk, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_ClassHistogram_My_Bulk, Mixed, kBulkMixed);
+
+// ============================================================================
+// table layouts side by side, whatever MYWCTYPE_TABLE_LAYOUT selects
+// ============================================================================
+
+static const wchar_t *kBulkSupplementary =
+    L"\U0001D400\U0001D401 \U0001F600\U0001F603 \U00020000\U00020001 "
+    L"\U0001D538\U0001D539 \U00010400\U00010428\n";
+
+template <uint16_t (*Lookup)(wint_t),
+          void (*TouchLayout)(TableFootprint &, uint32_t)>
+static void LookupThroughput(benchmark::State &state, const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+
+  for (auto _ : state) {
+    unsigned acc = 0;
+    for (wchar_t wc : text) {
+      acc += Lookup(wc);
+    }
+    benchmark::DoNotOptimize(acc);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+
+  TableFootprint footprint;
+  for (wchar_t wc : text) {
+    TouchLayout(footprint, wc);
+  }
+  state.counters["table_lines"] = footprint.lines.size();
+  state.counters["table_pages"] = footprint.pages.size();
+}
+
+// Each result picks the next character, so lookups can't overlap and the
+// time per item is the latency of one lookup
+template <uint16_t (*Lookup)(wint_t)>
+static void LookupLatency(benchmark::State &state, const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  constexpr size_t kSteps = 4096;
+
+  for (auto _ : state) {
+    uint16_t props = 0;
+    for (size_t i = 0; i < kSteps; ++i) {
+      props = Lookup(text[(i + props) & 0xFFFF]);
+    }
+    benchmark::DoNotOptimize(props);
+  }
+  state.SetItemsProcessed(state.iterations() * kSteps);
+}
+
+static void BM_Layout_TwoLevel_Throughput(benchmark::State &state,
+                                          const wchar_t *sample) {
+  LookupThroughput<wctype_two_level::lookup_properties, TouchTwoLevel>(
+      state, sample);
+}
+
+static void BM_Layout_FlatBmp_Throughput(benchmark::State &state,
+                                         const wchar_t *sample) {
+  LookupThroughput<wctype_flat_bmp::lookup_properties, TouchFlatBmp>(
+      state, sample);
+}
+
+static void BM_Layout_ThreeStage_Throughput(benchmark::State &state,
+                                            const wchar_t *sample) {
+  LookupThroughput<wctype_three_stage::lookup_properties, TouchThreeStage>(
+      state, sample);
+}
+
+static void BM_Layout_TwoLevel_Latency(benchmark::State &state,
+                                       const wchar_t *sample) {
+  LookupLatency<wctype_two_level::lookup_properties>(state, sample);
+}
+
+static void BM_Layout_FlatBmp_Latency(benchmark::State &state,
+                                      const wchar_t *sample) {
+  LookupLatency<wctype_flat_bmp::lookup_properties>(state, sample);
+}
+
+static void BM_Layout_ThreeStage_Latency(benchmark::State &state,
+                                         const wchar_t *sample) {
+  LookupLatency<wctype_three_stage::lookup_properties>(state, sample);
+}
+
+BENCHMARK_CAPTURE(BM_Layout_TwoLevel_Throughput, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_Layout_FlatBmp_Throughput, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_Layout_ThreeStage_Throughput, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_Layout_TwoLevel_Throughput, Supplementary,
+                  kBulkSupplementary);
+BENCHMARK_CAPTURE(BM_Layout_FlatBmp_Throughput, Supplementary,
+                  kBulkSupplementary);
+BENCHMARK_CAPTURE(BM_Layout_ThreeStage_Throughput, Supplementary,
+                  kBulkSupplementary);
+BENCHMARK_CAPTURE(BM_Layout_TwoLevel_Latency, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_Layout_FlatBmp_Latency, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_Layout_ThreeStage_Latency, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_Layout_TwoLevel_Latency, Supplementary,
+                  kBulkSupplementary);
+BENCHMARK_CAPTURE(BM_Layout_FlatBmp_Latency, Supplementary,
+                  kBulkSupplementary);
+BENCHMARK_CAPTURE(BM_Layout_ThreeStage_Latency, Supplementary,
+                  kBulkSupplementary);
+
+// Classification under a locale object: the library's C and C.UTF-8 with
+// the locale fixed at compile time, picked per call or hoisted out of the
+// loop, and glibc's iswalpha_l for comparison
+static void BM_IswalphaL_My_Static(benchmark::State &state,
+                                   const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+
+  for (auto _ : state) {
+    size_t count = 0;
+    for (wchar_t wc : text) {
+      count += my_wctype::iswalpha_l(wc, my_wctype::c_locale) != 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+static void BM_IswalphaL_My_PerCall(benchmark::State &state,
+                                    const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  auto loc = *my_wctype::newlocale("C");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(loc);
+    size_t count = 0;
+    for (wchar_t wc : text) {
+      count += my_wctype::iswalpha_l(wc, loc) != 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+static void BM_IswalphaL_My_Hoisted(benchmark::State &state,
+                                    const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  auto loc = *my_wctype::newlocale("C");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(loc);
+    size_t count = my_wctype::with_locale(loc, [&](auto l) {
+      size_t n = 0;
+      for (wchar_t wc : text) {
+        n += my_wctype::iswalpha_l(wc, l) != 0;
+      }
+      return n;
+    });
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+static void BM_IswalphaL_Std(benchmark::State &state, const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  ::locale_t loc = ::newlocale(LC_ALL_MASK, "C", nullptr);
+
+  for (auto _ : state) {
+    size_t count = 0;
+    for (wchar_t wc : text) {
+      count += ::iswalpha_l(wc, loc) != 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+  ::freelocale(loc);
+}
+
+BENCHMARK_CAPTURE(BM_IswalphaL_My_Static, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_IswalphaL_My_PerCall, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_IswalphaL_My_Hoisted, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_IswalphaL_Std, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_IswalphaL_My_Static, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_IswalphaL_My_PerCall, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_IswalphaL_My_Hoisted, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_IswalphaL_Std, Mixed, kBulkMixed);
+
+// Fast paths of wctype_fast_paths.h against the plain table lookup, on text
+// drawn from the block profile they were generated from, and on text that
+// misses every one of them
+static std::vector<wchar_t> MakeProfiledText() {
+  std::ifstream file(BENCHMARK_BLOCK_PROFILE);
+  std::vector<std::vector<wchar_t>> pools;
+  std::vector<double> weights;
+  std::string line;
+  while (std::getline(file, line)) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields(line);
+    uint32_t block;
+    uint64_t hits;
+    if (!(fields >> std::hex >> block >> std::dec >> hits) ||
+        block >= 0x1100) {
+      continue;
+    }
+    // The block's assigned codepoints, or all of them if it has none
+    std::vector<wchar_t> pool;
+    for (uint32_t cp = block << 8; cp <= (block << 8 | 0xFF); ++cp) {
+      if (lookup_properties(cp) != 0) {
+        pool.push_back(static_cast<wchar_t>(cp));
+      }
+    }
+    for (uint32_t cp = block << 8; pool.empty() && cp <= (block << 8 | 0xFF);
+         ++cp) {
+      pool.push_back(static_cast<wchar_t>(cp));
+    }
+    pools.push_back(std::move(pool));
+    weights.push_back(static_cast<double>(hits));
+  }
+
+  std::mt19937 rng(42);
+  std::discrete_distribution<size_t> pick_block(weights.begin(),
+                                                weights.end());
+  // Words of 1..8 characters from one block
+  std::vector<wchar_t> text;
+  while (text.size() < 64 * 1024) {
+    const auto &pool = pools[pick_block(rng)];
+    for (size_t n = 1 + rng() % 8; n > 0 && text.size() < 64 * 1024; --n) {
+      text.push_back(pool[rng() % pool.size()]);
+    }
+  }
+  return text;
+}
+
+static const std::vector<wchar_t> &ProfiledText() {
+  static const auto text = MakeProfiledText();
+  return text;
+}
+
+template <uint16_t (*Lookup)(wint_t)>
+static void ProfiledThroughput(benchmark::State &state,
+                               const std::vector<wchar_t> &text) {
+  for (auto _ : state) {
+    unsigned acc = 0;
+    for (wchar_t wc : text) {
+      acc += Lookup(wc);
+    }
+    benchmark::DoNotOptimize(acc);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+template <uint16_t (*Lookup)(wint_t)>
+static void ProfiledLatency(benchmark::State &state,
+                            const std::vector<wchar_t> &text) {
+  constexpr size_t kSteps = 4096;
+  for (auto _ : state) {
+    uint16_t props = 0;
+    for (size_t i = 0; i < kSteps; ++i) {
+      props = Lookup(text[(i + props) & 0xFFFF]);
+    }
+    benchmark::DoNotOptimize(props);
+  }
+  state.SetItemsProcessed(state.iterations() * kSteps);
+}
+
+static void BM_FastPaths_Throughput(benchmark::State &state, bool profiled) {
+  ProfiledThroughput<wctype_fast_paths::lookup_properties>(
+      state, profiled ? ProfiledText() : MakeBulkText(kBulkSupplementary));
+}
+
+static void BM_Tables_Throughput(benchmark::State &state, bool profiled) {
+  ProfiledThroughput<lookup_properties>(
+      state, profiled ? ProfiledText() : MakeBulkText(kBulkSupplementary));
+}
+
+static void BM_FastPaths_Latency(benchmark::State &state, bool profiled) {
+  ProfiledLatency<wctype_fast_paths::lookup_properties>(
+      state, profiled ? ProfiledText() : MakeBulkText(kBulkSupplementary));
+}
+
+static void BM_Tables_Latency(benchmark::State &state, bool profiled) {
+  ProfiledLatency<lookup_properties>(
+      state, profiled ? ProfiledText() : MakeBulkText(kBulkSupplementary));
+}
+
+BENCHMARK_CAPTURE(BM_FastPaths_Throughput, Profiled, true);
+BENCHMARK_CAPTURE(BM_Tables_Throughput, Profiled, true);
+BENCHMARK_CAPTURE(BM_FastPaths_Latency, Profiled, true);
+BENCHMARK_CAPTURE(BM_Tables_Latency, Profiled, true);
+BENCHMARK_CAPTURE(BM_FastPaths_Throughput, Supplementary, false);
+BENCHMARK_CAPTURE(BM_Tables_Throughput, Supplementary, false);
+BENCHMARK_CAPTURE(BM_FastPaths_Latency, Supplementary, false);
+BENCHMARK_CAPTURE(BM_Tables_Latency, Supplementary, false);
+
+// Case folding of letters as a case-insensitive matcher does it: iswalpha
+// and then towlower on the same character, against one lookup in the
+// combined table of wctype_class_case.h
+static void BM_FoldLetters_Separate(benchmark::State &state,
+                                    const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  std::vector<wint_t> folded(text.size());
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < text.size(); ++i) {
+      const wchar_t wc = text[i];
+      folded[i] = my_wctype::iswalpha(wc) ? my_wctype::towlower(wc) : wc;
+    }
+    benchmark::DoNotOptimize(folded.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+static void BM_FoldLetters_Combined(benchmark::State &state,
+                                    const wchar_t *sample) {
+  const auto text = MakeBulkText(sample);
+  std::vector<wint_t> folded(text.size());
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < text.size(); ++i) {
+      const wchar_t wc = text[i];
+      const auto c = my_wctype::classify_and_lower(wc);
+      folded[i] = c.properties & my_wctype::WCTYPE_ALPHA ? c.mapped : wc;
+    }
+    benchmark::DoNotOptimize(folded.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_CAPTURE(BM_FoldLetters_Separate, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_FoldLetters_Combined, ASCII, kBulkASCII);
+BENCHMARK_CAPTURE(BM_FoldLetters_Separate, Mixed, kBulkMixed);
+BENCHMARK_CAPTURE(BM_FoldLetters_Combined, Mixed, kBulkMixed);
+
+// Runtime-dispatched kernels, one run per instruction set (0 = scalar,
+// 1 = SSE4.2, 2 = AVX2, 3 = AVX-512)
+static bool ForceIsa(benchmark::State &state) {
+  const auto isa = static_cast<my_wctype::dispatch::Isa>(state.range(0));
+  if (!my_wctype::dispatch::force_isa(isa)) {
+    state.SkipWithError("instruction set not supported");
+    return false;
+  }
+  state.SetLabel(my_wctype::dispatch::isa_name(isa));
+  return true;
+}
+
+static void BM_Classify_Dispatch_Mixed(benchmark::State &state) {
+  if (!ForceIsa(state)) {
+    return;
+  }
+  const auto text = MakeBulkText(kBulkMixed);
+  std::vector<uint16_t> props(text.size());
+
+  for (auto _ : state) {
+    my_wctype::dispatch::classify(text, props);
+    benchmark::DoNotOptimize(props.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+  my_wctype::dispatch::reset_isa();
+}
+
+BENCHMARK(BM_Classify_Dispatch_Mixed)->DenseRange(0, 3);
+
+static void BM_FindFirstNotOfClass_Dispatch_Long(benchmark::State &state) {
+  if (!ForceIsa(state)) {
+    return;
+  }
+  const auto text = MakeBulkText(kLongWord);
+
+  for (auto _ : state) {
+    size_t i = my_wctype::dispatch::find_first_not_of_class(
+        text, my_wctype::WCTYPE_ALPHA);
+    benchmark::DoNotOptimize(i);
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+  my_wctype::dispatch::reset_isa();
+}
+
+BENCHMARK(BM_FindFirstNotOfClass_Dispatch_Long)->DenseRange(0, 3);
+
 int main(int argc, char **argv) {
   SetupBenchmarks();
   ::benchmark::Initialize(&argc, argv);
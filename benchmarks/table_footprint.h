@@ -0,0 +1,43 @@
+#ifndef WCTYPE_BENCHMARKS_TABLE_FOOTPRINT_H
+#define WCTYPE_BENCHMARKS_TABLE_FOOTPRINT_H
+
+#include "wctype_table.h"
+#include <cstdint>
+#include <set>
+
+// Cache lines and pages of the tables that a run of lookups reads: the
+// misses it takes from a cold cache and TLB
+struct TableFootprint {
+  std::set<uintptr_t> lines;
+  std::set<uintptr_t> pages;
+
+  void Touch(const void *p) {
+    const auto address = reinterpret_cast<uintptr_t>(p);
+    lines.insert(address / 64);
+    pages.insert(address / 4096);
+  }
+};
+
+inline void TouchTwoLevel(TableFootprint &footprint, uint32_t cp) {
+  footprint.Touch(
+      &wctype_two_level::level1[cp >> wctype_two_level::block_bits]);
+  footprint.Touch(wctype_two_level::entry(cp));
+}
+
+inline void TouchFlatBmp(TableFootprint &footprint, uint32_t cp) {
+  if (cp >= 0x10000) {
+    footprint.Touch(&wctype_flat_bmp::level1[(cp >> 8) - 0x100]);
+  }
+  footprint.Touch(wctype_flat_bmp::entry(cp));
+}
+
+inline void TouchThreeStage(TableFootprint &footprint, uint32_t cp) {
+  using namespace wctype_three_stage;
+  const unsigned block = level1[cp >> (mid_bits + leaf_bits)];
+  const unsigned mid = (cp >> leaf_bits) & ((1u << mid_bits) - 1);
+  footprint.Touch(&level1[cp >> (mid_bits + leaf_bits)]);
+  footprint.Touch(&level2[block << mid_bits | mid]);
+  footprint.Touch(entry(cp));
+}
+
+#endif // WCTYPE_BENCHMARKS_TABLE_FOOTPRINT_H
@@ -1,5 +1,9 @@
 #include <benchmark/benchmark.h>
 #include "mywctype.h"
+#include "case_mapping.h"
+#include "case_mapping_hash.h"
+#include "case_mapping_rules.h"
+#include <unordered_map>
 #include <vector>
 #include <random>
 #include <locale>
@@ -261,6 +265,171 @@ static void BM_Towlower_Std_High_Unicode(benchmark::State &state) {
 
 BENCHMARK(BM_Towlower_Std_High_Unicode);
 
+// The std::unordered_map tables ht.h used to build, against the perfect
+// hashes of case_mapping_hash.h that replaced them
+static size_t ht_heap_bytes = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    ht_heap_bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  bool operator==(const CountingAllocator &) const = default;
+};
+
+using HtMap = std::unordered_map<wint_t, wint_t, std::hash<wint_t>,
+                                 std::equal_to<wint_t>,
+                                 CountingAllocator<std::pair<const wint_t,
+                                                             wint_t>>>;
+
+static HtMap MakeHtLowerMap() {
+  return {
+#include "case_mapping_lower.inc"
+  };
+}
+
+static wint_t HtFind(HtMap &map, wint_t wc) {
+  if (map.find(wc) == map.end()) {
+    return wc;
+  }
+  return map[wc];
+}
+
+static std::vector<wint_t> MakeMixedCaseText() {
+  std::vector<wint_t> text;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<wint_t> dist(0x80, 0x2FFF);
+  for (int i = 0; i < 1000; ++i) {
+    text.push_back(dist(rng));
+  }
+  return text;
+}
+
+// Dynamic initialization of the map, per translation unit that included
+// ht.h; the hash tables have none
+static void BM_CaseTables_Init_UnorderedMap(benchmark::State &state) {
+  for (auto _ : state) {
+    ht_heap_bytes = 0;
+    HtMap map = MakeHtLowerMap();
+    benchmark::DoNotOptimize(map);
+  }
+  state.counters["heap_bytes"] = static_cast<double>(ht_heap_bytes);
+}
+
+BENCHMARK(BM_CaseTables_Init_UnorderedMap);
+
+static void BM_Towlower_UnorderedMap_Mixed(benchmark::State &state) {
+  HtMap map = MakeHtLowerMap();
+  const auto text = MakeMixedCaseText();
+  for (auto _ : state) {
+    for (wint_t c : text) {
+      benchmark::DoNotOptimize(HtFind(map, c));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK(BM_Towlower_UnorderedMap_Mixed);
+
+static void BM_Towlower_Hash_Mixed(benchmark::State &state) {
+  const auto text = MakeMixedCaseText();
+  for (auto _ : state) {
+    for (wint_t c : text) {
+      benchmark::DoNotOptimize(case_hash_towlower(c));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+  state.counters["rodata_bytes"] =
+      sizeof(to_lower_hash_seeds) + sizeof(to_lower_hash_slots);
+}
+
+BENCHMARK(BM_Towlower_Hash_Mixed);
+
+// The case backends on cased text: random codepoints that have a lowercase
+// mapping, each followed by that lowercase letter
+static std::vector<wint_t> MakeCasedText() {
+  const std::vector<std::pair<wint_t, wint_t>> mappings = {
+#include "case_mapping_lower.inc"
+  };
+  std::vector<wint_t> text;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<size_t> pick(0, mappings.size() - 1);
+  for (int i = 0; i < 500; ++i) {
+    const auto &[upper, lower] = mappings[pick(rng)];
+    text.push_back(upper);
+    text.push_back(lower);
+  }
+  return text;
+}
+
+template <wint_t (*Towlower)(wint_t), std::vector<wint_t> (*MakeText)()>
+static void BM_Towlower_Backend(benchmark::State &state) {
+  const auto text = MakeText();
+  for (auto _ : state) {
+    for (wint_t c : text) {
+      benchmark::DoNotOptimize(Towlower(c));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * text.size());
+}
+
+static wint_t StagedTowlower(wint_t wc) { return my_wctype::towlower(wc); }
+static wint_t HashTowlower(wint_t wc) { return case_hash_towlower(wc); }
+static wint_t RulesTowlower(wint_t wc) { return case_rules_towlower(wc); }
+static wint_t SearchTowlower(wint_t wc) { return case_search_towlower(wc); }
+
+// The branchy binary search case_mapping.h did over the sorted mappings
+// before its B-tree layout
+static wint_t BinarySearchTowlower(wint_t wc) {
+  static constexpr std::pair<uint32_t, uint32_t> sorted[] = {
+#include "case_mapping_lower.inc"
+  };
+  size_t left = 0;
+  size_t right = std::size(sorted);
+  while (left < right) {
+    size_t mid = left + (right - left) / 2;
+    if (sorted[mid].first == wc) {
+      return sorted[mid].second;
+    } else if (sorted[mid].first < wc) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+  return wc;
+}
+
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, StagedTowlower, MakeMixedCaseText)
+    ->Name("BM_CaseBackend_Staged_Mixed");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, HashTowlower, MakeMixedCaseText)
+    ->Name("BM_CaseBackend_Hash_Mixed");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, RulesTowlower, MakeMixedCaseText)
+    ->Name("BM_CaseBackend_Rules_Mixed");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, SearchTowlower, MakeMixedCaseText)
+    ->Name("BM_CaseBackend_Search_Mixed");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, BinarySearchTowlower,
+                    MakeMixedCaseText)
+    ->Name("BM_CaseBackend_BinarySearch_Mixed");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, StagedTowlower, MakeCasedText)
+    ->Name("BM_CaseBackend_Staged_Cased");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, HashTowlower, MakeCasedText)
+    ->Name("BM_CaseBackend_Hash_Cased");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, RulesTowlower, MakeCasedText)
+    ->Name("BM_CaseBackend_Rules_Cased");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, SearchTowlower, MakeCasedText)
+    ->Name("BM_CaseBackend_Search_Cased");
+BENCHMARK_TEMPLATE2(BM_Towlower_Backend, BinarySearchTowlower, MakeCasedText)
+    ->Name("BM_CaseBackend_BinarySearch_Cased");
+
 int main(int argc, char **argv) {
   SetupBenchmarks();
   ::benchmark::Initialize(&argc, argv);
@@ -0,0 +1,1567 @@
+// Auto-generated by generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef WCTYPE_BITPLANES_H
+#define WCTYPE_BITPLANES_H
+
+#include <stdint.h>
+
+// One bitset per property: level1 maps codepoint >> 8 to a block of four
+// 64-bit words, and bit cp & 63 of word (cp >> 6) & 3 is set iff cp has
+// the property
+namespace wctype_bitplanes {
+
+struct Plane {
+  const uint8_t *level1;
+  const uint64_t *words;
+  uint32_t limit; // First codepoint past level1
+};
+
+alignas(64) inline constexpr uint8_t upper_level1[490] = {
+  0, 1, 2, 3, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  7, 6, 6, 8, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 10, 11,
+  6, 12, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 13, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 14, 15, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 16,
+  6, 6, 6, 6, 17, 18, 6, 6, 6, 6, 6, 6, 19, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 20, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 21, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 22, 23, 24, 25, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 26,
+};
+
+alignas(64) inline constexpr uint64_t upper_words[108] = {
+    0x0000000000000000, 0x0000000007fffffe, 0x0000000000000000, 0x000000007f7fffff,
+    0xaa55555555555555, 0x2b555555555554aa, 0x11aed2d5b1dbced6, 0x55d255554aaaa490,
+    0x6c05555555555555, 0x000000000000557a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x8045000000000000, 0x00000ffbfffed740, 0xe6905555551c8000,
+    0x0000ffffffffffff, 0x5555555500000000, 0x5555555555555401, 0x5555555555552aab,
+    0xfffe555555555555, 0x00000000007fffff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffff00000000, 0x00000000000020bf,
+    0x0000000000000000, 0x0000000000000000, 0xffffffff00000000, 0x003fffffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0xe7ffffffffff0000, 0x0000000000000000,
+    0x5555555555555555, 0x5555555555555555, 0x5555555540155555, 0x5555555555555555,
+    0xff00ff003f00ff00, 0x0000ff00aa003f00, 0x0f00000000000000, 0x0f001f000f000f00,
+    0xc00f3d503e273884, 0x0000000000000020, 0x0000000000000008, 0x0000000000000000,
+    0x0000ffffffffffff, 0xc025ea9d00000000, 0x5555555555555555, 0x0004280555555555,
+    0x0000000000000000, 0x0000155555555555, 0x0000000005555555, 0x0000000000000000,
+    0x5554555400000000, 0x6a00555555555555, 0x555f7d5555452855, 0x00200000014102f5,
+    0x07fffffe00000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000000ffffffffff, 0x0000000000000000, 0xffff000000000000, 0x00000000000fffff,
+    0x0000000000000000, 0xf7ff000000000000, 0x000000000037f7ff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0007ffffffffffff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffff00000000, 0x0000000000000000,
+    0x0000000000000000, 0x00000000ffffffff, 0x0000000000000000, 0x0000000000000000,
+    0xfff0000003ffffff, 0xffffff0000003fff, 0x003fde64d0000003, 0x000003ffffff0000,
+    0x7b0000001fdfe7b0, 0xfffff0000001fc5f, 0x03ffffff0000003f, 0x00003ffffff00000,
+    0xf0000003ffffff00, 0xffff0000003fffff, 0xffffff00000003ff, 0x07fffffc00000001,
+    0x001ffffff0000000, 0x00007fffffc00000, 0x000001ffffff0000, 0x0000000000000400,
+    0x00000003ffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+alignas(64) inline constexpr uint8_t lower_level1[490] = {
+  0, 1, 2, 3, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  7, 6, 6, 8, 6, 6, 6, 6, 6, 6, 6, 6, 9, 10, 11, 12,
+  6, 13, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 15, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 16, 17, 6, 6, 6, 18, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 19, 6, 6, 6, 20,
+  6, 6, 6, 6, 21, 22, 6, 6, 6, 6, 6, 6, 23, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 24, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 25, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 26, 27, 28, 29, 6, 6, 6, 6, 6, 6, 6, 30,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 31,
+};
+
+alignas(64) inline constexpr uint64_t lower_words[128] = {
+    0x0000000000000000, 0x07fffffe00000000, 0x0020000000000000, 0xff7fffff80000000,
+    0x55aaaaaaaaaaaaaa, 0xd4aaaaaaaaaaab55, 0xe6512d2a4e243129, 0xaa29aaaab5555240,
+    0x93faaaaaaaaaaaaa, 0xffffffffffffaa85, 0x0000ffffffefffff, 0x0000000000000000,
+    0x0000000000000000, 0x388a000000000000, 0xfffff00000010000, 0x192faaaaaae37fff,
+    0xffff000000000000, 0xaaaaaaaaffffffff, 0xaaaaaaaaaaaaa802, 0xaaaaaaaaaaaad554,
+    0x0000aaaaaaaaaaaa, 0xffffffff00000000, 0x00000000000001ff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xe7ffffffffff0000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x3f00000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00000000000001ff, 0x0000000000000000,
+    0x00000fffffffffff, 0xfefff80000000000, 0x0000000007ffffff, 0x0000000000000000,
+    0xaaaaaaaaaaaaaaaa, 0xaaaaaaaaaaaaaaaa, 0xaaaaaaaabfeaaaaa, 0xaaaaaaaaaaaaaaaa,
+    0x00ff00ff003f00ff, 0x3fff00ff00ff003f, 0x40df00ff00ff00ff, 0x00dc00ff00cf00dc,
+    0x321080000008c400, 0x00000000000043c0, 0x0000000000000010, 0x0000000000000000,
+    0xffff000000000000, 0x0fda1562ffffffff, 0xaaaaaaaaaaaaaaaa, 0x0008501aaaaaaaaa,
+    0x000020bfffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x00002aaaaaaaaaaa, 0x000000000aaaaaaa, 0x0000000000000000,
+    0xaaabaaa800000000, 0x95feaaaaaaaaaaaa, 0xaaa082aaaaba50aa, 0x0440000002aa050a,
+    0xffff000000000000, 0xffff01ff07ffffff, 0xffffffffffffffff, 0x0000000000000000,
+    0x0000000000f8007f, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000007fffffe, 0x0000000000000000, 0x0000000000000000,
+    0xffffff0000000000, 0x000000000000ffff, 0x0000000000000000, 0x0fffffffff000000,
+    0x0000000000000000, 0x0000000000000000, 0x1bfbfffbff800000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0007ffffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00000000ffffffff,
+    0x0000000000000000, 0xffffffff00000000, 0x0000000000000000, 0x0000000000000000,
+    0x000ffffffc000000, 0x000000ffffdfc000, 0xebc000000ffffffc, 0xfffffc000000ffef,
+    0x00ffffffc000000f, 0x00000ffffffc0000, 0xfc000000ffffffc0, 0xffffc000000fffff,
+    0x0ffffffc000000ff, 0x0000ffffffc00000, 0x0000003ffffffc00, 0xf0000003f7fffffc,
+    0xffc000000fdfffff, 0xffff0000003f7fff, 0xfffffc000000fdff, 0x0000000000000bf7,
+    0x000007e07ffffbff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xfffffffc00000000, 0x000000000000000f, 0x0000000000000000, 0x0000000000000000,
+};
+
+alignas(64) inline constexpr uint8_t alpha_level1[804] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 1, 17, 18, 19, 1, 20, 21, 22, 23, 24, 25, 26, 27, 1, 28,
+  29, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 33, 34, 31,
+  35, 36, 31, 31, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 27, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 37, 1, 38, 39, 40, 41, 42, 43, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 44, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 1, 45, 46, 1, 47, 48, 49,
+  50, 51, 52, 53, 54, 55, 1, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 31, 76, 77, 78, 79,
+  1, 1, 1, 80, 81, 82, 31, 31, 31, 31, 31, 31, 31, 31, 31, 83,
+  1, 1, 1, 1, 84, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 1, 1, 85, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 86, 87, 31, 31, 88, 89,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 90, 1, 1, 1, 1, 91, 92, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 93,
+  1, 94, 95, 31, 31, 31, 31, 31, 31, 31, 31, 31, 96, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 97, 98, 99, 100, 31, 31, 31, 31, 31, 31, 31, 101,
+  102, 103, 104, 31, 105, 31, 31, 106, 107, 108, 31, 31, 31, 31, 109, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 110, 31, 31, 31, 31,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 111, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 112, 113, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 114, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 115, 1, 1, 116, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 117, 31, 31, 31, 31, 31,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 118, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 119,
+};
+
+alignas(64) inline constexpr uint64_t alpha_words[480] = {
+    0x0000000000000000, 0x07fffffe07fffffe, 0x0420040000000000, 0xff7fffffff7fffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0000501f0003ffc3,
+    0x0000000000000000, 0xbcdf000000000000, 0xfffffffbffffd740, 0xffbfffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffffffc03, 0xffffffffffffffff,
+    0xfffeffffffffffff, 0xffffffff027fffff, 0x00000000000001ff, 0x000787ffffff0000,
+    0xffffffff00000000, 0xfffec3ff000007ff, 0xffffffffffffffff, 0x9fffc060002fffff,
+    0x0000fffffffd0000, 0xffffffffffffe000, 0x0002003fffffffff, 0x043007ffffffffff,
+    0x00000110043fffff, 0xffff07ff01ffffff, 0xffffffff00007eff, 0x00000000000003ff,
+    0x23fffffffffffff0, 0xfffeffc3ff010000, 0x23c5fdfffff99fe1, 0x1003ffc3b0004000,
+    0x036dfdfffff987e0, 0x001cffc05e000000, 0x23edfdfffffbbfe0, 0x0200ffc300010000,
+    0x23edfdfffff99fe0, 0x0002ffc3b0000000, 0x03ffc718d63dc7e8, 0x0000ffc000010000,
+    0x23fffdfffffddfe0, 0x0000ffc327000000, 0x23effdfffffddfe1, 0x0006ffc360000000,
+    0x27fffffffffddff0, 0xfc00ffc380704000, 0x2ffbfffffc7fffe0, 0x0000ffc00000007f,
+    0x000dfffffffffffe, 0x0000000003ff007f, 0x200dffaffffff7d6, 0x00000000f3ff005f,
+    0x000003ff00000001, 0x00001ffffffffeff, 0x0000000000001f00, 0x0000000000000000,
+    0x800007ffffffffff, 0xffe1c0623c3f03ff, 0xffffffff03ff4003, 0xf7ffffffffff20bf,
+    0xffffffffffffffff, 0xffffffff3d7f3dff, 0x7f3dffffffff3dff, 0xffffffffff7fff3d,
+    0xffffffffff3dffff, 0x0000000007ffffff, 0xffffffff0000ffff, 0x3f3fffffffffffff,
+    0xfffffffffffffffe, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffff9fffffffffff, 0xffffffff07fffffe, 0x01ffc7ffffffffff,
+    0x0003ffff8003ffff, 0x0001dfff0003ffff, 0x000fffffffffffff, 0x000003ff10800000,
+    0xffffffff03ff0000, 0x01ffffffffffffff, 0xffff05ffffffff9f, 0x003fffffffffffff,
+    0x000000007fffffff, 0x001f3fffffffffc0, 0xffff0fffffffffff, 0x0000000003ff03ff,
+    0xffffffff007fffff, 0x00000000001fffff, 0x0000008003ff03ff, 0x0000000000000000,
+    0x000fffffffffffe0, 0x0000000003ff1fe0, 0xffffc001fffffff8, 0x0000003fffffffff,
+    0x0000000fffffffff, 0x3fffffffffffe3ff, 0xe7ffffffffff01ff, 0x046fde0000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0000000000000000,
+    0xffffffff3f3fffff, 0x3fffffffaaff3f3f, 0x5fdfffffffffffff, 0x1fdc1fff0fcf1fdc,
+    0x0000000000000000, 0x8002000000000000, 0x000000001fff0000, 0x0000000000000000,
+    0xf3ffbd503e2ffc84, 0xffffffff000043e0, 0x00000000000001ff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x000c781fffffffff,
+    0xffff20bfffffffff, 0x000080ffffffffff, 0x7f7f7f7f007fffff, 0x000000007f7f7f7f,
+    0x0000800000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x1f3e03fe000000e0, 0xfffffffffffffffe, 0xfffffffee07fffff, 0xf7ffffffffffffff,
+    0xfffeffffffffffe0, 0xffffffffffffffff, 0xffffffff00007fff, 0xffff000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000000000001fff, 0x3fffffffffff0000,
+    0x00000fffffff1fff, 0x80007fffffffffff, 0xffffffff3fffffff, 0x0000ffffffffffff,
+    0xfffffffcff800000, 0xffffffffffffffff, 0xfffffffffffff9ff, 0xfffc000003eb07ff,
+    0x00000007fffff7bb, 0x000fffffffffffff, 0x000ffffffffffffc, 0x68fc000003ff0000,
+    0xffff003fffffffff, 0x1fffffff0000007f, 0x0007fffffffffff0, 0x7fffffdf03ff8000,
+    0x000001ffffffffff, 0xc47fffff03ff0ff7, 0x3e62ffffffffffff, 0x001c07ff38000005,
+    0xffff7f7f007e7e7e, 0xffff03fff7ffffff, 0xffffffffffffffff, 0x03ff0007ffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff000fffffffff, 0x0ffffffffffff87f,
+    0xffffffffffffffff, 0xffff3fffffffffff, 0xffffffffffffffff, 0x0000000003ffffff,
+    0x5f7ffdffa0f8007f, 0xffffffffffffffdb, 0x0003ffffffffffff, 0xfffffffffff80000,
+    0x3fffffffffffffff, 0xffffffffffff0000, 0xfffffffffffcffff, 0x0fff0000000000ff,
+    0x0000000000000000, 0xffdf000000000000, 0xffffffffffffffff, 0x1fffffffffffffff,
+    0x07fffffe03ff0000, 0xffffffc007fffffe, 0x7fffffffffffffff, 0x000000001cfcfcfc,
+    0xb7ffff7fffffefff, 0x000000003fff3fff, 0xffffffffffffffff, 0x07ffffffffffffff,
+    0x0000000000000000, 0x001fffffffffffff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffff1fffffff, 0x000000000001ffff,
+    0xffffe000ffffffff, 0x003fffffffff07ff, 0xffffffff3fffffff, 0x00000000003eff0f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff03ff3fffffff, 0x0fffffffff0fffff,
+    0xffff00ffffffffff, 0xf7ff000fffffffff, 0x1bfbfffbffb7f7ff, 0x0000000000000000,
+    0x007fffffffffffff, 0x000000ff003fffff, 0x07fdffffffffffbf, 0x0000000000000000,
+    0x91bffffffffffd3f, 0x007fffff003fffff, 0x000000007fffffff, 0x0037ffff00000000,
+    0x03ffffff003fffff, 0x0000000000000000, 0xc0ffffffffffffff, 0x0000000000000000,
+    0x003ffffffeef0001, 0x1fffffff00000000, 0x000000001fffffff, 0x0000001ffffffeff,
+    0x003fffffffffffff, 0x0007ffff003fffff, 0x000000000003ffff, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000000000001ff, 0x0007ffffffffffff, 0x0007ffffffffffff,
+    0x03ff000fffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000303ffffffffff, 0x0000000000000000,
+    0xffff00801fffffff, 0xffff00000000003f, 0xffff000000000003, 0x007fffff0000001f,
+    0x00fffffffffffff8, 0x0026ffc000000000, 0x0000fffffffffff8, 0x03ff01ffffff0000,
+    0xffc0007ffffffff8, 0x0047ffffffff0090, 0x0007fffffffffff8, 0x0000000017ff001e,
+    0x80000ffffffbffff, 0x0000000000000001, 0xffff01ffbfffbd7f, 0x03ff00007fffffff,
+    0x23edfdfffff99fe0, 0x00000003e0010000, 0x0000000000000000, 0x0000000000000000,
+    0x001fffffffffffff, 0x0000000383ff0780, 0x0000ffffffffffff, 0x0000000003ff00b0,
+    0x0000000000000000, 0x0000000000000000, 0x00007fffffffffff, 0x000000000f000000,
+    0x0000ffffffffffff, 0x0000000003ff0010, 0x010007ffffffffff, 0x00000000000003ff,
+    0x03ff000007ffffff, 0x000000000000007f, 0x0000000000000000, 0x0000000000000000,
+    0x00000fffffffffff, 0x0000000000000000, 0xffffffff00000000, 0x800003ffffffffff,
+    0x8000ffffff6ff27f, 0x0000000003ff0002, 0xfffffcff00000000, 0x0000000a0001ffff,
+    0x0407fffffffff801, 0xfffffffff0010000, 0xffff0000200003ff, 0x01ffffffffffffff,
+    0x00007ffffffffdff, 0xfffc000003ff0001, 0x000000000000ffff, 0x0000000000000000,
+    0x0001fffffffffb7f, 0xfffffdbf03ff0040, 0x000003ff010003ff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0007ffff00000000,
+    0x000ffffffffdfff4, 0x0000000003ff0000, 0x0001000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000000003ffffff, 0x0000000000000000,
+    0xffffffffffffffff, 0x00007fffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0x000000000000000f, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffffffff0000, 0x0001ffffffffffff,
+    0x0000ffffffffffff, 0x000000000000007e, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x000000000000007f, 0x0000000000000000, 0x0000000000000000,
+    0x01ffffffffffffff, 0xffff03ff7fffffff, 0x7fffffffffffffff, 0x00003fffffff03ff,
+    0x0000ffffffffffff, 0xe0fffff803ff000f, 0x000000000000ffff, 0x0000000000000000,
+    0x0000000000000000, 0xffffffffffffffff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000000000107ff, 0x00000000fff80000, 0x0000000b00000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00ffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000003fffff,
+    0x00000000000001ff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x6fef000000000000,
+    0x00040007ffffffff, 0xffff00f000270000, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0fffffffffffffff,
+    0xffffffffffffffff, 0x1fff07ffffffffff, 0x0000000003ff01ff, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffdfffff, 0xebffde64dfffffff, 0xffffffffffffffef,
+    0x7bffffffdfdfe7bf, 0xfffffffffffdfc5f, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffff3fffffffff, 0xf7fffffff7fffffd,
+    0xffdfffffffdfffff, 0xffff7fffffff7fff, 0xfffffdfffffffdff, 0xffffffffffffcff7,
+    0x000007e07fffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffff000000000000, 0x00003fffffffffff, 0x0000000000000000, 0x0000000000000000,
+    0x3f801fffffffffff, 0x00000000000043ff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00003fffffff0000, 0x03ff0fffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x03ff0fffffff0000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x7fff6f7f00000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x000000000000001f,
+    0xffffffffffffffff, 0x0000000003ff080f, 0x0000000000000000, 0x0000000000000000,
+    0x0af7fe96ffffffef, 0x5ef7f796aa96ea84, 0x0ffffbee0ffffbff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x03ff000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000ffffffff,
+    0x03ffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffff3fffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff0003ffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffff0001ffffffff,
+    0xffffffffffffffff, 0x000000003fffffff, 0x0000000000000000, 0x0000000000000000,
+    0x000000003fffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffff07ff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000ffffffffffff, 0x0000000000000000,
+};
+
+alignas(64) inline constexpr uint8_t space_level1[49] = {
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  4,
+};
+
+alignas(64) inline constexpr uint64_t space_words[20] = {
+    0x0000000100003e00, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000,
+    0x000003000000077f, 0x0000000080000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+alignas(64) inline constexpr uint8_t print_level1[4352] = {
+  0, 1, 1, 2, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+  14, 1, 15, 16, 1, 1, 17, 18, 19, 20, 21, 22, 23, 1, 1, 24,
+  25, 26, 1, 1, 27, 1, 1, 1, 1, 1, 1, 28, 29, 30, 31, 32,
+  33, 34, 35, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 36, 1, 37, 38, 39, 40, 41, 42, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 45, 46, 1, 47, 48, 49,
+  50, 51, 52, 53, 54, 55, 1, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  1, 1, 1, 81, 82, 83, 44, 44, 44, 44, 44, 44, 44, 44, 44, 84,
+  1, 1, 1, 1, 85, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 1, 1, 86, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 1, 1, 87, 88, 44, 44, 89, 90,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 91, 1, 1, 1, 1, 92, 93, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 94,
+  1, 95, 96, 44, 44, 44, 44, 44, 44, 44, 44, 44, 97, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 98,
+  99, 100, 101, 102, 103, 104, 105, 106, 1, 1, 107, 44, 44, 44, 44, 108,
+  109, 110, 111, 44, 112, 44, 44, 113, 114, 115, 44, 44, 116, 117, 118, 44,
+  119, 120, 121, 1, 1, 1, 122, 123, 124, 1, 125, 126, 44, 44, 44, 44,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 127, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 128, 129, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 130, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 131, 1, 1, 132, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 1, 1, 133, 44, 44, 44, 44, 44,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 134, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 135, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 136, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 137,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 137,
+};
+
+alignas(64) inline constexpr uint64_t print_words[552] = {
+    0xffffffff00000000, 0x7fffffffffffffff, 0xffffdfff00000000, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xfcffffffffffffff, 0xfffffffbffffd7f0, 0xffffffffffffffff,
+    0xfffeffffffffffff, 0xfffffffffe7fffff, 0xfffffffffffee7ff, 0x001f87ffffff00ff,
+    0xffffffffefffffc0, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffdfffffff,
+    0xffffffffffff3fff, 0xffffffffffffe7ff, 0x0003ffffffffffff, 0xe7ffffffffffffff,
+    0x7fff3fffffffffff, 0xffff07ff4fffffff, 0xffffffffff007fff, 0xfffffffbffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xf3c5fdfffff99fef, 0x7fffffcfb080799f,
+    0xd36dfdfffff987ee, 0x007fffc05e023987, 0xf3edfdfffffbbfee, 0xfe03ffcf00013bbf,
+    0xf3edfdfffff99fee, 0x00ffffcfb0e0399f, 0xc3ffc718d63dc7ec, 0x07ffffc000813dc7,
+    0xf3fffdfffffddfff, 0xff80ffcf27603ddf, 0xf3effdfffffddfff, 0x000effcf60603ddf,
+    0xfffffffffffddfff, 0xffffffcffff0fddf, 0x2ffbfffffc7fffee, 0x001cffc0ff5f847f,
+    0x87fffffffffffffe, 0x000000000fffffff, 0x3fffffaffffff7d6, 0x00000000f3ff7f5f,
+    0xffffffffffffffff, 0xfffe1ffffffffeff, 0xdffffffffeffffff, 0x0000000007ffdfff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffff20bf,
+    0xffffffffffffffff, 0xffffffff3d7f3dff, 0x7f3dffffffff3dff, 0xffffffffff7fff3d,
+    0xffffffffff3dffff, 0x1fffffffe7ffffff, 0xffffffff03ffffff, 0x3f3fffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffff1fffffff, 0x01ffffffffffffff,
+    0x007fffff803fffff, 0x000ddfff000fffff, 0xffffffffffffffff, 0x03ff03ff3fffffff,
+    0xffffffff03ffbfff, 0x01ffffffffffffff, 0xffff07ffffffffff, 0x003fffffffffffff,
+    0x0fff0fff7fffffff, 0x001f3ffffffffff1, 0xffff0fffffffffff, 0xffffffffc7ff03ff,
+    0xffffffffcfffffff, 0x9fffffff7fffffff, 0xffff3fff03ff03ff, 0x0000000000007fff,
+    0xffffffffffffffff, 0x7fffffffffff1fff, 0xffffffffffffffff, 0xf00fffffffffffff,
+    0xf8ffffffffffffff, 0xffffffffffffe3ff, 0xe7ffffffffff01ff, 0x07ffffffffff00ff,
+    0xffffffff3f3fffff, 0x3fffffffaaff3f3f, 0xffdfffffffffffff, 0x7fdcffffefcfffdf,
+    0xffff83ffffff07ff, 0xfff30000ffffffff, 0xffffffff1fff7fff, 0x0001ffffffff0001,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffff0fff, 0xffffffffffffffff,
+    0x0000007fffffffff, 0xffffffff000007ff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffcfffffffffffff, 0xffffffffffbfffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfe0fffffffffffff,
+    0xffff20bfffffffff, 0x800180ffffffffff, 0x7f7f7f7f007fffff, 0xffffffff7f7f7f7f,
+    0xffffffffffffffff, 0x000000003fffffff, 0xfffffffffbffffff, 0x000fffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffff0000003fffff,
+    0xffffffffffffffff, 0xfffffffffffffffe, 0xfffffffffe7fffff, 0xffffffffffffffff,
+    0xfffeffffffffffe0, 0xffffffffffffffff, 0xffffffffffff7fff, 0xffff800fffffffff,
+    0xffffffff7fffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffff1fff, 0xffffffffffff007f,
+    0x00000fffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00ffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffc000003eb07ff,
+    0x03ff1fffffffffff, 0x00ffffffffffffff, 0xffffffffffffffff, 0xffffffff03ffc03f,
+    0xffffffffffffffff, 0x1fffffff800fffff, 0xffffffffffffffff, 0x7fffffffc3ffbfff,
+    0x007fffffffffffff, 0xfffffffff3ff3fff, 0xffffffffffffffff, 0x007ffffff8000007,
+    0xffff7f7f007e7e7e, 0xffff0fffffffffff, 0xffffffffffffffff, 0x03ff3fffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff000fffffffff, 0x0ffffffffffff87f,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffff3fffffffffff, 0xffffffffffffffff, 0x0000000003ffffff,
+    0x5f7fffffe0f8007f, 0xffffffffffffffdb, 0xffffffffffffffff, 0xfffffffffff80007,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffffcffff, 0xffff0000000080ff,
+    0xffffffff03ffffff, 0xffdf0f7ffff7ffff, 0xffffffffffffffff, 0x1fffffffffffffff,
+    0xfffffffffffffffe, 0xffffffffffffffff, 0x7fffffffffffffff, 0x30007f7f1cfcfcfc,
+    0xb7ffff7fffffefff, 0x000000003fff3fff, 0xffffffffffffffff, 0x07ffffffffffffff,
+    0xff8fffffffffff87, 0xffffffffffffffff, 0x000000011fff7fff, 0x3fffffffffff0000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffff1fffffff, 0x0fffffff0001ffff,
+    0xffffe00fffffffff, 0x07ffffffffff07ff, 0xffffffffbfffffff, 0x00000000003fff0f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff03ff3fffffff, 0x0fffffffff0fffff,
+    0xffff00ffffffffff, 0xf7ff800fffffffff, 0x1bfbfffbffb7f7ff, 0x0000000000000000,
+    0x007fffffffffffff, 0x000000ff003fffff, 0x07fdffffffffffbf, 0x0000000000000000,
+    0x91bffffffffffd3f, 0xffffffffffbfffff, 0x0000ff807fffffff, 0xf837ffff00000000,
+    0x83ffffff8fffffff, 0x0000000000000000, 0xf0ffffffffffffff, 0xfffffffffffcffff,
+    0x873ffffffeeff06f, 0xffffffff01ff01ff, 0x00000000ffffffff, 0x007ff87fffffffff,
+    0xfe3fffffffffffff, 0xff07ffffff3fffff, 0x0000fe001e03ffff, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000000000001ff, 0x0007ffffffffffff, 0xfc07ffffffffffff,
+    0x03ff00ffffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x7fffffff00000000, 0x00033bffffffffff, 0xe000000000000000,
+    0xffff00ffffffffff, 0xffff000003ffffff, 0xffff0000000003ff, 0x007fffff00000fff,
+    0xffffffffffffffff, 0x803ffffffffc3fff, 0xdfffffffffffffff, 0x03ff01ffffff0007,
+    0xffdfffffffffffff, 0x007fffffffff00ff, 0xffffffffffffffff, 0x001ffffeffffffff,
+    0xfffffffffffbffff, 0x0000000000000003, 0xffff03ffbfffbd7f, 0x03ff07ffffffffff,
+    0xfbedfdfffff99fef, 0x001f1fcfe081399f, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000003efffffff, 0xffffffffffffffff, 0x0000000003ff00ff,
+    0x0000000000000000, 0x0000000000000000, 0xff3fffffffffffff, 0x000000003fffffff,
+    0xffffffffffffffff, 0x00001fff03ff001f, 0x03ffffffffffffff, 0x00000000000003ff,
+    0xffff0fffe7ffffff, 0x000000000000007f, 0x0000000000000000, 0x0000000000000000,
+    0x0fffffffffffffff, 0x0000000000000000, 0xffffffff00000000, 0x8007ffffffffffff,
+    0xf9bfffffff6ff27f, 0x0000000003ff007f, 0xfffffcff00000000, 0x0000001ffcffffff,
+    0xffffffffffffffff, 0xffffffffffff00ff, 0xffff0007ffffffff, 0x01ffffffffffffff,
+    0x00000000000003ff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xff7ffffffffffdff, 0xffff1fffffff003f, 0x007ffefffffcffff, 0x0000000000000000,
+    0xb47ffffffffffb7f, 0xfffffdbf03ff00ff, 0x000003ff01fb7fff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x01ffffff00000000,
+    0xc7fffffffffdffff, 0x0000000003ffffff, 0x0001000000000000, 0x8003ffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000000003ffffff, 0x0000000000000000,
+    0xffffffffffffffff, 0x001f7fffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0x000000000000000f, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffffffff0000, 0x0007ffffffffffff,
+    0x0000ffffffffffff, 0x00000000003fffff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x000000000000007f, 0x0000000000000000, 0x0000000000000000,
+    0x01ffffffffffffff, 0xffffc3ff7fffffff, 0x7fffffffffffffff, 0x003f3fffffff03ff,
+    0xffffffffffffffff, 0xe0fffffbfbff003f, 0x000000000000ffff, 0x0000000000000000,
+    0x0000000000000000, 0xffffffffffffffff, 0x0000000007ffffff, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffff87ff, 0x00000000ffff80ff, 0x0003001f00000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00ffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000003fffff,
+    0x00000000000001ff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x6fef000000000000,
+    0x00040007ffffffff, 0xffff00f000270000, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0fffffffffffffff,
+    0xffffffffffffffff, 0x1fff07ffffffffff, 0x00000000f3ff01ff, 0x0000000000000000,
+    0xffff3fffffffffff, 0xffffffffffff007f, 0xffffffffffffffff, 0x000000000000000f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x003fffffffffffff,
+    0xfffffe7fffffffff, 0xf807ffffffffffff, 0xffffffffffffffff, 0x000007ffffffffff,
+    0xffffffffffffffff, 0x000000000000003f, 0x0000000000000000, 0x000fffff000fffff,
+    0xffffffffffffffff, 0x01ffffff007fffff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffdfffff, 0xebffde64dfffffff, 0xffffffffffffffef,
+    0x7bffffffdfdfe7bf, 0xfffffffffffdfc5f, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffff3fffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffcfff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000fffef8000fff, 0x0000000000000000,
+    0x000007e07fffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffff07dbf9ffff7f, 0x00003fffffffffff, 0x0000000000008000, 0x0000000000000000,
+    0x3fff1fffffffffff, 0x000000000000c3ff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00007fffffff0000, 0x83ffffffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x03ffffffffff0000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x7fff6f7f00000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000007fff9f,
+    0xffffffffffffffff, 0x00000000c3ff0fff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0xfffe000000000000, 0x001fffffffffffff, 0x0000000000000000,
+    0x3ffffffffffffffe, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0af7fe96ffffffef, 0x5ef7f796aa96ea84, 0x0ffffbee0ffffbff, 0x0003000000000000,
+    0xffff0fffffffffff, 0xffffffffffffffff, 0xfffe7fff000fffff, 0x003ffffffffefffe,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x00003fffffffffff, 0xffffffc000000000,
+    0x0fffffffffff0007, 0x0000003f000301ff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x1fff1ffff0ffffff,
+    0xffffffffffffffff, 0xf87fffffffffffff, 0xffffffffffffffff, 0x00010fff03ffffff,
+    0xffffffffffff0fff, 0xffffffff03ff00ff, 0x00033fffffff00ff, 0x0000000000000000,
+    0xffffffffffffffff, 0x1fff3fff000fffff, 0xbfffffffffff01ff, 0x01ff01ff0fffc03f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffff7ffff, 0x03ff0000000007ff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000ffffffff,
+    0x03ffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffff3fffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff0003ffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffff0001ffffffff,
+    0xffffffffffffffff, 0x000000003fffffff, 0x0000000000000000, 0x0000000000000000,
+    0x000000003fffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffff07ff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000ffffffffffff, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0000ffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x3fffffffffffffff,
+};
+
+alignas(64) inline constexpr uint8_t blank_level1[49] = {
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  4,
+};
+
+alignas(64) inline constexpr uint64_t blank_words[20] = {
+    0x0000000100000200, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000,
+    0x000000000000077f, 0x0000000080000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+alignas(64) inline constexpr uint8_t cntrl_level1[1] = {
+  0,
+};
+
+alignas(64) inline constexpr uint64_t cntrl_words[8] = {
+    0x00000000ffffffff, 0x8000000000000000, 0x00000000ffffffff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+alignas(64) inline constexpr uint8_t punct_level1[508] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 1, 1, 17, 18, 1, 19, 20, 21, 22, 23, 24, 25, 1, 1, 26,
+  27, 28, 29, 29, 30, 29, 29, 31, 29, 29, 29, 32, 33, 34, 35, 36,
+  37, 38, 39, 29, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 40, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 41, 1, 42, 43, 44, 45, 46, 47, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 48, 1, 49, 50, 51,
+  1, 52, 1, 53, 1, 54, 1, 1, 55, 56, 57, 58, 1, 1, 59, 60,
+  61, 62, 63, 1, 64, 65, 66, 67, 68, 69, 70, 71, 72, 1, 73, 74,
+  1, 1, 1, 1, 75, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 76,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 77, 78, 1, 1, 79, 80,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 81, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 82,
+  83, 84, 85, 86, 1, 1, 87, 88, 29, 29, 89, 1, 1, 1, 1, 1,
+  1, 90, 91, 1, 1, 1, 1, 1, 1, 92, 1, 1, 93, 94, 95, 1,
+  96, 97, 98, 29, 29, 29, 99, 100, 101, 29, 102, 103,
+};
+
+alignas(64) inline constexpr uint64_t punct_words[416] = {
+    0xfc00fffe00000000, 0x78000001f8000001, 0x89d3dbfe00000000, 0x0080000000800000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xffffafe0fffc003c,
+    0x0000000000000000, 0x4020000000000000, 0x00000000000000b0, 0x0040000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000004, 0x0000000000000000,
+    0x0000000000000000, 0x00000000fc000000, 0x400000000000e600, 0x0018000000000049,
+    0x00000000e800ffc0, 0x00003c0000000000, 0x0000000000000000, 0x6000020040100000,
+    0x0000000000003fff, 0x0000000000000000, 0x0000000000000000, 0xc3c0000000000000,
+    0x7fff000000000000, 0x0000000040000000, 0x0000000000000100, 0x0000000000000000,
+    0x0000000000000000, 0x0001003000000000, 0x0000000000000000, 0x2c0c000000000000,
+    0x0000000000000000, 0x0040000000000000, 0x0000000000000000, 0x0003000000000000,
+    0x0000000000000000, 0x0001000000000000, 0x0000000000000000, 0x07f8000000000000,
+    0x0000000000000000, 0x8080000000000000, 0x0000000000000010, 0x0000000000000000,
+    0x0000000000000000, 0x0200000000008000, 0x0000000000000000, 0x0010000000000000,
+    0x8000000000000000, 0x000000000c008000, 0x0000000000000000, 0x0000000000000000,
+    0x3d500000fcfffffe, 0x0000000000000000, 0xc000000000000020, 0x0000000007ffdfbf,
+    0x0000000000000000, 0x000000000000fc00, 0x00000000c0000000, 0x0800000000000000,
+    0x0000000000000000, 0x000001ff00000000, 0x0000000003ff0000, 0x0000000000000000,
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000600000000000, 0x0000000018000000, 0x0000380000000000,
+    0x0060000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000000f700000,
+    0x00000000000007ff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000031, 0x0000000000000000, 0xffffffffc0000000,
+    0x00000000c0000000, 0x0000000000000000, 0x00003f7f00000000, 0x0000000000000000,
+    0x0000000000000000, 0x7ff007fffc000000, 0x0000000000000000, 0xf000000000000000,
+    0xf800000000000000, 0xc000000000000000, 0x0000000000000000, 0x00000000000800ff,
+    0x0000000000000000, 0x0000000000000000, 0xa000000000000000, 0x6000e000e000e003,
+    0xffff00ffffff0000, 0x7c0000007fffffff, 0xffffffff00007c00, 0x0000000000000001,
+    0x0c0042afc1d0037b, 0x000000000000bc1f, 0xffffffffffff0c00, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0x0000007fffffffff, 0x00000000000007ff, 0xfffffffff0000000, 0x000003ffffffffff,
+    0xffffffffffffffff, 0x003fffffffffffff, 0xfffffffffff00000, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffcfffffffffffff, 0xffffffffffbfffff, 0xffffffffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xde0007e000000000,
+    0x0000000000000000, 0x0001000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffff7fffffffffff, 0x000000003fffffff, 0xfffffffffbffffff, 0x000fffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffff0000003fffff,
+    0xe0c10001ffffff1e, 0x0000000000000000, 0x0000000118000000, 0x0800000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00000000ffc30000, 0x0000800fffffffff,
+    0xfffffc007fffffff, 0xffffffff000100ff, 0x0001fffffffffc00, 0xffffffffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xffffffffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0xffffffffffff0000, 0xc00000000000007f,
+    0x000000000000e000, 0x4008000000000000, 0x0000000000000000, 0x00fc000000000000,
+    0x00000003007fffff, 0x0000000000000000, 0x0000000000000600, 0x0000000000000000,
+    0x03c00f0000000000, 0x00f0000000000000, 0x0000000000000000, 0x170000000000c000,
+    0x0000c00000000000, 0x0000000080000000, 0x0000000000000000, 0x00000000c0003ffe,
+    0x0000000000000000, 0x03800000f0000000, 0x0000000000000000, 0x00030000c0000000,
+    0x0000000000000000, 0x00000c0008000000, 0x0000000000000000, 0x0000080000000000,
+    0x0000020000000000, 0x0000000000000000, 0xfffc000000000000, 0x0000000000000007,
+    0xc000000000000000, 0x000000000000ffff, 0x0000000000000000, 0xf000000000008000,
+    0xffff000003ff0000, 0x00000f7ffff7ffff, 0x0000000000000000, 0x0000000000000000,
+    0xf8000001fc00fffe, 0x0000003ff8000001, 0x0000000000000000, 0x30007f7f00000000,
+    0xff80000000000007, 0xfe00000000000000, 0x000000011fff73ff, 0x1fffffffffff0000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000080000000, 0x0000000000010000,
+    0x0000000000000000, 0x0000800000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0180000000800000, 0x0000000000000000, 0x0000000000000000,
+    0x8000000080000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x8000000001ff0000, 0x0000000000000000, 0x007f000000000100,
+    0xfe00000000000000, 0x0000000000000000, 0x000000001e000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000200000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000003e00000, 0x00000000000003c0, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000003f80, 0xd800000000000000, 0x0000000000000003,
+    0x0000000000000000, 0x003000000000000f, 0x0000000000000000, 0x00000000e80021e0,
+    0x3f00000000000000, 0x0000000000000000, 0x0000020000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000000002c00f800, 0x0000000000000000, 0x0000000000000040,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000fffffe,
+    0x0000000000000000, 0x00001fff0000000e, 0x0200000000000000, 0x0000000000000000,
+    0xf000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0800000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000070, 0x0000000000000000, 0x0000000400000000,
+    0x8000000000000000, 0x000000000000007f, 0x00000007dc000000, 0x0000000000000000,
+    0x00000000000003ff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000300000000003e, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0180000000000000,
+    0x0000000000000000, 0x000000000000fff8, 0x0000000000000000, 0x8003ffffffe00000,
+    0x0000000000000000, 0x001f000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0006000000000000,
+    0x0000000000000000, 0x0000c00000000000, 0x0000000000000000, 0x0020000000000000,
+    0xff80000000000000, 0x0000000000000030, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000007800000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000400000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000090000000, 0x0000000000000000,
+    0x0000000000000000, 0xffffffffffff0000, 0xffffffffffffffff, 0x000000000000000f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x003fffffffffffff,
+    0xfffffe7fffffffff, 0x00001c1fffffffff, 0xffffc3fffffff018, 0x000007ffffffffff,
+    0xffffffffffffffff, 0x0000000000000023, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000000007fffff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0800000008000002,
+    0x0020000000200000, 0x0000800000008000, 0x0000020000000200, 0x0000000000000008,
+    0x0780000000000000, 0xffdfe00000000000, 0x0000000000000fef, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000008000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x8000000000000000,
+    0x0000000000000000, 0x00000000c0000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0001100000000000, 0x0000000000000000,
+    0x0000400000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0003000000000000,
+    0xffff0fffffffffff, 0xffffffffffffffff, 0xfffe7fff000fffff, 0x003ffffffffefffe,
+    0xffffffffffffe000, 0xffffffffffffffff, 0x00003fffffffffff, 0xffffffc000000000,
+    0x0fffffffffff0007, 0x0000003f000301ff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x1fff1ffff0ffffff,
+    0xffffffffffffffff, 0xf87fffffffffffff, 0xffffffffffffffff, 0x00010fff03ffffff,
+    0xffffffffffff0fff, 0xffffffff03ff00ff, 0x00033fffffff00ff, 0x0000000000000000,
+    0xffffffffffffffff, 0x1fff3fff000fffff, 0xbfffffffffff01ff, 0x01ff01ff0fffc03f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffff7ffff, 0x00000000000007ff,
+};
+
+alignas(64) inline constexpr uint8_t graph_level1[4352] = {
+  0, 1, 1, 2, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+  14, 1, 15, 16, 1, 1, 17, 18, 19, 20, 21, 22, 23, 1, 1, 24,
+  25, 26, 1, 1, 27, 1, 1, 1, 1, 1, 1, 28, 29, 30, 31, 32,
+  33, 34, 35, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 36, 1, 37, 38, 39, 40, 41, 42, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 45, 46, 1, 47, 48, 49,
+  50, 51, 52, 53, 54, 55, 1, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  1, 1, 1, 81, 82, 83, 44, 44, 44, 44, 44, 44, 44, 44, 44, 84,
+  1, 1, 1, 1, 85, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 1, 1, 86, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 1, 1, 87, 88, 44, 44, 89, 90,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 91, 1, 1, 1, 1, 92, 93, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 94,
+  1, 95, 96, 44, 44, 44, 44, 44, 44, 44, 44, 44, 97, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 98,
+  99, 100, 101, 102, 103, 104, 105, 106, 1, 1, 107, 44, 44, 44, 44, 108,
+  109, 110, 111, 44, 112, 44, 44, 113, 114, 115, 44, 44, 116, 117, 118, 44,
+  119, 120, 121, 1, 1, 1, 122, 123, 124, 1, 125, 126, 44, 44, 44, 44,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 127, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 128, 129, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 130, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 131, 1, 1, 132, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 1, 1, 133, 44, 44, 44, 44, 44,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 134, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 135, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 136, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 137,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 137,
+};
+
+alignas(64) inline constexpr uint64_t graph_words[552] = {
+    0xfffffffe00000000, 0x7fffffffffffffff, 0xffffdfff00000000, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xfcffffffffffffff, 0xfffffffbffffd7f0, 0xffffffffffffffff,
+    0xfffeffffffffffff, 0xfffffffffe7fffff, 0xfffffffffffee7ff, 0x001f87ffffff00ff,
+    0xffffffffefffffc0, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffdfffffff,
+    0xffffffffffff3fff, 0xffffffffffffe7ff, 0x0003ffffffffffff, 0xe7ffffffffffffff,
+    0x7fff3fffffffffff, 0xffff07ff4fffffff, 0xffffffffff007fff, 0xfffffffbffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xf3c5fdfffff99fef, 0x7fffffcfb080799f,
+    0xd36dfdfffff987ee, 0x007fffc05e023987, 0xf3edfdfffffbbfee, 0xfe03ffcf00013bbf,
+    0xf3edfdfffff99fee, 0x00ffffcfb0e0399f, 0xc3ffc718d63dc7ec, 0x07ffffc000813dc7,
+    0xf3fffdfffffddfff, 0xff80ffcf27603ddf, 0xf3effdfffffddfff, 0x000effcf60603ddf,
+    0xfffffffffffddfff, 0xffffffcffff0fddf, 0x2ffbfffffc7fffee, 0x001cffc0ff5f847f,
+    0x87fffffffffffffe, 0x000000000fffffff, 0x3fffffaffffff7d6, 0x00000000f3ff7f5f,
+    0xffffffffffffffff, 0xfffe1ffffffffeff, 0xdffffffffeffffff, 0x0000000007ffdfff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffff20bf,
+    0xffffffffffffffff, 0xffffffff3d7f3dff, 0x7f3dffffffff3dff, 0xffffffffff7fff3d,
+    0xffffffffff3dffff, 0x1fffffffe7ffffff, 0xffffffff03ffffff, 0x3f3fffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffff1ffffffe, 0x01ffffffffffffff,
+    0x007fffff803fffff, 0x000ddfff000fffff, 0xffffffffffffffff, 0x03ff03ff3fffffff,
+    0xffffffff03ffbfff, 0x01ffffffffffffff, 0xffff07ffffffffff, 0x003fffffffffffff,
+    0x0fff0fff7fffffff, 0x001f3ffffffffff1, 0xffff0fffffffffff, 0xffffffffc7ff03ff,
+    0xffffffffcfffffff, 0x9fffffff7fffffff, 0xffff3fff03ff03ff, 0x0000000000007fff,
+    0xffffffffffffffff, 0x7fffffffffff1fff, 0xffffffffffffffff, 0xf00fffffffffffff,
+    0xf8ffffffffffffff, 0xffffffffffffe3ff, 0xe7ffffffffff01ff, 0x07ffffffffff00ff,
+    0xffffffff3f3fffff, 0x3fffffffaaff3f3f, 0xffdfffffffffffff, 0x7fdcffffefcfffdf,
+    0xffff80ffffff0080, 0xfff300007fffffff, 0xffffffff1fff7fff, 0x0001ffffffff0001,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffff0fff, 0xffffffffffffffff,
+    0x0000007fffffffff, 0xffffffff000007ff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffcfffffffffffff, 0xffffffffffbfffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfe0fffffffffffff,
+    0xffff20bfffffffff, 0x800180ffffffffff, 0x7f7f7f7f007fffff, 0xffffffff7f7f7f7f,
+    0xffffffffffffffff, 0x000000003fffffff, 0xfffffffffbffffff, 0x000fffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffff0000003fffff,
+    0xfffffffffffffffe, 0xfffffffffffffffe, 0xfffffffffe7fffff, 0xffffffffffffffff,
+    0xfffeffffffffffe0, 0xffffffffffffffff, 0xffffffffffff7fff, 0xffff800fffffffff,
+    0xffffffff7fffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffff1fff, 0xffffffffffff007f,
+    0x00000fffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00ffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffc000003eb07ff,
+    0x03ff1fffffffffff, 0x00ffffffffffffff, 0xffffffffffffffff, 0xffffffff03ffc03f,
+    0xffffffffffffffff, 0x1fffffff800fffff, 0xffffffffffffffff, 0x7fffffffc3ffbfff,
+    0x007fffffffffffff, 0xfffffffff3ff3fff, 0xffffffffffffffff, 0x007ffffff8000007,
+    0xffff7f7f007e7e7e, 0xffff0fffffffffff, 0xffffffffffffffff, 0x03ff3fffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff000fffffffff, 0x0ffffffffffff87f,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffff3fffffffffff, 0xffffffffffffffff, 0x0000000003ffffff,
+    0x5f7fffffe0f8007f, 0xffffffffffffffdb, 0xffffffffffffffff, 0xfffffffffff80007,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffffcffff, 0xffff0000000080ff,
+    0xffffffff03ffffff, 0xffdf0f7ffff7ffff, 0xffffffffffffffff, 0x1fffffffffffffff,
+    0xfffffffffffffffe, 0xffffffffffffffff, 0x7fffffffffffffff, 0x30007f7f1cfcfcfc,
+    0xb7ffff7fffffefff, 0x000000003fff3fff, 0xffffffffffffffff, 0x07ffffffffffffff,
+    0xff8fffffffffff87, 0xffffffffffffffff, 0x000000011fff7fff, 0x3fffffffffff0000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffff1fffffff, 0x0fffffff0001ffff,
+    0xffffe00fffffffff, 0x07ffffffffff07ff, 0xffffffffbfffffff, 0x00000000003fff0f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff03ff3fffffff, 0x0fffffffff0fffff,
+    0xffff00ffffffffff, 0xf7ff800fffffffff, 0x1bfbfffbffb7f7ff, 0x0000000000000000,
+    0x007fffffffffffff, 0x000000ff003fffff, 0x07fdffffffffffbf, 0x0000000000000000,
+    0x91bffffffffffd3f, 0xffffffffffbfffff, 0x0000ff807fffffff, 0xf837ffff00000000,
+    0x83ffffff8fffffff, 0x0000000000000000, 0xf0ffffffffffffff, 0xfffffffffffcffff,
+    0x873ffffffeeff06f, 0xffffffff01ff01ff, 0x00000000ffffffff, 0x007ff87fffffffff,
+    0xfe3fffffffffffff, 0xff07ffffff3fffff, 0x0000fe001e03ffff, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000000000001ff, 0x0007ffffffffffff, 0xfc07ffffffffffff,
+    0x03ff00ffffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x7fffffff00000000, 0x00033bffffffffff, 0xe000000000000000,
+    0xffff00ffffffffff, 0xffff000003ffffff, 0xffff0000000003ff, 0x007fffff00000fff,
+    0xffffffffffffffff, 0x803ffffffffc3fff, 0xdfffffffffffffff, 0x03ff01ffffff0007,
+    0xffdfffffffffffff, 0x007fffffffff00ff, 0xffffffffffffffff, 0x001ffffeffffffff,
+    0xfffffffffffbffff, 0x0000000000000003, 0xffff03ffbfffbd7f, 0x03ff07ffffffffff,
+    0xfbedfdfffff99fef, 0x001f1fcfe081399f, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000003efffffff, 0xffffffffffffffff, 0x0000000003ff00ff,
+    0x0000000000000000, 0x0000000000000000, 0xff3fffffffffffff, 0x000000003fffffff,
+    0xffffffffffffffff, 0x00001fff03ff001f, 0x03ffffffffffffff, 0x00000000000003ff,
+    0xffff0fffe7ffffff, 0x000000000000007f, 0x0000000000000000, 0x0000000000000000,
+    0x0fffffffffffffff, 0x0000000000000000, 0xffffffff00000000, 0x8007ffffffffffff,
+    0xf9bfffffff6ff27f, 0x0000000003ff007f, 0xfffffcff00000000, 0x0000001ffcffffff,
+    0xffffffffffffffff, 0xffffffffffff00ff, 0xffff0007ffffffff, 0x01ffffffffffffff,
+    0x00000000000003ff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xff7ffffffffffdff, 0xffff1fffffff003f, 0x007ffefffffcffff, 0x0000000000000000,
+    0xb47ffffffffffb7f, 0xfffffdbf03ff00ff, 0x000003ff01fb7fff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x01ffffff00000000,
+    0xc7fffffffffdffff, 0x0000000003ffffff, 0x0001000000000000, 0x8003ffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000000003ffffff, 0x0000000000000000,
+    0xffffffffffffffff, 0x001f7fffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0x000000000000000f, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffffffff0000, 0x0007ffffffffffff,
+    0x0000ffffffffffff, 0x00000000003fffff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x000000000000007f, 0x0000000000000000, 0x0000000000000000,
+    0x01ffffffffffffff, 0xffffc3ff7fffffff, 0x7fffffffffffffff, 0x003f3fffffff03ff,
+    0xffffffffffffffff, 0xe0fffffbfbff003f, 0x000000000000ffff, 0x0000000000000000,
+    0x0000000000000000, 0xffffffffffffffff, 0x0000000007ffffff, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffff87ff, 0x00000000ffff80ff, 0x0003001f00000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00ffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000003fffff,
+    0x00000000000001ff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x6fef000000000000,
+    0x00040007ffffffff, 0xffff00f000270000, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0fffffffffffffff,
+    0xffffffffffffffff, 0x1fff07ffffffffff, 0x00000000f3ff01ff, 0x0000000000000000,
+    0xffff3fffffffffff, 0xffffffffffff007f, 0xffffffffffffffff, 0x000000000000000f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x003fffffffffffff,
+    0xfffffe7fffffffff, 0xf807ffffffffffff, 0xffffffffffffffff, 0x000007ffffffffff,
+    0xffffffffffffffff, 0x000000000000003f, 0x0000000000000000, 0x000fffff000fffff,
+    0xffffffffffffffff, 0x01ffffff007fffff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffdfffff, 0xebffde64dfffffff, 0xffffffffffffffef,
+    0x7bffffffdfdfe7bf, 0xfffffffffffdfc5f, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffff3fffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffcfff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000fffef8000fff, 0x0000000000000000,
+    0x000007e07fffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffff07dbf9ffff7f, 0x00003fffffffffff, 0x0000000000008000, 0x0000000000000000,
+    0x3fff1fffffffffff, 0x000000000000c3ff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00007fffffff0000, 0x83ffffffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x03ffffffffff0000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x7fff6f7f00000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000007fff9f,
+    0xffffffffffffffff, 0x00000000c3ff0fff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0xfffe000000000000, 0x001fffffffffffff, 0x0000000000000000,
+    0x3ffffffffffffffe, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0af7fe96ffffffef, 0x5ef7f796aa96ea84, 0x0ffffbee0ffffbff, 0x0003000000000000,
+    0xffff0fffffffffff, 0xffffffffffffffff, 0xfffe7fff000fffff, 0x003ffffffffefffe,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x00003fffffffffff, 0xffffffc000000000,
+    0x0fffffffffff0007, 0x0000003f000301ff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x1fff1ffff0ffffff,
+    0xffffffffffffffff, 0xf87fffffffffffff, 0xffffffffffffffff, 0x00010fff03ffffff,
+    0xffffffffffff0fff, 0xffffffff03ff00ff, 0x00033fffffff00ff, 0x0000000000000000,
+    0xffffffffffffffff, 0x1fff3fff000fffff, 0xbfffffffffff01ff, 0x01ff01ff0fffc03f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffff7ffff, 0x03ff0000000007ff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000ffffffff,
+    0x03ffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffff3fffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff0003ffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffff0001ffffffff,
+    0xffffffffffffffff, 0x000000003fffffff, 0x0000000000000000, 0x0000000000000000,
+    0x000000003fffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffff07ff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000ffffffffffff, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0000ffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x3fffffffffffffff,
+};
+
+alignas(64) inline constexpr uint8_t alnum_level1[804] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 1, 17, 18, 19, 1, 20, 21, 22, 23, 24, 25, 26, 27, 1, 28,
+  29, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 33, 34, 31,
+  35, 36, 31, 31, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 27, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 37, 1, 38, 39, 40, 41, 42, 43, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 44, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 1, 45, 46, 1, 47, 48, 49,
+  50, 51, 52, 53, 54, 55, 1, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 31, 76, 77, 78, 79,
+  1, 1, 1, 80, 81, 82, 31, 31, 31, 31, 31, 31, 31, 31, 31, 83,
+  1, 1, 1, 1, 84, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 1, 1, 85, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 86, 87, 31, 31, 88, 89,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 90, 1, 1, 1, 1, 91, 92, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 93,
+  1, 94, 95, 31, 31, 31, 31, 31, 31, 31, 31, 31, 96, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 97, 98, 99, 100, 31, 31, 31, 31, 31, 31, 31, 101,
+  102, 103, 104, 31, 105, 31, 31, 106, 107, 108, 31, 31, 31, 31, 109, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 110, 31, 31, 31, 31,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 111, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 112, 113, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 114, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 115, 1, 1, 116, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 1, 1, 117, 31, 31, 31, 31, 31,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 118, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 119,
+};
+
+alignas(64) inline constexpr uint64_t alnum_words[480] = {
+    0x03ff000000000000, 0x07fffffe07fffffe, 0x0420040000000000, 0xff7fffffff7fffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0000501f0003ffc3,
+    0x0000000000000000, 0xbcdf000000000000, 0xfffffffbffffd740, 0xffbfffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffffffc03, 0xffffffffffffffff,
+    0xfffeffffffffffff, 0xffffffff027fffff, 0x00000000000001ff, 0x000787ffffff0000,
+    0xffffffff00000000, 0xfffec3ff000007ff, 0xffffffffffffffff, 0x9fffc060002fffff,
+    0x0000fffffffd0000, 0xffffffffffffe000, 0x0002003fffffffff, 0x043007ffffffffff,
+    0x00000110043fffff, 0xffff07ff01ffffff, 0xffffffff00007eff, 0x00000000000003ff,
+    0x23fffffffffffff0, 0xfffeffc3ff010000, 0x23c5fdfffff99fe1, 0x1003ffc3b0004000,
+    0x036dfdfffff987e0, 0x001cffc05e000000, 0x23edfdfffffbbfe0, 0x0200ffc300010000,
+    0x23edfdfffff99fe0, 0x0002ffc3b0000000, 0x03ffc718d63dc7e8, 0x0000ffc000010000,
+    0x23fffdfffffddfe0, 0x0000ffc327000000, 0x23effdfffffddfe1, 0x0006ffc360000000,
+    0x27fffffffffddff0, 0xfc00ffc380704000, 0x2ffbfffffc7fffe0, 0x0000ffc00000007f,
+    0x000dfffffffffffe, 0x0000000003ff007f, 0x200dffaffffff7d6, 0x00000000f3ff005f,
+    0x000003ff00000001, 0x00001ffffffffeff, 0x0000000000001f00, 0x0000000000000000,
+    0x800007ffffffffff, 0xffe1c0623c3f03ff, 0xffffffff03ff4003, 0xf7ffffffffff20bf,
+    0xffffffffffffffff, 0xffffffff3d7f3dff, 0x7f3dffffffff3dff, 0xffffffffff7fff3d,
+    0xffffffffff3dffff, 0x0000000007ffffff, 0xffffffff0000ffff, 0x3f3fffffffffffff,
+    0xfffffffffffffffe, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffff9fffffffffff, 0xffffffff07fffffe, 0x01ffc7ffffffffff,
+    0x0003ffff8003ffff, 0x0001dfff0003ffff, 0x000fffffffffffff, 0x000003ff10800000,
+    0xffffffff03ff0000, 0x01ffffffffffffff, 0xffff05ffffffff9f, 0x003fffffffffffff,
+    0x000000007fffffff, 0x001f3fffffffffc0, 0xffff0fffffffffff, 0x0000000003ff03ff,
+    0xffffffff007fffff, 0x00000000001fffff, 0x0000008003ff03ff, 0x0000000000000000,
+    0x000fffffffffffe0, 0x0000000003ff1fe0, 0xffffc001fffffff8, 0x0000003fffffffff,
+    0x0000000fffffffff, 0x3fffffffffffe3ff, 0xe7ffffffffff01ff, 0x046fde0000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0000000000000000,
+    0xffffffff3f3fffff, 0x3fffffffaaff3f3f, 0x5fdfffffffffffff, 0x1fdc1fff0fcf1fdc,
+    0x0000000000000000, 0x8002000000000000, 0x000000001fff0000, 0x0000000000000000,
+    0xf3ffbd503e2ffc84, 0xffffffff000043e0, 0x00000000000001ff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x000c781fffffffff,
+    0xffff20bfffffffff, 0x000080ffffffffff, 0x7f7f7f7f007fffff, 0x000000007f7f7f7f,
+    0x0000800000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x1f3e03fe000000e0, 0xfffffffffffffffe, 0xfffffffee07fffff, 0xf7ffffffffffffff,
+    0xfffeffffffffffe0, 0xffffffffffffffff, 0xffffffff00007fff, 0xffff000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000000000001fff, 0x3fffffffffff0000,
+    0x00000fffffff1fff, 0x80007fffffffffff, 0xffffffff3fffffff, 0x0000ffffffffffff,
+    0xfffffffcff800000, 0xffffffffffffffff, 0xfffffffffffff9ff, 0xfffc000003eb07ff,
+    0x00000007fffff7bb, 0x000fffffffffffff, 0x000ffffffffffffc, 0x68fc000003ff0000,
+    0xffff003fffffffff, 0x1fffffff0000007f, 0x0007fffffffffff0, 0x7fffffdf03ff8000,
+    0x000001ffffffffff, 0xc47fffff03ff0ff7, 0x3e62ffffffffffff, 0x001c07ff38000005,
+    0xffff7f7f007e7e7e, 0xffff03fff7ffffff, 0xffffffffffffffff, 0x03ff0007ffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff000fffffffff, 0x0ffffffffffff87f,
+    0xffffffffffffffff, 0xffff3fffffffffff, 0xffffffffffffffff, 0x0000000003ffffff,
+    0x5f7ffdffa0f8007f, 0xffffffffffffffdb, 0x0003ffffffffffff, 0xfffffffffff80000,
+    0x3fffffffffffffff, 0xffffffffffff0000, 0xfffffffffffcffff, 0x0fff0000000000ff,
+    0x0000000000000000, 0xffdf000000000000, 0xffffffffffffffff, 0x1fffffffffffffff,
+    0x07fffffe03ff0000, 0xffffffc007fffffe, 0x7fffffffffffffff, 0x000000001cfcfcfc,
+    0xb7ffff7fffffefff, 0x000000003fff3fff, 0xffffffffffffffff, 0x07ffffffffffffff,
+    0x0000000000000000, 0x001fffffffffffff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffff1fffffff, 0x000000000001ffff,
+    0xffffe000ffffffff, 0x003fffffffff07ff, 0xffffffff3fffffff, 0x00000000003eff0f,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff03ff3fffffff, 0x0fffffffff0fffff,
+    0xffff00ffffffffff, 0xf7ff000fffffffff, 0x1bfbfffbffb7f7ff, 0x0000000000000000,
+    0x007fffffffffffff, 0x000000ff003fffff, 0x07fdffffffffffbf, 0x0000000000000000,
+    0x91bffffffffffd3f, 0x007fffff003fffff, 0x000000007fffffff, 0x0037ffff00000000,
+    0x03ffffff003fffff, 0x0000000000000000, 0xc0ffffffffffffff, 0x0000000000000000,
+    0x003ffffffeef0001, 0x1fffffff00000000, 0x000000001fffffff, 0x0000001ffffffeff,
+    0x003fffffffffffff, 0x0007ffff003fffff, 0x000000000003ffff, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000000000001ff, 0x0007ffffffffffff, 0x0007ffffffffffff,
+    0x03ff000fffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000303ffffffffff, 0x0000000000000000,
+    0xffff00801fffffff, 0xffff00000000003f, 0xffff000000000003, 0x007fffff0000001f,
+    0x00fffffffffffff8, 0x0026ffc000000000, 0x0000fffffffffff8, 0x03ff01ffffff0000,
+    0xffc0007ffffffff8, 0x0047ffffffff0090, 0x0007fffffffffff8, 0x0000000017ff001e,
+    0x80000ffffffbffff, 0x0000000000000001, 0xffff01ffbfffbd7f, 0x03ff00007fffffff,
+    0x23edfdfffff99fe0, 0x00000003e0010000, 0x0000000000000000, 0x0000000000000000,
+    0x001fffffffffffff, 0x0000000383ff0780, 0x0000ffffffffffff, 0x0000000003ff00b0,
+    0x0000000000000000, 0x0000000000000000, 0x00007fffffffffff, 0x000000000f000000,
+    0x0000ffffffffffff, 0x0000000003ff0010, 0x010007ffffffffff, 0x00000000000003ff,
+    0x03ff000007ffffff, 0x000000000000007f, 0x0000000000000000, 0x0000000000000000,
+    0x00000fffffffffff, 0x0000000000000000, 0xffffffff00000000, 0x800003ffffffffff,
+    0x8000ffffff6ff27f, 0x0000000003ff0002, 0xfffffcff00000000, 0x0000000a0001ffff,
+    0x0407fffffffff801, 0xfffffffff0010000, 0xffff0000200003ff, 0x01ffffffffffffff,
+    0x00007ffffffffdff, 0xfffc000003ff0001, 0x000000000000ffff, 0x0000000000000000,
+    0x0001fffffffffb7f, 0xfffffdbf03ff0040, 0x000003ff010003ff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0007ffff00000000,
+    0x000ffffffffdfff4, 0x0000000003ff0000, 0x0001000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000000003ffffff, 0x0000000000000000,
+    0xffffffffffffffff, 0x00007fffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0x000000000000000f, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0xffffffffffff0000, 0x0001ffffffffffff,
+    0x0000ffffffffffff, 0x000000000000007e, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x000000000000007f, 0x0000000000000000, 0x0000000000000000,
+    0x01ffffffffffffff, 0xffff03ff7fffffff, 0x7fffffffffffffff, 0x00003fffffff03ff,
+    0x0000ffffffffffff, 0xe0fffff803ff000f, 0x000000000000ffff, 0x0000000000000000,
+    0x0000000000000000, 0xffffffffffffffff, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0x00000000000107ff, 0x00000000fff80000, 0x0000000b00000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00ffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000003fffff,
+    0x00000000000001ff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x6fef000000000000,
+    0x00040007ffffffff, 0xffff00f000270000, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0fffffffffffffff,
+    0xffffffffffffffff, 0x1fff07ffffffffff, 0x0000000003ff01ff, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffdfffff, 0xebffde64dfffffff, 0xffffffffffffffef,
+    0x7bffffffdfdfe7bf, 0xfffffffffffdfc5f, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffff3fffffffff, 0xf7fffffff7fffffd,
+    0xffdfffffffdfffff, 0xffff7fffffff7fff, 0xfffffdfffffffdff, 0xffffffffffffcff7,
+    0x000007e07fffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffff000000000000, 0x00003fffffffffff, 0x0000000000000000, 0x0000000000000000,
+    0x3f801fffffffffff, 0x00000000000043ff, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00003fffffff0000, 0x03ff0fffffffffff,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x03ff0fffffff0000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x7fff6f7f00000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x000000000000001f,
+    0xffffffffffffffff, 0x0000000003ff080f, 0x0000000000000000, 0x0000000000000000,
+    0x0af7fe96ffffffef, 0x5ef7f796aa96ea84, 0x0ffffbee0ffffbff, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x03ff000000000000,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x00000000ffffffff,
+    0x03ffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffff3fffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffff0003ffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffff0001ffffffff,
+    0xffffffffffffffff, 0x000000003fffffff, 0x0000000000000000, 0x0000000000000000,
+    0x000000003fffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xffffffffffffffff, 0xffffffffffff07ff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x0000ffffffffffff, 0x0000000000000000,
+};
+
+alignas(64) inline constexpr uint8_t digit_level1[1] = {
+  0,
+};
+
+alignas(64) inline constexpr uint64_t digit_words[8] = {
+    0x03ff000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+alignas(64) inline constexpr uint8_t xdigit_level1[1] = {
+  0,
+};
+
+alignas(64) inline constexpr uint64_t xdigit_words[8] = {
+    0x03ff000000000000, 0x0000007e0000007e, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+// Indexed by the bit number of the PropertyBits flag
+inline constexpr Plane planes[12] = {
+    {upper_level1, upper_words, 490 << 8},
+    {lower_level1, lower_words, 490 << 8},
+    {alpha_level1, alpha_words, 804 << 8},
+    {space_level1, space_words, 49 << 8},
+    {print_level1, print_words, 4352 << 8},
+    {blank_level1, blank_words, 49 << 8},
+    {cntrl_level1, cntrl_words, 1 << 8},
+    {punct_level1, punct_words, 508 << 8},
+    {graph_level1, graph_words, 4352 << 8},
+    {alnum_level1, alnum_words, 804 << 8},
+    {digit_level1, digit_words, 1 << 8},
+    {xdigit_level1, xdigit_words, 1 << 8},
+};
+
+// Bits of the 64 codepoints from cp & ~63 on
+constexpr uint64_t word(const Plane &plane, uint32_t cp) {
+  return cp < plane.limit
+             ? plane.words[plane.level1[cp >> 8] * 4 + (cp >> 6 & 3)]
+             : 0;
+}
+
+constexpr bool test(const Plane &plane, uint32_t cp) {
+  return word(plane, cp) >> (cp & 63) & 1;
+}
+
+} // namespace wctype_bitplanes
+
+#endif // WCTYPE_BITPLANES_H
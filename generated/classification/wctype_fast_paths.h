@@ -0,0 +1,106 @@
+// Auto-generated by generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef WCTYPE_FAST_PATHS_H
+#define WCTYPE_FAST_PATHS_H
+
+#include "wctype_table.h"
+
+// lookup_properties with a check for each of the block profile's hottest
+// ranges in front of the tables, hottest first
+namespace wctype_fast_paths {
+
+WCTYPE_INDEX_TABLE(fast_path_300)
+inline constexpr uint16_t range_300[512] = {
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0314, 0x0190, 0x0315, 0x0316,
+  0x0000, 0x0000, 0x0314, 0x0316, 0x0316, 0x0316, 0x0190, 0x0315,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0190, 0x0190, 0x0315, 0x0190,
+  0x0315, 0x0315, 0x0315, 0x0000, 0x0315, 0x0000, 0x0315, 0x0315,
+  0x0316, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0000, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0315, 0x0315, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0315,
+  0x0316, 0x0316, 0x0315, 0x0315, 0x0315, 0x0316, 0x0316, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0315, 0x0316, 0x0190, 0x0315,
+  0x0316, 0x0315, 0x0315, 0x0316, 0x0316, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0190, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0110, 0x0110, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315,
+  0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+  0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316, 0x0315, 0x0316,
+};
+
+constexpr uint16_t lookup_properties(wint_t wc) {
+  // U+0000..U+00FF, 104 profiled hits
+  if (wc <= 0x00FF) {
+    return wctype_layout::entry(0)[wc];
+  }
+  // U+0300..U+04FF, 21 profiled hits
+  if (wc - 0x0300 <= 0x01FF) {
+    return range_300[wc - 0x0300];
+  }
+  // U+D800..U+DFFF, 4 profiled hits
+  if (wc - 0xD800 <= 0x07FF) {
+    return 0x0000;
+  }
+  return ::lookup_properties(wc);
+}
+
+// Whether lookup_properties answers wc without the tables
+constexpr bool covers(wint_t wc) {
+  return wc <= 0x00FF ||
+         wc - 0x0300 <= 0x01FF ||
+         wc - 0xD800 <= 0x07FF;
+}
+
+} // namespace wctype_fast_paths
+
+#endif // WCTYPE_FAST_PATHS_H
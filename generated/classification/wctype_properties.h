@@ -6,7 +6,8 @@
 
 #include <stdint.h>
 
-enum PropertyBits : uint8_t {
+// One bit per wctype class; GRAPH and up are derived from the others
+enum PropertyBits : uint16_t {
   PROP_UPPER = 1 << 0,
   PROP_LOWER = 1 << 1,
   PROP_ALPHA = 1 << 2,
@@ -15,6 +16,13 @@ enum PropertyBits : uint8_t {
   PROP_BLANK = 1 << 5,
   PROP_CNTRL = 1 << 6,
   PROP_PUNCT = 1 << 7,
+  PROP_GRAPH = 1 << 8,
+  PROP_ALNUM = 1 << 9,
+  PROP_DIGIT = 1 << 10,
+  PROP_XDIGIT = 1 << 11,
 };
 
+// All of the above
+inline constexpr uint16_t PROP_ALL = 0x0FFF;
+
 #endif // WCTYPE_PROPERTIES_H
@@ -8,31 +8,161 @@
 #include <stdint.h>
 #include <wctype.h>
 
-// Level 1 table: maps upper 8 bits to level2 offset
+// Every layout is always available under its own namespace;
+// WCTYPE_TABLE_LAYOUT picks the one behind lookup_properties
+#define WCTYPE_LAYOUT_TWO_LEVEL 1
+#define WCTYPE_LAYOUT_FLAT_BMP 2
+#define WCTYPE_LAYOUT_THREE_STAGE 3
+
+#ifndef WCTYPE_TABLE_LAYOUT
+#define WCTYPE_TABLE_LAYOUT WCTYPE_LAYOUT_TWO_LEVEL
+#endif
+
+// Tables live in read-only wctype_tables.* sections, index tables cache-line
+// aligned and property tables page aligned, so the hot blocks at the start
+// of level2 share as few lines and pages as possible. One section per table:
+// GCC would put inline variables sharing a section into one COMDAT group.
+#if defined(__GNUC__) && defined(__ELF__)
+#define WCTYPE_TABLE_SECTION(name)                                             \
+  __attribute__((section("wctype_tables." #name)))
+#else
+#define WCTYPE_TABLE_SECTION(name)
+#endif
+#define WCTYPE_INDEX_TABLE(name) alignas(64) WCTYPE_TABLE_SECTION(name)
+#define WCTYPE_DATA_TABLE(name) alignas(4096) WCTYPE_TABLE_SECTION(name)
+
+namespace wctype_two_level {
+
+// 256-codepoint blocks; level1 holds level2 offsets
+inline constexpr unsigned block_bits = 8;
+inline constexpr unsigned index_shift = 0;
+
+// Level 1 table: maps codepoint >> block_bits to level2 offset >> index_shift
+WCTYPE_INDEX_TABLE(two_level_level1)
 inline constexpr uint16_t level1[4352] = {
 #include "wctype_level1.inc"
 };
 
 // Level 2 table: property bitfields for each character
-inline constexpr uint8_t level2[37888] = {
+WCTYPE_DATA_TABLE(two_level_level2)
+inline constexpr uint16_t level2[31152] = {
 #include "wctype_level2.inc"
 };
 
-inline uint8_t lookup_properties(wint_t wc) {
+// First codepoint past the table
+inline constexpr uint32_t limit = 4352u << block_bits;
+
+// Property word of cp, for cp < limit
+constexpr const uint16_t *entry(uint32_t cp) {
+  return &level2[(level1[cp >> block_bits] << index_shift) +
+                 (cp & ((1u << block_bits) - 1))];
+}
+
+constexpr uint16_t lookup_properties(wint_t wc) {
   // Out of Unicode range
   if (wc > 0x10FFFF || (wc >= 0xD800 && wc <= 0xDFFF)) {
     return 0;
   }
 
-  unsigned l1_idx = wc >> 8;
+  unsigned l1_idx = wc >> block_bits;
   if (l1_idx >= 4352) {
     return 0;
   }
 
-  unsigned l2_offset = level1[l1_idx];
-  unsigned l2_idx = l2_offset + (wc & 0xFF);
+  unsigned l2_offset = level1[l1_idx] << index_shift;
+  unsigned l2_idx = l2_offset + (wc & ((1u << block_bits) - 1));
 
   return level2[l2_idx];
 }
 
+} // namespace wctype_two_level
+
+// BMP direct-mapped, no dependent level1 load; two-level for the rest
+namespace wctype_flat_bmp {
+
+WCTYPE_DATA_TABLE(flat_bmp_bmp)
+inline constexpr uint16_t bmp[0x10000] = {
+#include "wctype_flat_bmp.inc"
+};
+
+// Level 1 table: maps (codepoint >> 8) - 0x100 to level2 offset
+WCTYPE_INDEX_TABLE(flat_bmp_level1)
+inline constexpr uint16_t level1[4096] = {
+#include "wctype_flat_bmp_level1.inc"
+};
+
+// Level 2 table: property bitfields for the supplementary planes
+WCTYPE_DATA_TABLE(flat_bmp_level2)
+inline constexpr uint16_t level2[19687] = {
+#include "wctype_flat_bmp_level2.inc"
+};
+
+// First codepoint past the table
+inline constexpr uint32_t limit = 0x10000 + (4096 << 8);
+
+// Property word of cp, for cp < limit
+constexpr const uint16_t *entry(uint32_t cp) {
+  return cp < 0x10000 ? &bmp[cp]
+                      : &level2[level1[(cp >> 8) - 0x100] + (cp & 0xFF)];
+}
+
+// Surrogates are zero in the table
+constexpr uint16_t lookup_properties(wint_t wc) {
+  return wc < limit ? *entry(wc) : 0;
+}
+
+} // namespace wctype_flat_bmp
+
+// Smallest three-stage split the generator found: 13/5/3 bits
+namespace wctype_three_stage {
+
+inline constexpr unsigned mid_bits = 5;
+inline constexpr unsigned leaf_bits = 3;
+
+// Level 1 table: maps codepoint >> (mid_bits + leaf_bits) to a level2 block
+WCTYPE_INDEX_TABLE(three_stage_level1)
+inline constexpr uint8_t level1[4352] = {
+#include "wctype_three_stage_level1.inc"
+};
+
+// Level 2 table: maps the middle bits within a block to a level3 leaf
+WCTYPE_INDEX_TABLE(three_stage_level2)
+inline constexpr uint16_t level2[4736] = {
+#include "wctype_three_stage_level2.inc"
+};
+
+// Level 3 table: property bitfields, U+0000..U+00FF first and contiguous
+WCTYPE_DATA_TABLE(three_stage_level3)
+inline constexpr uint16_t level3[3864] = {
+#include "wctype_three_stage_level3.inc"
+};
+
+// First codepoint past the table
+inline constexpr uint32_t limit = 4352u << (mid_bits + leaf_bits);
+
+// Property word of cp, for cp < limit
+constexpr const uint16_t *entry(uint32_t cp) {
+  const unsigned block = level1[cp >> (mid_bits + leaf_bits)];
+  const unsigned mid = (cp >> leaf_bits) & ((1u << mid_bits) - 1);
+  const unsigned leaf = level2[block << mid_bits | mid];
+  return &level3[leaf << leaf_bits | (cp & ((1u << leaf_bits) - 1))];
+}
+
+// Surrogates are zero in the table
+constexpr uint16_t lookup_properties(wint_t wc) {
+  return wc < limit ? *entry(wc) : 0;
+}
+
+} // namespace wctype_three_stage
+
+#if WCTYPE_TABLE_LAYOUT == WCTYPE_LAYOUT_FLAT_BMP
+namespace wctype_layout = wctype_flat_bmp;
+#elif WCTYPE_TABLE_LAYOUT == WCTYPE_LAYOUT_THREE_STAGE
+namespace wctype_layout = wctype_three_stage;
+#else
+namespace wctype_layout = wctype_two_level;
+#endif
+
+using wctype_layout::lookup_properties;
+
 #endif // WCTYPE_TABLE_H
@@ -0,0 +1,2999 @@
+// Auto-generated by conversion_generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef CASE_MAPPING_HASH_H
+#define CASE_MAPPING_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Minimal perfect hashes of the case mappings: one slot per mapping, found
+// through its bucket's seed. A codepoint without a mapping lands on some
+// other codepoint's slot and maps to itself.
+struct CaseHashEntry {
+  uint32_t from;
+  uint32_t to;
+};
+
+constexpr uint32_t case_hash_scramble(uint32_t cp) { return cp * 0x9E3779B1u; }
+
+constexpr uint32_t case_hash_reduce(uint32_t h, size_t n) {
+  return static_cast<uint32_t>(static_cast<uint64_t>(h) * n >> 32);
+}
+
+inline constexpr uint16_t to_upper_hash_seeds[363] = {
+    5, 0, 1, 1, 25, 53, 0, 5, 69, 355, 16, 0,
+    14, 3, 0, 3, 13, 0, 5, 7, 74, 88, 0, 5,
+    3, 106, 3, 19, 3, 44, 50, 27, 10, 364, 12, 22,
+    63, 40, 22, 7, 0, 33, 3, 4, 17, 58, 411, 5,
+    20, 191, 1, 4, 18, 207, 1, 33, 9, 5, 479, 0,
+    12, 14, 18, 5, 285, 0, 165, 0, 0, 98, 13, 25,
+    12, 0, 95, 5, 189, 1, 3, 1, 15, 2, 193, 183,
+    0, 4, 131, 0, 0, 2, 5, 185, 2, 15, 271, 42,
+    546, 1, 5, 164, 0, 233, 35, 0, 1, 278, 1, 2,
+    1, 32, 1, 549, 4, 0, 1528, 119, 338, 6, 234, 52,
+    11, 8, 0, 9, 12, 9, 178, 65, 2, 0, 30, 26,
+    39, 14, 2, 318, 23, 0, 1, 142, 0, 18, 16, 3,
+    61, 0, 327, 163, 11, 7, 13, 360, 193, 6, 466, 589,
+    41, 92, 206, 15, 1, 183, 63, 5, 503, 0, 1, 2447,
+    0, 661, 1, 49, 165, 1, 3, 586, 1, 3, 10, 18,
+    355, 81, 51, 50, 30, 2, 905, 123, 333, 14, 0, 20,
+    94, 3, 1, 19, 0, 263, 1, 0, 812, 3, 168, 19,
+    116, 9, 9, 277, 119, 1487, 0, 107, 456, 0, 646, 1,
+    0, 8, 4, 6, 4, 388, 137, 0, 17, 282, 27, 16,
+    24, 688, 0, 105, 830, 44, 83, 4, 677, 32, 59, 26,
+    210, 47, 12, 27, 166, 157, 190, 197, 1, 36, 2992, 0,
+    21, 50, 63, 6, 29, 52, 11, 0, 5, 525, 7, 0,
+    48, 1, 890, 438, 251, 3, 32, 2, 0, 0, 2, 1251,
+    0, 5, 18, 204, 5, 4, 18, 0, 3510, 24, 621, 202,
+    42, 117, 9543, 0, 48, 626, 163, 729, 2, 7, 1060, 1,
+    302, 47, 521, 554, 259, 0, 1485, 186, 81, 91, 189, 12,
+    1547, 400, 89, 315, 12, 2361, 827, 56, 3, 8, 579, 5720,
+    1, 194, 158, 4, 324, 37, 22, 206, 742, 83, 26, 13977,
+    2, 33, 3192, 346, 2347, 6, 865, 167, 1, 0, 518, 2,
+    901, 49, 137, 130, 483, 72, 3, 23, 9409, 466, 0, 3374,
+    1654, 0, 976,
+};
+
+inline constexpr CaseHashEntry to_upper_hash_slots[1450] = {
+    {0x0105a8, 0x010581},
+    {0x00a69b, 0x00a69a},
+    {0x00ff55, 0x00ff35},
+    {0x001f26, 0x001f2e},
+    {0x001eab, 0x001eaa},
+    {0x001f20, 0x001f28},
+    {0x0010da, 0x001c9a},
+    {0x0003fb, 0x0003fa},
+    {0x002ccd, 0x002ccc},
+    {0x0013fa, 0x0013f2},
+    {0x000461, 0x000460},
+    {0x00a65f, 0x00a65e},
+    {0x016e63, 0x016e43},
+    {0x00a741, 0x00a740},
+    {0x001f60, 0x001f68},
+    {0x001ee5, 0x001ee4},
+    {0x000567, 0x000537},
+    {0x0105bc, 0x010595},
+    {0x00ff45, 0x00ff25},
+    {0x0003c5, 0x0003a5},
+    {0x000517, 0x000516},
+    {0x001f43, 0x001f4b},
+    {0x000074, 0x000054},
+    {0x010439, 0x010411},
+    {0x010436, 0x01040e},
+    {0x01e939, 0x01e917},
+    {0x001e81, 0x001e80},
+    {0x002cdd, 0x002cdc},
+    {0x001e29, 0x001e28},
+    {0x001f84, 0x001f8c},
+    {0x0003f5, 0x000395},
+    {0x000105, 0x000104},
+    {0x0118d7, 0x0118b7},
+    {0x0001dc, 0x0001db},
+    {0x0104eb, 0x0104c3},
+    {0x0118ca, 0x0118aa},
+    {0x001e6b, 0x001e6a},
+    {0x0003cd, 0x00038e},
+    {0x0001c8, 0x0001c7},
+    {0x001e65, 0x001e64},
+    {0x001d7d, 0x002c63},
+    {0x01e92a, 0x01e908},
+    {0x0001df, 0x0001de},
+    {0x002d00, 0x0010a0},
+    {0x000163, 0x000162},
+    {0x010cda, 0x010c9a},
+    {0x0004cc, 0x0004cb},
+    {0x00a73d, 0x00a73c},
+    {0x0003b4, 0x000394},
+    {0x00047f, 0x00047e},
+    {0x010cd4, 0x010c94},
+    {0x002cd7, 0x002cd6},
+    {0x00ab84, 0x0013b4},
+    {0x00a74f, 0x00a74e},
+    {0x001e8b, 0x001e8a},
+    {0x000373, 0x000372},
+    {0x002cbf, 0x002cbe},
+    {0x00011f, 0x00011e},
+    {0x0000ed, 0x0000cd},
+    {0x001eeb, 0x001eea},
+    {0x0004b9, 0x0004b8},
+    {0x00043e, 0x00041e},
+    {0x001ed7, 0x001ed6},
+    {0x001c86, 0x00042a},
+    {0x00a797, 0x00a796},
+    {0x000252, 0x002c70},
+    {0x0000e7, 0x0000c7},
+    {0x010cf2, 0x010cb2},
+    {0x000507, 0x000506},
+    {0x000066, 0x000046},
+    {0x016e67, 0x016e47},
+    {0x0004f3, 0x0004f2},
+    {0x000146, 0x000145},
+    {0x000227, 0x000226},
+    {0x0010d7, 0x001c97},
+    {0x010cd8, 0x010c98},
+    {0x001e1b, 0x001e1a},
+    {0x0104f4, 0x0104cc},
+    {0x00217f, 0x00216f},
+    {0x001d8e, 0x00a7c6},
+    {0x00019e, 0x000220},
+    {0x0118d1, 0x0118b1},
+    {0x0013fc, 0x0013f4},
+    {0x00043a, 0x00041a},
+    {0x00a7a5, 0x00a7a4},
+    {0x000261, 0x00a7ac},
+    {0x0003bc, 0x00039c},
+    {0x000266, 0x00a7aa},
+    {0x001ecb, 0x001eca},
+    {0x0001b9, 0x0001b8},
+    {0x002d12, 0x0010b2},
+    {0x000155, 0x000154},
+    {0x002171, 0x002161},
+    {0x002cec, 0x002ceb},
+    {0x001ea5, 0x001ea4},
+    {0x000256, 0x000189},
+    {0x002c3e, 0x002c0e},
+    {0x0010dc, 0x001c9c},
+    {0x0000f1, 0x0000d1},
+    {0x00a75d, 0x00a75c},
+    {0x00045b, 0x00040b},
+    {0x00217a, 0x00216a},
+    {0x001eff, 0x001efe},
+    {0x01e925, 0x01e903},
+    {0x000445, 0x000425},
+    {0x001e21, 0x001e20},
+    {0x00a643, 0x00a642},
+    {0x0004ab, 0x0004aa},
+    {0x002178, 0x002168},
+    {0x001ec9, 0x001ec8},
+    {0x00abb1, 0x0013e1},
+    {0x00aba3, 0x0013d3},
+    {0x00006f, 0x00004f},
+    {0x0000e4, 0x0000c4},
+    {0x00014f, 0x00014e},
+    {0x010ce5, 0x010ca5},
+    {0x0010e1, 0x001ca1},
+    {0x0118c5, 0x0118a5},
+    {0x001f15, 0x001f1d},
+    {0x010ccf, 0x010c8f},
+    {0x002c87, 0x002c86},
+    {0x002c3b, 0x002c0b},
+    {0x0003df, 0x0003de},
+    {0x016e7e, 0x016e5e},
+    {0x0104e7, 0x0104bf},
+    {0x0104e4, 0x0104bc},
+    {0x010cca, 0x010c8a},
+    {0x0104ea, 0x0104c2},
+    {0x00ff59, 0x00ff39},
+    {0x001fbe, 0x000399},
+    {0x00051f, 0x00051e},
+    {0x000165, 0x000164},
+    {0x000253, 0x000181},
+    {0x0003ae, 0x000389},
+    {0x00ab76, 0x0013a6},
+    {0x00048f, 0x00048e},
+    {0x001e75, 0x001e74},
+    {0x00056f, 0x00053f},
+    {0x002c6a, 0x002c69},
+    {0x002ce3, 0x002ce2},
+    {0x002c61, 0x002c60},
+    {0x001f11, 0x001f19},
+    {0x00a7d1, 0x00a7d0},
+    {0x001f23, 0x001f2b},
+    {0x00028c, 0x000245},
+    {0x0003e7, 0x0003e6},
+    {0x016e7a, 0x016e5a},
+    {0x000449, 0x000429},
+    {0x002d18, 0x0010b8},
+    {0x0104dd, 0x0104b5},
+    {0x00ab53, 0x00a7b3},
+    {0x000439, 0x000419},
+    {0x0003bd, 0x00039d},
+    {0x010cdf, 0x010c9f},
+    {0x002cc1, 0x002cc0},
+    {0x000076, 0x000056},
+    {0x0010f0, 0x001cb0},
+    {0x00a7f6, 0x00a7f5},
+    {0x00aba0, 0x0013d0},
+    {0x0010e9, 0x001ca9},
+    {0x010cc4, 0x010c84},
+    {0x010598, 0x010571},
+    {0x01042d, 0x010405},
+    {0x001f86, 0x001f8e},
+    {0x01e923, 0x01e901},
+    {0x000287, 0x00a7b1},
+    {0x00a7ca, 0x00a7c9},
+    {0x00045c, 0x00040c},
+    {0x001e41, 0x001e40},
+    {0x001f76, 0x001fda},
+    {0x002cb1, 0x002cb0},
+    {0x000447, 0x000427},
+    {0x0001f5, 0x0001f4},
+    {0x00017a, 0x000179},
+    {0x00ff4f, 0x00ff2f},
+    {0x000431, 0x000411},
+    {0x0118de, 0x0118be},
+    {0x000067, 0x000047},
+    {0x010444, 0x01041c},
+    {0x001f41, 0x001f49},
+    {0x001e3d, 0x001e3c},
+    {0x010430, 0x010408},
+    {0x001e37, 0x001e36},
+    {0x001fa2, 0x001faa},
+    {0x0001b4, 0x0001b3},
+    {0x002c43, 0x002c13},
+    {0x00a75f, 0x00a75e},
+    {0x0000eb, 0x0000cb},
+    {0x000219, 0x000218},
+    {0x001f01, 0x001f09},
+    {0x002c4b, 0x002c1b},
+    {0x000455, 0x000405},
+    {0x0003d9, 0x0003d8},
+    {0x002cab, 0x002caa},
+    {0x001f55, 0x001f5d},
+    {0x00a641, 0x00a640},
+    {0x000448, 0x000428},
+    {0x00ff52, 0x00ff32},
+    {0x0003b2, 0x000392},
+    {0x001ead, 0x001eac},
+    {0x00050b, 0x00050a},
+    {0x01059b, 0x010574},
+    {0x001fa3, 0x001fab},
+    {0x00029e, 0x00a7b0},
+    {0x00ff51, 0x00ff31},
+    {0x00ab94, 0x0013c4},
+    {0x0118d4, 0x0118b4},
+    {0x000511, 0x000510},
+    {0x0000ec, 0x0000cc},
+    {0x001e1d, 0x001e1c},
+    {0x00214e, 0x002132},
+    {0x001c85, 0x000422},
+    {0x001f74, 0x001fca},
+    {0x016e79, 0x016e59},
+    {0x001f62, 0x001f6a},
+    {0x0104de, 0x0104b6},
+    {0x0024e1, 0x0024c7},
+    {0x00a72d, 0x00a72c},
+    {0x000438, 0x000418},
+    {0x000437, 0x000417},
+    {0x002d09, 0x0010a9},
+    {0x001fa7, 0x001faf},
+    {0x0010fe, 0x001cbe},
+    {0x001ebd, 0x001ebc},
+    {0x010438, 0x010410},
+    {0x002173, 0x002163},
+    {0x002cee, 0x002ced},
+    {0x001f21, 0x001f29},
+    {0x001efd, 0x001efc},
+    {0x010cd7, 0x010c97},
+    {0x0105a4, 0x01057d},
+    {0x010cdb, 0x010c9b},
+    {0x001e6d, 0x001e6c},
+    {0x001e15, 0x001e14},
+    {0x0118c2, 0x0118a2},
+    {0x000125, 0x000124},
+    {0x000586, 0x000556},
+    {0x016e71, 0x016e51},
+    {0x0024de, 0x0024c4},
+    {0x00017e, 0x00017d},
+    {0x001edd, 0x001edc},
+    {0x002d13, 0x0010b3},
+    {0x01044b, 0x010423},
+    {0x00ab8f, 0x0013bf},
+    {0x002d02, 0x0010a2},
+    {0x0000e9, 0x0000c9},
+    {0x000161, 0x000160},
+    {0x002d21, 0x0010c1},
+    {0x000121, 0x000120},
+    {0x0118dd, 0x0118bd},
+    {0x0004eb, 0x0004ea},
+    {0x00057e, 0x00054e},
+    {0x00abbe, 0x0013ee},
+    {0x001e23, 0x001e22},
+    {0x002c5a, 0x002c2a},
+    {0x000225, 0x000224},
+    {0x0003ed, 0x0003ec},
+    {0x00a749, 0x00a748},
+    {0x002cbb, 0x002cba},
+    {0x00a653, 0x00a652},
+    {0x0003f3, 0x00037f},
+    {0x001ee9, 0x001ee8},
+    {0x0003c6, 0x0003a6},
+    {0x001ed9, 0x001ed8},
+    {0x0003b6, 0x000396},
+    {0x00abb0, 0x0013e0},
+    {0x000440, 0x000420},
+    {0x010ce0, 0x010ca0},
+    {0x00a783, 0x00a782},
+    {0x00023f, 0x002c7e},
+    {0x000068, 0x000048},
+    {0x002c34, 0x002c04},
+    {0x0004f5, 0x0004f4},
+    {0x002d1d, 0x0010bd},
+    {0x0024dc, 0x0024c2},
+    {0x00ab75, 0x0013a5},
+    {0x00a759, 0x00a758},
+    {0x0001cb, 0x0001ca},
+    {0x0003c9, 0x0003a9},
+    {0x000211, 0x000210},
+    {0x002d25, 0x0010c5},
+    {0x016e77, 0x016e57},
+    {0x0104df, 0x0104b7},
+    {0x00a64b, 0x00a64a},
+    {0x00a7a7, 0x00a7a6},
+    {0x00a72b, 0x00a72a},
+    {0x00016f, 0x00016e},
+    {0x000519, 0x000518},
+    {0x001e55, 0x001e54},
+    {0x000077, 0x000057},
+    {0x0001d2, 0x0001d1},
+    {0x002cf3, 0x002cf2},
+    {0x0003c7, 0x0003a7},
+    {0x00006d, 0x00004d},
+    {0x000509, 0x000508},
+    {0x001f03, 0x001f0b},
+    {0x001ee7, 0x001ee6},
+    {0x000471, 0x000470},
+    {0x0118c8, 0x0118a8},
+    {0x0001d6, 0x0001d5},
+    {0x002c4e, 0x002c1e},
+    {0x001f71, 0x001fbb},
+    {0x0104ed, 0x0104c5},
+    {0x002cb3, 0x002cb2},
+    {0x000115, 0x000114},
+    {0x00a79b, 0x00a79a},
+    {0x0004c8, 0x0004c7},
+    {0x00a729, 0x00a728},
+    {0x001c81, 0x000414},
+    {0x0000fd, 0x0000dd},
+    {0x0003b7, 0x000397},
+    {0x010447, 0x01041f},
+    {0x0105a3, 0x01057c},
+    {0x01e92f, 0x01e90d},
+    {0x001f25, 0x001f2d},
+    {0x00ab9c, 0x0013cc},
+    {0x0010e3, 0x001ca3},
+    {0x001e2b, 0x001e2a},
+    {0x0118cc, 0x0118ac},
+    {0x010cde, 0x010c9e},
+    {0x002c5b, 0x002c2b},
+    {0x0003f1, 0x0003a1},
+    {0x002174, 0x002164},
+    {0x0004d1, 0x0004d0},
+    {0x000280, 0x0001a6},
+    {0x000205, 0x000204},
+    {0x00026f, 0x00019c},
+    {0x002179, 0x002169},
+    {0x016e6a, 0x016e4a},
+    {0x00ff4e, 0x00ff2e},
+    {0x001e5f, 0x001e5e},
+    {0x0004a7, 0x0004a6},
+    {0x001ff3, 0x001ffc},
+    {0x0105ae, 0x010587},
+    {0x00a787, 0x00a786},
+    {0x0118d6, 0x0118b6},
+    {0x000069, 0x000049},
+    {0x01e934, 0x01e912},
+    {0x0104fa, 0x0104d2},
+    {0x010440, 0x010418},
+    {0x0010dd, 0x001c9d},
+    {0x0118df, 0x0118bf},
+    {0x010ccc, 0x010c8c},
+    {0x002c55, 0x002c25},
+    {0x001f78, 0x001ff8},
+    {0x0004d9, 0x0004d8},
+    {0x001e83, 0x001e82},
+    {0x0024d0, 0x0024b6},
+    {0x0024e6, 0x0024cc},
+    {0x00051b, 0x00051a},
+    {0x000183, 0x000182},
+    {0x0004b5, 0x0004b4},
+    {0x002c36, 0x002c06},
+    {0x00a745, 0x00a744},
+    {0x00abb8, 0x0013e8},
+    {0x00ff43, 0x00ff23},
+    {0x01044a, 0x010422},
+    {0x001e73, 0x001e72},
+    {0x001e7f, 0x001e7e},
+    {0x00a77c, 0x00a77b},
+    {0x001f22, 0x001f2a},
+    {0x001eb9, 0x001eb8},
+    {0x002cdf, 0x002cde},
+    {0x000473, 0x000472},
+    {0x01e924, 0x01e902},
+    {0x00a781, 0x00a780},
+    {0x001e8f, 0x001e8e},
+    {0x010cc3, 0x010c83},
+    {0x0104f0, 0x0104c8},
+    {0x0004af, 0x0004ae},
+    {0x000269, 0x000196},
+    {0x001f81, 0x001f89},
+    {0x000271, 0x002c6e},
+    {0x002d19, 0x0010b9},
+    {0x00a77f, 0x00a77e},
+    {0x0000b5, 0x00039c},
+    {0x00025c, 0x00a7ab},
+    {0x00abb3, 0x0013e3},
+    {0x010448, 0x010420},
+    {0x010cef, 0x010caf},
+    {0x000070, 0x000050},
+    {0x00ab9f, 0x0013cf},
+    {0x010ce7, 0x010ca7},
+    {0x0118c3, 0x0118a3},
+    {0x00ff4a, 0x00ff2a},
+    {0x000563, 0x000533},
+    {0x00ab86, 0x0013b6},
+    {0x002c5c, 0x002c2c},
+    {0x002c4d, 0x002c1d},
+    {0x00a739, 0x00a738},
+    {0x002c48, 0x002c18},
+    {0x000457, 0x000407},
+    {0x001ef1, 0x001ef0},
+    {0x001ee3, 0x001ee2},
+    {0x001fd0, 0x001fd8},
+    {0x0118cb, 0x0118ab},
+    {0x002c9b, 0x002c9a},
+    {0x001ecd, 0x001ecc},
+    {0x00a799, 0x00a798},
+    {0x0003cc, 0x00038c},
+    {0x0001da, 0x0001d9},
+    {0x002ccf, 0x002cce},
+    {0x001fa5, 0x001fad},
+    {0x00006a, 0x00004a},
+    {0x010cc0, 0x010c80},
+    {0x00ab96, 0x0013c6},
+    {0x001e33, 0x001e32},
+    {0x002c5e, 0x002c2e},
+    {0x000229, 0x000228},
+    {0x001f95, 0x001f9d},
+    {0x001f7a, 0x001fea},
+    {0x0104f6, 0x0104ce},
+    {0x0013f9, 0x0013f1},
+    {0x00049d, 0x00049c},
+    {0x00a743, 0x00a742},
+    {0x00006e, 0x00004e},
+    {0x0024e3, 0x0024c9},
+    {0x000268, 0x000197},
+    {0x002ca5, 0x002ca4},
+    {0x0004b1, 0x0004b0},
+    {0x002d0b, 0x0010ab},
+    {0x00abba, 0x0013ea},
+    {0x0105ab, 0x010584},
+    {0x000078, 0x000058},
+    {0x00aba6, 0x0013d6},
+    {0x01043a, 0x010412},
+    {0x0010ec, 0x001cac},
+    {0x0010de, 0x001c9e},
+    {0x00abb5, 0x0013e5},
+    {0x001e2d, 0x001e2c},
+    {0x010cd9, 0x010c99},
+    {0x01042b, 0x010403},
+    {0x00a695, 0x00a694},
+    {0x00a735, 0x00a734},
+    {0x000288, 0x0001ae},
+    {0x001ed3, 0x001ed2},
+    {0x0104ec, 0x0104c4},
+    {0x001e93, 0x001e92},
+    {0x0024e0, 0x0024c6},
+    {0x0105b4, 0x01058d},
+    {0x0104ee, 0x0104c6},
+    {0x0003be, 0x00039e},
+    {0x001f13, 0x001f1b},
+    {0x000167, 0x000166},
+    {0x010449, 0x010421},
+    {0x0004e7, 0x0004e6},
+    {0x01e927, 0x01e905},
+    {0x010442, 0x01041a},
+    {0x00010d, 0x00010c},
+    {0x0000ee, 0x0000ce},
+    {0x001f97, 0x001f9f},
+    {0x01e928, 0x01e906},
+    {0x001ea1, 0x001ea0},
+    {0x010cd3, 0x010c93},
+    {0x001e85, 0x001e84},
+    {0x0003f2, 0x0003f9},
+    {0x0000f5, 0x0000d5},
+    {0x000459, 0x000409},
+    {0x002c47, 0x002c17},
+    {0x0104e8, 0x0104c0},
+    {0x00052b, 0x00052a},
+    {0x00ff54, 0x00ff34},
+    {0x00023c, 0x00023b},
+    {0x00016d, 0x00016c},
+    {0x002c99, 0x002c98},
+    {0x0003c3, 0x0003a3},
+    {0x0118cd, 0x0118ad},
+    {0x0003b1, 0x000391},
+    {0x001ecf, 0x001ece},
+    {0x01059e, 0x010577},
+    {0x00057a, 0x00054a},
+    {0x0000e0, 0x0000c0},
+    {0x0010ee, 0x001cae},
+    {0x001f90, 0x001f98},
+    {0x00022b, 0x00022a},
+    {0x001f14, 0x001f1c},
+    {0x00ab81, 0x0013b1},
+    {0x002c57, 0x002c27},
+    {0x001e89, 0x001e88},
+    {0x001e79, 0x001e78},
+    {0x001f75, 0x001fcb},
+    {0x001f65, 0x001f6d},
+    {0x0104e1, 0x0104b9},
+    {0x0024e4, 0x0024ca},
+    {0x0118d9, 0x0118b9},
+    {0x0024d2, 0x0024b8},
+    {0x0003c0, 0x0003a0},
+    {0x001c84, 0x000422},
+    {0x002c91, 0x002c90},
+    {0x001e49, 0x001e48},
+    {0x00aba8, 0x0013d8},
+    {0x0001d4, 0x0001d3},
+    {0x010597, 0x010570},
+    {0x01e93c, 0x01e91a},
+    {0x000063, 0x000043},
+    {0x001ea9, 0x001ea8},
+    {0x001ea7, 0x001ea6},
+    {0x000565, 0x000535},
+    {0x0118c0, 0x0118a0},
+    {0x00ab7b, 0x0013ab},
+    {0x00ab7a, 0x0013aa},
+    {0x002d1c, 0x0010bc},
+    {0x00a683, 0x00a682},
+    {0x0003d6, 0x0003a0},
+    {0x001e03, 0x001e02},
+    {0x001e01, 0x001e00},
+    {0x0024df, 0x0024c5},
+    {0x000495, 0x000494},
+    {0x010cec, 0x010cac},
+    {0x000434, 0x000414},
+    {0x0003b9, 0x000399},
+    {0x002d04, 0x0010a4},
+    {0x0105a5, 0x01057e},
+    {0x002d16, 0x0010b6},
+    {0x00a697, 0x00a696},
+    {0x0118d5, 0x0118b5},
+    {0x010ce8, 0x010ca8},
+    {0x0010e5, 0x001ca5},
+    {0x000571, 0x000541},
+    {0x00aba2, 0x0013d2},
+    {0x00013c, 0x00013b},
+    {0x001f82, 0x001f8a},
+    {0x010cce, 0x010c8e},
+    {0x000475, 0x000474},
+    {0x000283, 0x0001a9},
+    {0x0105a0, 0x010579},
+    {0x0104f2, 0x0104ca},
+    {0x002c66, 0x00023e},
+    {0x0024da, 0x0024c0},
+    {0x001f57, 0x001f5f},
+    {0x0003c8, 0x0003a8},
+    {0x000523, 0x000522},
+    {0x002c97, 0x002c96},
+    {0x001ec7, 0x001ec6},
+    {0x001e4d, 0x001e4c},
+    {0x00050d, 0x00050c},
+    {0x00ff4d, 0x00ff2d},
+    {0x000574, 0x000544},
+    {0x0001c6, 0x0001c4},
+    {0x0004f7, 0x0004f6},
+    {0x00217e, 0x00216e},
+    {0x002c8d, 0x002c8c},
+    {0x000137, 0x000136},
+    {0x0004d7, 0x0004d6},
+    {0x000467, 0x000466},
+    {0x000217, 0x000216},
+    {0x00a663, 0x00a662},
+    {0x00ab79, 0x0013a9},
+    {0x001f66, 0x001f6e},
+    {0x000450, 0x000400},
+    {0x01e93a, 0x01e918},
+    {0x001e63, 0x001e62},
+    {0x001f36, 0x001f3e},
+    {0x001d79, 0x00a77d},
+    {0x00a699, 0x00a698},
+    {0x00a733, 0x00a732},
+    {0x0105aa, 0x010583},
+    {0x001eb5, 0x001eb4},
+    {0x01043c, 0x010414},
+    {0x002176, 0x002166},
+    {0x0010e0, 0x001ca0},
+    {0x0000ea, 0x0000ca},
+    {0x002cc9, 0x002cc8},
+    {0x000144, 0x000143},
+    {0x000566, 0x000536},
+    {0x0003ef, 0x0003ee},
+    {0x0010d3, 0x001c93},
+    {0x00a7d9, 0x00a7d8},
+    {0x010cc5, 0x010c85},
+    {0x0003e5, 0x0003e4},
+    {0x000192, 0x000191},
+    {0x016e74, 0x016e54},
+    {0x0104dc, 0x0104b4},
+    {0x002c68, 0x002c67},
+    {0x002d1a, 0x0010ba},
+    {0x0004fb, 0x0004fa},
+    {0x002d2d, 0x0010cd},
+    {0x00ff42, 0x00ff22},
+    {0x000515, 0x000514},
+    {0x002184, 0x002183},
+    {0x00014d, 0x00014c},
+    {0x0001ce, 0x0001cd},
+    {0x00ab93, 0x0013c3},
+    {0x000575, 0x000545},
+    {0x000233, 0x000232},
+    {0x002cdb, 0x002cda},
+    {0x010cd5, 0x010c95},
+    {0x00046f, 0x00046e},
+    {0x0010d0, 0x001c90},
+    {0x0001a3, 0x0001a2},
+    {0x00045d, 0x00040d},
+    {0x0004d3, 0x0004d2},
+    {0x000207, 0x000206},
+    {0x00a657, 0x00a656},
+    {0x001e77, 0x001e76},
+    {0x000272, 0x00019d},
+    {0x0001f2, 0x0001f1},
+    {0x002d14, 0x0010b4},
+    {0x000177, 0x000176},
+    {0x001e5d, 0x001e5c},
+    {0x001f40, 0x001f48},
+    {0x001eaf, 0x001eae},
+    {0x010443, 0x01041b},
+    {0x0010f4, 0x001cb4},
+    {0x0010f3, 0x001cb3},
+    {0x00ab98, 0x0013c8},
+    {0x010ce2, 0x010ca2},
+    {0x0010df, 0x001c9f},
+    {0x00057c, 0x00054c},
+    {0x000289, 0x000244},
+    {0x002cd1, 0x002cd0},
+    {0x001f87, 0x001f8f},
+    {0x0104f8, 0x0104d0},
+    {0x001f27, 0x001f2f},
+    {0x001e0b, 0x001e0a},
+    {0x0024e9, 0x0024cf},
+    {0x001f64, 0x001f6c},
+    {0x002d23, 0x0010c3},
+    {0x00a687, 0x00a686},
+    {0x00043c, 0x00041c},
+    {0x0001eb, 0x0001ea},
+    {0x00051d, 0x00051c},
+    {0x0004a1, 0x0004a0},
+    {0x00007a, 0x00005a},
+    {0x016e66, 0x016e46},
+    {0x00aba7, 0x0013d7},
+    {0x000572, 0x000542},
+    {0x00048b, 0x00048a},
+    {0x0001bd, 0x0001bc},
+    {0x001e2f, 0x001e2e},
+    {0x002c85, 0x002c84},
+    {0x00a66b, 0x00a66a},
+    {0x000581, 0x000551},
+    {0x010cc7, 0x010c87},
+    {0x002c51, 0x002c21},
+    {0x002c50, 0x002c20},
+    {0x0004ca, 0x0004c9},
+    {0x00a7b9, 0x00a7b8},
+    {0x00a64d, 0x00a64c},
+    {0x0001fb, 0x0001fa},
+    {0x0003d0, 0x000392},
+    {0x00ff56, 0x00ff36},
+    {0x001fc3, 0x001fcc},
+    {0x0004a9, 0x0004a8},
+    {0x002d07, 0x0010a7},
+    {0x000169, 0x000168},
+    {0x016e62, 0x016e42},
+    {0x00a68d, 0x00a68c},
+    {0x0010f7, 0x001cb7},
+    {0x010434, 0x01040c},
+    {0x01e937, 0x01e915},
+    {0x00012b, 0x00012a},
+    {0x001ea3, 0x001ea2},
+    {0x010cc9, 0x010c89},
+    {0x000579, 0x000549},
+    {0x00ab9b, 0x0013cb},
+    {0x0004e1, 0x0004e0},
+    {0x00044c, 0x00042c},
+    {0x00045a, 0x00040a},
+    {0x001ef3, 0x001ef2},
+    {0x01e938, 0x01e916},
+    {0x01e92c, 0x01e90a},
+    {0x00a737, 0x00a736},
+    {0x001edf, 0x001ede},
+    {0x002d15, 0x0010b5},
+    {0x001e61, 0x001e60},
+    {0x000259, 0x00018f},
+    {0x0001dd, 0x00018e},
+    {0x00abae, 0x0013de},
+    {0x0001bf, 0x0001f7},
+    {0x00056c, 0x00053c},
+    {0x00006b, 0x00004b},
+    {0x000573, 0x000543},
+    {0x001e35, 0x001e34},
+    {0x001f92, 0x001f9a},
+    {0x00012f, 0x00012e},
+    {0x00ab83, 0x0013b3},
+    {0x002cd3, 0x002cd2},
+    {0x001e1f, 0x001e1e},
+    {0x000153, 0x000152},
+    {0x00a7c1, 0x00a7c0},
+    {0x016e7c, 0x016e5c},
+    {0x001fe0, 0x001fe8},
+    {0x0104e3, 0x0104bb},
+    {0x001e7b, 0x001e7a},
+    {0x0003db, 0x0003da},
+    {0x00a73b, 0x00a73a},
+    {0x0003c2, 0x0003a3},
+    {0x01059d, 0x010576},
+    {0x0000f6, 0x0000d6},
+    {0x002c81, 0x002c80},
+    {0x0010e8, 0x001ca8},
+    {0x01e943, 0x01e921},
+    {0x00048d, 0x00048c},
+    {0x01e93e, 0x01e91c},
+    {0x000062, 0x000042},
+    {0x01e92d, 0x01e90b},
+    {0x001f73, 0x001fc9},
+    {0x000292, 0x0001b7},
+    {0x001e95, 0x001e94},
+    {0x00ab7c, 0x0013ac},
+    {0x01e922, 0x01e900},
+    {0x00028a, 0x0001b1},
+    {0x0004d5, 0x0004d4},
+    {0x002cb7, 0x002cb6},
+    {0x002c3c, 0x002c0c},
+    {0x000275, 0x00019f},
+    {0x000109, 0x000108},
+    {0x002ca1, 0x002ca0},
+    {0x000436, 0x000416},
+    {0x001c83, 0x000421},
+    {0x00015f, 0x00015e},
+    {0x00024f, 0x00024e},
+    {0x000075, 0x000055},
+    {0x001e43, 0x001e42},
+    {0x001e59, 0x001e58},
+    {0x002c76, 0x002c75},
+    {0x0010e7, 0x001ca7},
+    {0x002ca3, 0x002ca2},
+    {0x00a75b, 0x00a75a},
+    {0x00013e, 0x00013d},
+    {0x0010d2, 0x001c92},
+    {0x00021f, 0x00021e},
+    {0x00a66d, 0x00a66c},
+    {0x001e13, 0x001e12},
+    {0x0003e1, 0x0003e0},
+    {0x000209, 0x000208},
+    {0x001eb3, 0x001eb2},
+    {0x0024d3, 0x0024b9},
+    {0x001fd1, 0x001fd9},
+    {0x00ff53, 0x00ff33},
+    {0x000525, 0x000524},
+    {0x001f45, 0x001f4d},
+    {0x002d11, 0x0010b1},
+    {0x00024b, 0x00024a},
+    {0x016e6c, 0x016e4c},
+    {0x00a794, 0x00a7c4},
+    {0x000446, 0x000426},
+    {0x00006c, 0x00004c},
+    {0x016e6d, 0x016e4d},
+    {0x0004f9, 0x0004f8},
+    {0x0004cf, 0x0004c0},
+    {0x00ab91, 0x0013c1},
+    {0x00025b, 0x000190},
+    {0x000469, 0x000468},
+    {0x001f34, 0x001f3c},
+    {0x000065, 0x000045},
+    {0x00a7c3, 0x00a7c2},
+    {0x001fe1, 0x001fe9},
+    {0x000135, 0x000134},
+    {0x000201, 0x000200},
+    {0x0004bb, 0x0004ba},
+    {0x0024d5, 0x0024bb},
+    {0x01e930, 0x01e90e},
+    {0x0010fd, 0x001cbd},
+    {0x0003bf, 0x00039f},
+    {0x00abbb, 0x0013eb},
+    {0x00049f, 0x00049e},
+    {0x001ec1, 0x001ec0},
+    {0x01043d, 0x010415},
+    {0x010cf1, 0x010cb1},
+    {0x001fa0, 0x001fa8},
+    {0x00056e, 0x00053e},
+    {0x00ab92, 0x0013c2},
+    {0x00ab90, 0x0013c0},
+    {0x0010d9, 0x001c99},
+    {0x0001ed, 0x0001ec},
+    {0x001ef5, 0x001ef4},
+    {0x002c52, 0x002c22},
+    {0x00a661, 0x00a660},
+    {0x002cb9, 0x002cb8},
+    {0x0118d0, 0x0118b0},
+    {0x016e76, 0x016e56},
+    {0x00ff5a, 0x00ff3a},
+    {0x00052d, 0x00052c},
+    {0x00017f, 0x000053},
+    {0x001e07, 0x001e06},
+    {0x00ff44, 0x00ff24},
+    {0x01044c, 0x010424},
+    {0x0010ff, 0x001cbf},
+    {0x001f42, 0x001f4a},
+    {0x001ebb, 0x001eba},
+    {0x00a763, 0x00a762},
+    {0x010ceb, 0x010cab},
+    {0x002170, 0x002160},
+    {0x010431, 0x010409},
+    {0x002177, 0x002167},
+    {0x000564, 0x000534},
+    {0x002c53, 0x002c23},
+    {0x01059c, 0x010575},
+    {0x00ab77, 0x0013a7},
+    {0x000129, 0x000128},
+    {0x002c32, 0x002c02},
+    {0x002cb5, 0x002cb4},
+    {0x002175, 0x002165},
+    {0x010cdd, 0x010c9d},
+    {0x00011b, 0x00011a},
+    {0x016e60, 0x016e40},
+    {0x0003af, 0x00038a},
+    {0x0105b6, 0x01058f},
+    {0x000175, 0x000174},
+    {0x016e61, 0x016e41},
+    {0x010445, 0x01041d},
+    {0x00037d, 0x0003ff},
+    {0x00abaa, 0x0013da},
+    {0x0001c9, 0x0001c7},
+    {0x00ab9a, 0x0013ca},
+    {0x010ce4, 0x010ca4},
+    {0x00022f, 0x00022e},
+    {0x0118c9, 0x0118a9},
+    {0x000580, 0x000550},
+    {0x00a769, 0x00a768},
+    {0x000254, 0x000186},
+    {0x0000f3, 0x0000d3},
+    {0x001e0d, 0x001e0c},
+    {0x000454, 0x000404},
+    {0x000203, 0x000202},
+    {0x00a651, 0x00a650},
+    {0x001f79, 0x001ff9},
+    {0x016e68, 0x016e48},
+    {0x0000fe, 0x0000de},
+    {0x0000f0, 0x0000d0},
+    {0x0105af, 0x010588},
+    {0x00abb9, 0x0013e9},
+    {0x002d08, 0x0010a8},
+    {0x001f83, 0x001f8b},
+    {0x001e47, 0x001e46},
+    {0x010599, 0x010572},
+    {0x001f7b, 0x001feb},
+    {0x010ce1, 0x010ca1},
+    {0x00047b, 0x00047a},
+    {0x010cdc, 0x010c9c},
+    {0x001f10, 0x001f18},
+    {0x00ab7e, 0x0013ae},
+    {0x002c54, 0x002c24},
+    {0x00a665, 0x00a664},
+    {0x0104f3, 0x0104cb},
+    {0x00a7c8, 0x00a7c7},
+    {0x00a7bb, 0x00a7ba},
+    {0x00044d, 0x00042d},
+    {0x00052f, 0x00052e},
+    {0x0000f4, 0x0000d4},
+    {0x00043b, 0x00041b},
+    {0x002d0c, 0x0010ac},
+    {0x00ff50, 0x00ff30},
+    {0x001e57, 0x001e56},
+    {0x0003c4, 0x0003a4},
+    {0x00024d, 0x00024c},
+    {0x00057d, 0x00054d},
+    {0x016e78, 0x016e58},
+    {0x00a77a, 0x00a779},
+    {0x0105a7, 0x010580},
+    {0x0118d2, 0x0118b2},
+    {0x00ab8c, 0x0013bc},
+    {0x0001b6, 0x0001b5},
+    {0x0003e3, 0x0003e2},
+    {0x0118c7, 0x0118a7},
+    {0x002cc7, 0x002cc6},
+    {0x01059a, 0x010573},
+    {0x002d10, 0x0010b0},
+    {0x000582, 0x000552},
+    {0x00a7b5, 0x00a7b4},
+    {0x001e3b, 0x001e3a},
+    {0x0024dd, 0x0024c3},
+    {0x0003cb, 0x0003ab},
+    {0x000123, 0x000122},
+    {0x00abb6, 0x0013e6},
+    {0x00a723, 0x00a722},
+    {0x00a647, 0x00a646},
+    {0x0003eb, 0x0003ea},
+    {0x0105a1, 0x01057a},
+    {0x00a689, 0x00a688},
+    {0x0003ce, 0x00038f},
+    {0x001f96, 0x001f9e},
+    {0x001f94, 0x001f9c},
+    {0x001f91, 0x001f99},
+    {0x001e05, 0x001e04},
+    {0x0004e5, 0x0004e4},
+    {0x002c4f, 0x002c1f},
+    {0x0104fb, 0x0104d3},
+    {0x0013fd, 0x0013f5},
+    {0x001e0f, 0x001e0e},
+    {0x002c45, 0x002c15},
+    {0x0001e1, 0x0001e0},
+    {0x000188, 0x000187},
+    {0x000442, 0x000422},
+    {0x00043f, 0x00041f},
+    {0x0000e5, 0x0000c5},
+    {0x00abb4, 0x0013e4},
+    {0x000171, 0x000170},
+    {0x0004a3, 0x0004a2},
+    {0x00a76f, 0x00a76e},
+    {0x00015d, 0x00015c},
+    {0x00217b, 0x00216b},
+    {0x01042f, 0x010407},
+    {0x001e31, 0x001e30},
+    {0x00ab95, 0x0013c5},
+    {0x0003b5, 0x000395},
+    {0x0010db, 0x001c9b},
+    {0x001f12, 0x001f1a},
+    {0x0004f1, 0x0004f0},
+    {0x00a757, 0x00a756},
+    {0x002c83, 0x002c82},
+    {0x002cbd, 0x002cbc},
+    {0x016e7b, 0x016e5b},
+    {0x00a669, 0x00a668},
+    {0x00044e, 0x00042e},
+    {0x0003d1, 0x000398},
+    {0x002d1e, 0x0010be},
+    {0x00ff49, 0x00ff29},
+    {0x0024d1, 0x0024b7},
+    {0x000260, 0x000193},
+    {0x0105b7, 0x010590},
+    {0x0105a9, 0x010582},
+    {0x001e45, 0x001e44},
+    {0x000173, 0x000172},
+    {0x01e93d, 0x01e91b},
+    {0x002c6c, 0x002c6b},
+    {0x002d0a, 0x0010aa},
+    {0x01e936, 0x01e914},
+    {0x001f06, 0x001f0e},
+    {0x00abaf, 0x0013df},
+    {0x00217d, 0x00216d},
+    {0x00037c, 0x0003fe},
+    {0x00ff58, 0x00ff38},
+    {0x010cc1, 0x010c81},
+    {0x00020b, 0x00020a},
+    {0x00a659, 0x00a658},
+    {0x002ca7, 0x002ca6},
+    {0x001e53, 0x001e52},
+    {0x0003c1, 0x0003a1},
+    {0x000527, 0x000526},
+    {0x00a79f, 0x00a79e},
+    {0x016e75, 0x016e55},
+    {0x000430, 0x000410},
+    {0x001f35, 0x001f3d},
+    {0x002d01, 0x0010a1},
+    {0x010cf0, 0x010cb0},
+    {0x0010f5, 0x001cb5},
+    {0x001fa4, 0x001fac},
+    {0x010ce6, 0x010ca6},
+    {0x000481, 0x000480},
+    {0x01e931, 0x01e90f},
+    {0x000561, 0x000531},
+    {0x00ab85, 0x0013b5},
+    {0x00046b, 0x00046a},
+    {0x001f04, 0x001f0c},
+    {0x00a74d, 0x00a74c},
+    {0x00ab70, 0x0013a0},
+    {0x016e7f, 0x016e5f},
+    {0x0104e6, 0x0104be},
+    {0x00a7a3, 0x00a7a2},
+    {0x001e71, 0x001e70},
+    {0x0004ad, 0x0004ac},
+    {0x0001ef, 0x0001ee},
+    {0x002c95, 0x002c94},
+    {0x0004a5, 0x0004a4},
+    {0x00a64f, 0x00a64e},
+    {0x001ec3, 0x001ec2},
+    {0x00a765, 0x00a764},
+    {0x0000e3, 0x0000c3},
+    {0x01e941, 0x01e91f},
+    {0x00014b, 0x00014a},
+    {0x000148, 0x000147},
+    {0x010428, 0x010400},
+    {0x01e92b, 0x01e909},
+    {0x00045e, 0x00040e},
+    {0x00ab7f, 0x0013af},
+    {0x010429, 0x010401},
+    {0x000463, 0x000462},
+    {0x0118cf, 0x0118af},
+    {0x00011d, 0x00011c},
+    {0x002c3f, 0x002c0f},
+    {0x0001b0, 0x0001af},
+    {0x0001fd, 0x0001fc},
+    {0x0000fc, 0x0000dc},
+    {0x000180, 0x000243},
+    {0x001e4f, 0x001e4e},
+    {0x016e69, 0x016e49},
+    {0x01044e, 0x010426},
+    {0x00a791, 0x00a790},
+    {0x001e51, 0x001e50},
+    {0x000505, 0x000504},
+    {0x0118d8, 0x0118b8},
+    {0x010ced, 0x010cad},
+    {0x000061, 0x000041},
+    {0x00ab8e, 0x0013be},
+    {0x000443, 0x000423},
+    {0x0010d5, 0x001c95},
+    {0x001f70, 0x001fba},
+    {0x010cc6, 0x010c86},
+    {0x00027d, 0x002c64},
+    {0x0104ef, 0x0104c7},
+    {0x00a7bd, 0x00a7bc},
+    {0x000282, 0x00a7c5},
+    {0x001edb, 0x001eda},
+    {0x016e70, 0x016e50},
+    {0x0004bf, 0x0004be},
+    {0x001e67, 0x001e66},
+    {0x0105b8, 0x010591},
+    {0x0003d5, 0x0003a6},
+    {0x01043f, 0x010417},
+    {0x00057f, 0x00054f},
+    {0x000497, 0x000496},
+    {0x00aba1, 0x0013d1},
+    {0x00ab9e, 0x0013ce},
+    {0x0118d3, 0x0118b3},
+    {0x001f37, 0x001f3f},
+    {0x01e933, 0x01e911},
+    {0x001f93, 0x001f9b},
+    {0x0003f8, 0x0003f7},
+    {0x00013a, 0x000139},
+    {0x001f7d, 0x001ffb},
+    {0x001ee1, 0x001ee0},
+    {0x00ab71, 0x0013a1},
+    {0x000117, 0x000116},
+    {0x000456, 0x000406},
+    {0x0104e5, 0x0104bd},
+    {0x0003d7, 0x0003cf},
+    {0x00010f, 0x00010e},
+    {0x002d20, 0x0010c0},
+    {0x0000f2, 0x0000d2},
+    {0x000521, 0x000520},
+    {0x0105b1, 0x01058a},
+    {0x001ed1, 0x001ed0},
+    {0x000501, 0x000500},
+    {0x0004dd, 0x0004dc},
+    {0x0105a6, 0x01057f},
+    {0x01e942, 0x01e920},
+    {0x000570, 0x000540},
+    {0x01042a, 0x010402},
+    {0x00a76d, 0x00a76c},
+    {0x000479, 0x000478},
+    {0x002ca9, 0x002ca8},
+    {0x0024d9, 0x0024bf},
+    {0x000465, 0x000464},
+    {0x0104f5, 0x0104cd},
+    {0x00ff4c, 0x00ff2c},
+    {0x002c41, 0x002c11},
+    {0x00044f, 0x00042f},
+    {0x010cc8, 0x010c88},
+    {0x0105ac, 0x010585},
+    {0x001f02, 0x001f0a},
+    {0x00ff57, 0x00ff37},
+    {0x00ff47, 0x00ff27},
+    {0x00ff46, 0x00ff26},
+    {0x00abb7, 0x0013e7},
+    {0x001fb1, 0x001fb9},
+    {0x0000fb, 0x0000db},
+    {0x002d27, 0x0010c7},
+    {0x001e87, 0x001e86},
+    {0x002172, 0x002162},
+    {0x000577, 0x000547},
+    {0x000569, 0x000539},
+    {0x000499, 0x000498},
+    {0x00029d, 0x00a7b2},
+    {0x0001a8, 0x0001a7},
+    {0x001e91, 0x001e90},
+    {0x00ab78, 0x0013a8},
+    {0x002caf, 0x002cae},
+    {0x00ff4b, 0x00ff2b},
+    {0x00a65b, 0x00a65a},
+    {0x0004c4, 0x0004c3},
+    {0x00049b, 0x00049a},
+    {0x002d1b, 0x0010bb},
+    {0x00a645, 0x00a644},
+    {0x0105b9, 0x010592},
+    {0x001e3f, 0x001e3e},
+    {0x0003b8, 0x000398},
+    {0x000513, 0x000512},
+    {0x0001d0, 0x0001cf},
+    {0x0010f9, 0x001cb9},
+    {0x001eb7, 0x001eb6},
+    {0x010432, 0x01040a},
+    {0x0118dc, 0x0118bc},
+    {0x0010e2, 0x001ca2},
+    {0x016e65, 0x016e45},
+    {0x001e27, 0x001e26},
+    {0x010cd1, 0x010c91},
+    {0x001f80, 0x001f88},
+    {0x016e6f, 0x016e4f},
+    {0x00ab72, 0x0013a2},
+    {0x001fe5, 0x001fec},
+    {0x0003dd, 0x0003dc},
+    {0x0000e2, 0x0000c2},
+    {0x002c4c, 0x002c1c},
+    {0x016e6b, 0x016e4b},
+    {0x000441, 0x000421},
+    {0x00ff41, 0x00ff21},
+    {0x001eef, 0x001eee},
+    {0x0000f8, 0x0000d8},
+    {0x00017c, 0x00017b},
+    {0x0001e5, 0x0001e4},
+    {0x000583, 0x000553},
+    {0x0010f2, 0x001cb2},
+    {0x001e39, 0x001e38},
+    {0x000103, 0x000102},
+    {0x00a68b, 0x00a68a},
+    {0x002c46, 0x002c16},
+    {0x0118c6, 0x0118a6},
+    {0x0000e1, 0x0000c1},
+    {0x00ab80, 0x0013b0},
+    {0x01e932, 0x01e910},
+    {0x000215, 0x000214},
+    {0x000213, 0x000212},
+    {0x001ef9, 0x001ef8},
+    {0x00a767, 0x00a766},
+    {0x0104e0, 0x0104b8},
+    {0x001e4b, 0x001e4a},
+    {0x00043d, 0x00041d},
+    {0x0000fa, 0x0000da},
+    {0x0001e9, 0x0001e8},
+    {0x010433, 0x01040b},
+    {0x001c80, 0x000412},
+    {0x00217c, 0x00216c},
+    {0x001fb0, 0x001fb8},
+    {0x000159, 0x000158},
+    {0x010437, 0x01040f},
+    {0x010435, 0x01040d},
+    {0x00056a, 0x00053a},
+    {0x000562, 0x000532},
+    {0x000142, 0x000141},
+    {0x010cd6, 0x010c96},
+    {0x00026b, 0x002c62},
+    {0x00028b, 0x0001b2},
+    {0x001e17, 0x001e16},
+    {0x00020f, 0x00020e},
+    {0x00a65d, 0x00a65c},
+    {0x00a7b7, 0x00a7b6},
+    {0x0004c2, 0x0004c1},
+    {0x002c39, 0x002c09},
+    {0x0104d9, 0x0104b1},
+    {0x0003e9, 0x0003e8},
+    {0x00a7a1, 0x00a7a0},
+    {0x000433, 0x000413},
+    {0x002d0e, 0x0010ae},
+    {0x002d03, 0x0010a3},
+    {0x0010fa, 0x001cba},
+    {0x000247, 0x000246},
+    {0x000578, 0x000548},
+    {0x000151, 0x000150},
+    {0x01e935, 0x01e913},
+    {0x0010e4, 0x001ca4},
+    {0x00ab8a, 0x0013ba},
+    {0x002c5f, 0x002c2f},
+    {0x00046d, 0x00046c},
+    {0x001f07, 0x001f0f},
+    {0x001f33, 0x001f3b},
+    {0x0000f9, 0x0000d9},
+    {0x00a693, 0x00a692},
+    {0x0104e9, 0x0104c1},
+    {0x0001ff, 0x0001fe},
+    {0x002cad, 0x002cac},
+    {0x0003ca, 0x0003aa},
+    {0x0024d8, 0x0024be},
+    {0x000432, 0x000412},
+    {0x001c88, 0x00a64a},
+    {0x0010ef, 0x001caf},
+    {0x0001ad, 0x0001ac},
+    {0x00abac, 0x0013dc},
+    {0x000503, 0x000502},
+    {0x000491, 0x000490},
+    {0x000240, 0x002c7f},
+    {0x001fa1, 0x001fa9},
+    {0x00047d, 0x00047c},
+    {0x01e93b, 0x01e919},
+    {0x010cd0, 0x010c90},
+    {0x00abbd, 0x0013ed},
+    {0x010ccb, 0x010c8b},
+    {0x002c56, 0x002c26},
+    {0x00abab, 0x0013db},
+    {0x016e7d, 0x016e5d},
+    {0x001e09, 0x001e08},
+    {0x0001c5, 0x0001c4},
+    {0x001f63, 0x001f6b},
+    {0x001f53, 0x001f5b},
+    {0x00a72f, 0x00a72e},
+    {0x0000ef, 0x0000cf},
+    {0x001ed5, 0x001ed4},
+    {0x000345, 0x000399},
+    {0x00a793, 0x00a792},
+    {0x0003ad, 0x000388},
+    {0x001f44, 0x001f4c},
+    {0x00aba5, 0x0013d5},
+    {0x00a681, 0x00a680},
+    {0x0010eb, 0x001cab},
+    {0x00056b, 0x00053b},
+    {0x000477, 0x000476},
+    {0x002c42, 0x002c12},
+    {0x0010d6, 0x001c96},
+    {0x002d17, 0x0010b7},
+    {0x0004db, 0x0004da},
+    {0x00045f, 0x00040f},
+    {0x00a751, 0x00a750},
+    {0x000377, 0x000376},
+    {0x000119, 0x000118},
+    {0x016e73, 0x016e53},
+    {0x0104da, 0x0104b2},
+    {0x000263, 0x000194},
+    {0x002c9f, 0x002c9e},
+    {0x00a727, 0x00a726},
+    {0x0003bb, 0x00039b},
+    {0x0001e3, 0x0001e2},
+    {0x00abb2, 0x0013e2},
+    {0x00a78c, 0x00a78b},
+    {0x001f31, 0x001f39},
+    {0x0001cc, 0x0001ca},
+    {0x002c49, 0x002c19},
+    {0x00a685, 0x00a684},
+    {0x000231, 0x000230},
+    {0x0004df, 0x0004de},
+    {0x001f05, 0x001f0d},
+    {0x00a761, 0x00a760},
+    {0x000265, 0x00a78d},
+    {0x00021b, 0x00021a},
+    {0x001e11, 0x001e10},
+    {0x00a74b, 0x00a74a},
+    {0x016e72, 0x016e52},
+    {0x0004fd, 0x0004fc},
+    {0x0118db, 0x0118bb},
+    {0x00026c, 0x00a7ad},
+    {0x002c31, 0x002c01},
+    {0x01044d, 0x010425},
+    {0x0105b3, 0x01058c},
+    {0x00a68f, 0x00a68e},
+    {0x0001f3, 0x0001f1},
+    {0x001ec5, 0x001ec4},
+    {0x00a785, 0x00a784},
+    {0x001fa6, 0x001fae},
+    {0x002c89, 0x002c88},
+    {0x00ab97, 0x0013c7},
+    {0x01042c, 0x010404},
+    {0x01e92e, 0x01e90c},
+    {0x001e9b, 0x001e60},
+    {0x0010d8, 0x001c98},
+    {0x010ccd, 0x010c8d},
+    {0x0118ce, 0x0118ae},
+    {0x0104f7, 0x0104cf},
+    {0x000199, 0x000198},
+    {0x00a7bf, 0x00a7be},
+    {0x0024e8, 0x0024ce},
+    {0x0024e5, 0x0024cb},
+    {0x001f61, 0x001f69},
+    {0x0001a5, 0x0001a4},
+    {0x016e64, 0x016e44},
+    {0x00ff48, 0x00ff28},
+    {0x0104d8, 0x0104b0},
+    {0x001c82, 0x00041e},
+    {0x000079, 0x000059},
+    {0x001ebf, 0x001ebe},
+    {0x00aba4, 0x0013d4},
+    {0x0010ed, 0x001cad},
+    {0x00056d, 0x00053d},
+    {0x0010ea, 0x001caa},
+    {0x002ce1, 0x002ce0},
+    {0x002c65, 0x00023a},
+    {0x00ab8b, 0x0013bb},
+    {0x000223, 0x000222},
+    {0x002ccb, 0x002cca},
+    {0x00a753, 0x00a752},
+    {0x001f72, 0x001fc8},
+    {0x000140, 0x00013f},
+    {0x001e7d, 0x001e7c},
+    {0x002c3a, 0x002c0a},
+    {0x00a649, 0x00a648},
+    {0x010cc2, 0x010c82},
+    {0x002d0d, 0x0010ad},
+    {0x01e926, 0x01e904},
+    {0x00016b, 0x00016a},
+    {0x002d05, 0x0010a5},
+    {0x00abbf, 0x0013ef},
+    {0x000073, 0x000053},
+    {0x000072, 0x000052},
+    {0x0010f6, 0x001cb6},
+    {0x0004ff, 0x0004fe},
+    {0x002c73, 0x002c72},
+    {0x00ab8d, 0x0013bd},
+    {0x00ab89, 0x0013b9},
+    {0x00ab87, 0x0013b7},
+    {0x001e25, 0x001e24},
+    {0x00021d, 0x00021c},
+    {0x002c59, 0x002c29},
+    {0x002cc3, 0x002cc2},
+    {0x000458, 0x000408},
+    {0x00a7a9, 0x00a7a8},
+    {0x002c38, 0x002c08},
+    {0x000157, 0x000156},
+    {0x002c33, 0x002c03},
+    {0x00a73f, 0x00a73e},
+    {0x00010b, 0x00010a},
+    {0x001f51, 0x001f59},
+    {0x000257, 0x00018a},
+    {0x0105b0, 0x010589},
+    {0x00abad, 0x0013dd},
+    {0x000251, 0x002c6d},
+    {0x000242, 0x000241},
+    {0x001eb1, 0x001eb0},
+    {0x01042e, 0x010406},
+    {0x00057b, 0x00054b},
+    {0x0024d7, 0x0024bd},
+    {0x0004b7, 0x0004b6},
+    {0x00ab82, 0x0013b2},
+    {0x001eed, 0x001eec},
+    {0x00a667, 0x00a666},
+    {0x010441, 0x010419},
+    {0x000371, 0x000370},
+    {0x001efb, 0x001efa},
+    {0x000451, 0x000401},
+    {0x0104e2, 0x0104ba},
+    {0x0000e6, 0x0000c6},
+    {0x002d1f, 0x0010bf},
+    {0x0001f9, 0x0001f8},
+    {0x001e5b, 0x001e5a},
+    {0x002c35, 0x002c05},
+    {0x0105ad, 0x010586},
+    {0x001fb3, 0x001fbc},
+    {0x000101, 0x000100},
+    {0x000127, 0x000126},
+    {0x000133, 0x000132},
+    {0x000064, 0x000044},
+    {0x000071, 0x000051},
+    {0x0001a1, 0x0001a0},
+    {0x001e8d, 0x001e8c},
+    {0x002c58, 0x002c28},
+    {0x0010d4, 0x001c94},
+    {0x001e19, 0x001e18},
+    {0x0013f8, 0x0013f0},
+    {0x0104f1, 0x0104c9},
+    {0x001ef7, 0x001ef6},
+    {0x0118da, 0x0118ba},
+    {0x00044b, 0x00042b},
+    {0x0104db, 0x0104b3},
+    {0x002c37, 0x002c07},
+    {0x000529, 0x000528},
+    {0x0004e3, 0x0004e2},
+    {0x000585, 0x000555},
+    {0x00a747, 0x00a746},
+    {0x002c8b, 0x002c8a},
+    {0x000249, 0x000248},
+    {0x0010f8, 0x001cb8},
+    {0x00a725, 0x00a724},
+    {0x010ce9, 0x010ca9},
+    {0x0010e6, 0x001ca6},
+    {0x0004ed, 0x0004ec},
+    {0x0004bd, 0x0004bc},
+    {0x002cd9, 0x002cd8},
+    {0x002c5d, 0x002c2d},
+    {0x00012d, 0x00012c},
+    {0x002cc5, 0x002cc4},
+    {0x00ab73, 0x0013a3},
+    {0x001e6f, 0x001e6e},
+    {0x000107, 0x000106},
+    {0x00018c, 0x00018b},
+    {0x016e6e, 0x016e4e},
+    {0x0024db, 0x0024c1},
+    {0x002c30, 0x002c00},
+    {0x0000ff, 0x000178},
+    {0x0105b5, 0x01058e},
+    {0x001c87, 0x000462},
+    {0x0003b3, 0x000393},
+    {0x00050f, 0x00050e},
+    {0x01059f, 0x010578},
+    {0x000576, 0x000546},
+    {0x0010f1, 0x001cb1},
+    {0x01e940, 0x01e91e},
+    {0x010ce3, 0x010ca3},
+    {0x000131, 0x000049},
+    {0x002cd5, 0x002cd4},
+    {0x00a7d7, 0x00a7d6},
+    {0x0003f0, 0x00039a},
+    {0x0000e8, 0x0000c8},
+    {0x0013fb, 0x0013f3},
+    {0x0024d6, 0x0024bc},
+    {0x000452, 0x000402},
+    {0x0024e7, 0x0024cd},
+    {0x002d24, 0x0010c4},
+    {0x000185, 0x000184},
+    {0x001f24, 0x001f2c},
+    {0x0004b3, 0x0004b2},
+    {0x002d0f, 0x0010af},
+    {0x00abbc, 0x0013ec},
+    {0x000250, 0x002c6f},
+    {0x000113, 0x000112},
+    {0x0003ac, 0x000386},
+    {0x00015b, 0x00015a},
+    {0x01e93f, 0x01e91d},
+    {0x0004c6, 0x0004c5},
+    {0x010cea, 0x010caa},
+    {0x002c8f, 0x002c8e},
+    {0x000568, 0x000538},
+    {0x0118c1, 0x0118a1},
+    {0x00ab7d, 0x0013ad},
+    {0x00a755, 0x00a754},
+    {0x00019a, 0x00023d},
+    {0x001f67, 0x001f6f},
+    {0x000195, 0x0001f6},
+    {0x002c3d, 0x002c0d},
+    {0x0024e2, 0x0024c8},
+    {0x00044a, 0x00042a},
+    {0x001e69, 0x001e68},
+    {0x0105bb, 0x010594},
+    {0x01044f, 0x010427},
+    {0x0003ba, 0x00039a},
+    {0x002d06, 0x0010a6},
+    {0x01043e, 0x010416},
+    {0x0118c4, 0x0118a4},
+    {0x010cee, 0x010cae},
+    {0x000584, 0x000554},
+    {0x00ab9d, 0x0013cd},
+    {0x0004ef, 0x0004ee},
+    {0x01043b, 0x010413},
+    {0x00026a, 0x00a7ae},
+    {0x00ab88, 0x0013b8},
+    {0x0010d1, 0x001c91},
+    {0x00037b, 0x0003fd},
+    {0x00ab74, 0x0013a4},
+    {0x002c4a, 0x002c1a},
+    {0x001f30, 0x001f38},
+    {0x001f77, 0x001fdb},
+    {0x002c44, 0x002c14},
+    {0x000111, 0x000110},
+    {0x000444, 0x000424},
+    {0x002c9d, 0x002c9c},
+    {0x00a79d, 0x00a79c},
+    {0x010cd2, 0x010c92},
+    {0x00a76b, 0x00a76a},
+    {0x010446, 0x01041e},
+    {0x001f32, 0x001f3a},
+    {0x000493, 0x000492},
+    {0x00aba9, 0x0013d9},
+    {0x00a691, 0x00a690},
+    {0x00ab99, 0x0013c9},
+    {0x0004e9, 0x0004e8},
+    {0x00022d, 0x00022c},
+    {0x00020d, 0x00020c},
+    {0x0001e7, 0x0001e6},
+    {0x001f7c, 0x001ffa},
+    {0x0104f9, 0x0104d1},
+    {0x001f00, 0x001f08},
+    {0x0004ce, 0x0004cd},
+    {0x000453, 0x000403},
+    {0x002c40, 0x002c10},
+    {0x01e929, 0x01e907},
+    {0x002d22, 0x0010c2},
+    {0x0024d4, 0x0024ba},
+    {0x00a655, 0x00a654},
+    {0x001f85, 0x001f8d},
+    {0x002c93, 0x002c92},
+    {0x000435, 0x000415},
+    {0x0001d8, 0x0001d7},
+};
+
+inline constexpr uint16_t to_lower_hash_seeds[359] = {
+    350, 0, 143, 8, 15, 2, 7, 6, 16, 0, 0, 61,
+    1, 27, 3, 91, 198, 12, 2, 49, 7, 0, 31, 530,
+    1, 25, 14, 5, 181, 0, 0, 501, 0, 125, 0, 0,
+    0, 12, 1, 18, 0, 0, 23, 153, 0, 51, 0, 5,
+    8, 0, 1, 10, 1, 108, 0, 12, 5, 67, 13, 34,
+    3, 17, 1, 167, 8, 163, 0, 37, 247, 0, 0, 20,
+    204, 1, 0, 2, 61, 92, 8, 22, 155, 6, 0, 1430,
+    2, 170, 71, 8, 60, 0, 3, 0, 0, 528, 3, 2,
+    1342, 11, 0, 56, 1, 283, 1, 1046, 515, 101, 0, 165,
+    1152, 11, 5, 46, 35, 10, 3, 0, 36, 1, 9, 4,
+    6, 18, 2, 1528, 280, 621, 1, 11, 808, 14, 3, 7,
+    51, 139, 3, 1, 20, 30, 2, 0, 272, 374, 0, 94,
+    20, 1, 0, 12, 122, 43, 2, 3, 353, 10, 4, 0,
+    69, 238, 1, 0, 1663, 232, 1, 391, 98, 19, 6, 0,
+    1613, 735, 1982, 31, 74, 35, 0, 87, 10, 251, 15, 16,
+    168, 204, 2, 0, 19, 2, 2, 9, 9, 45, 214, 55,
+    9, 979, 132, 486, 0, 455, 10, 45, 46, 12, 2, 24,
+    180, 85, 47, 7, 194, 14, 425, 75, 0, 107, 845, 66,
+    22, 105, 0, 2, 0, 335, 118, 10, 0, 209, 27, 7,
+    16, 327, 5, 17, 62, 218, 29, 9, 55, 48, 44, 98,
+    3, 17, 457, 2, 1, 2209, 893, 39, 873, 2, 1486, 6,
+    15, 341, 324, 534, 521, 1345, 0, 102, 6, 290, 608, 7,
+    4, 286, 195, 188, 0, 109, 5, 8, 7, 9307, 1835, 1144,
+    0, 1376, 2243, 87, 4, 204, 5049, 0, 131, 149, 30, 471,
+    189, 1735, 1595, 277, 30, 1601, 2167, 18, 546, 41, 4, 53,
+    77, 676, 1085, 0, 2, 16, 25121, 623, 2, 1, 192, 1,
+    1, 181, 935, 3444, 3755, 91, 12, 192, 2, 160, 75, 5,
+    246, 3, 361, 248, 0, 0, 421, 3615, 19, 5201, 6, 263,
+    471, 240, 29, 4419, 1122, 5920, 6497, 140, 21, 323, 4707, 1027,
+    0, 8, 3633, 9871, 24731, 464, 0, 21, 272, 23, 194,
+};
+
+inline constexpr CaseHashEntry to_lower_hash_slots[1433] = {
+    {0x000508, 0x000509},
+    {0x00a780, 0x00a781},
+    {0x000406, 0x000456},
+    {0x00ff21, 0x00ff41},
+    {0x0000ce, 0x0000ee},
+    {0x002ce0, 0x002ce1},
+    {0x0004ee, 0x0004ef},
+    {0x000226, 0x000227},
+    {0x001cbf, 0x0010ff},
+    {0x010411, 0x010439},
+    {0x01040e, 0x010436},
+    {0x0010c2, 0x002d22},
+    {0x00a66a, 0x00a66b},
+    {0x00011a, 0x00011b},
+    {0x001f2d, 0x001f25},
+    {0x0001fa, 0x0001fb},
+    {0x002c2a, 0x002c5a},
+    {0x000476, 0x000477},
+    {0x001f4a, 0x001f42},
+    {0x01e917, 0x01e939},
+    {0x002c8c, 0x002c8d},
+    {0x010c86, 0x010cc6},
+    {0x002c10, 0x002c40},
+    {0x000156, 0x000157},
+    {0x000244, 0x000289},
+    {0x00a779, 0x00a77a},
+    {0x00a664, 0x00a665},
+    {0x0003a8, 0x0003c8},
+    {0x001ea2, 0x001ea3},
+    {0x001f0c, 0x001f04},
+    {0x0010b4, 0x002d14},
+    {0x001ca4, 0x0010e4},
+    {0x01040b, 0x010433},
+    {0x0003a4, 0x0003c4},
+    {0x001f2f, 0x001f27},
+    {0x00053b, 0x00056b},
+    {0x000480, 0x000481},
+    {0x0010a7, 0x002d07},
+    {0x0001f4, 0x0001f5},
+    {0x001ca5, 0x0010e5},
+    {0x000548, 0x000578},
+    {0x001fc8, 0x001f72},
+    {0x001ec8, 0x001ec9},
+    {0x001f3c, 0x001f34},
+    {0x000245, 0x00028c},
+    {0x001ebc, 0x001ebd},
+    {0x002ced, 0x002cee},
+    {0x0013ac, 0x00ab7c},
+    {0x0118a8, 0x0118c8},
+    {0x001fda, 0x001f76},
+    {0x000389, 0x0003ae},
+    {0x0001b2, 0x00028b},
+    {0x010575, 0x01059c},
+    {0x000134, 0x000135},
+    {0x00019d, 0x000272},
+    {0x000122, 0x000123},
+    {0x001f08, 0x001f00},
+    {0x002cae, 0x002caf},
+    {0x00a7ae, 0x00026a},
+    {0x002c1c, 0x002c4c},
+    {0x010c8c, 0x010ccc},
+    {0x010ca1, 0x010ce1},
+    {0x002c12, 0x002c42},
+    {0x001ed4, 0x001ed5},
+    {0x016e46, 0x016e66},
+    {0x0013ca, 0x00ab9a},
+    {0x00ff35, 0x00ff55},
+    {0x002c7e, 0x00023f},
+    {0x002c03, 0x002c33},
+    {0x002c00, 0x002c30},
+    {0x000410, 0x000430},
+    {0x00a726, 0x00a727},
+    {0x000228, 0x000229},
+    {0x000050, 0x000070},
+    {0x000526, 0x000527},
+    {0x00a756, 0x00a757},
+    {0x00a754, 0x00a755},
+    {0x010401, 0x010429},
+    {0x00040a, 0x00045a},
+    {0x001e06, 0x001e07},
+    {0x0010ae, 0x002d0e},
+    {0x001e00, 0x001e01},
+    {0x0013c6, 0x00ab96},
+    {0x002cdc, 0x002cdd},
+    {0x0024ce, 0x0024e8},
+    {0x0001e6, 0x0001e7},
+    {0x001e3a, 0x001e3b},
+    {0x00049c, 0x00049d},
+    {0x000421, 0x000441},
+    {0x002cf2, 0x002cf3},
+    {0x000502, 0x000503},
+    {0x00015a, 0x00015b},
+    {0x00a76c, 0x00a76d},
+    {0x001ea4, 0x001ea5},
+    {0x002cde, 0x002cdf},
+    {0x0004de, 0x0004df},
+    {0x001e9e, 0x0000df},
+    {0x001cb9, 0x0010f9},
+    {0x00a750, 0x00a751},
+    {0x001eba, 0x001ebb},
+    {0x00020a, 0x00020b},
+    {0x010404, 0x01042c},
+    {0x0004c1, 0x0004c2},
+    {0x010caa, 0x010cea},
+    {0x000110, 0x000111},
+    {0x0013d8, 0x00aba8},
+    {0x010c96, 0x010cd6},
+    {0x0024c7, 0x0024e1},
+    {0x0004a6, 0x0004a7},
+    {0x010c90, 0x010cd0},
+    {0x00a680, 0x00a681},
+    {0x001f2e, 0x001f26},
+    {0x00a692, 0x00a693},
+    {0x00ff27, 0x00ff47},
+    {0x000504, 0x000505},
+    {0x00022e, 0x00022f},
+    {0x0013df, 0x00abaf},
+    {0x001ff9, 0x001f79},
+    {0x00216c, 0x00217c},
+    {0x0118b6, 0x0118d6},
+    {0x000218, 0x000219},
+    {0x00a666, 0x00a667},
+    {0x0013eb, 0x00abbb},
+    {0x010580, 0x0105a7},
+    {0x0000dc, 0x0000fc},
+    {0x01e901, 0x01e923},
+    {0x016e5a, 0x016e7a},
+    {0x0104cf, 0x0104f7},
+    {0x0118ad, 0x0118cd},
+    {0x01e902, 0x01e924},
+    {0x000429, 0x000449},
+    {0x016e50, 0x016e70},
+    {0x001c90, 0x0010d0},
+    {0x0004c0, 0x0004cf},
+    {0x000414, 0x000434},
+    {0x002c0c, 0x002c3c},
+    {0x000396, 0x0003b6},
+    {0x000147, 0x000148},
+    {0x000393, 0x0003b3},
+    {0x000051, 0x000071},
+    {0x000041, 0x000061},
+    {0x010413, 0x01043b},
+    {0x01e914, 0x01e936},
+    {0x000539, 0x000569},
+    {0x000545, 0x000575},
+    {0x010cb2, 0x010cf2},
+    {0x0013a8, 0x00ab78},
+    {0x001fd8, 0x001fd0},
+    {0x001f5b, 0x001f53},
+    {0x002c28, 0x002c58},
+    {0x0013aa, 0x00ab7a},
+    {0x001ed0, 0x001ed1},
+    {0x000518, 0x000519},
+    {0x00a790, 0x00a791},
+    {0x0024b9, 0x0024d3},
+    {0x0104b2, 0x0104da},
+    {0x0013b4, 0x00ab84},
+    {0x0004b8, 0x0004b9},
+    {0x002c9c, 0x002c9d},
+    {0x002c1d, 0x002c4d},
+    {0x00014c, 0x00014d},
+    {0x002c62, 0x00026b},
+    {0x00a762, 0x00a763},
+    {0x000212, 0x000213},
+    {0x00012a, 0x00012b},
+    {0x0010be, 0x002d1e},
+    {0x00a650, 0x00a651},
+    {0x000179, 0x00017a},
+    {0x002cb0, 0x002cb1},
+    {0x0013dd, 0x00abad},
+    {0x0013da, 0x00abaa},
+    {0x0104c9, 0x0104f1},
+    {0x001eb6, 0x001eb7},
+    {0x00015e, 0x00015f},
+    {0x0003dc, 0x0003dd},
+    {0x002c1b, 0x002c4b},
+    {0x002c86, 0x002c87},
+    {0x010c94, 0x010cd4},
+    {0x001eb4, 0x001eb5},
+    {0x00a64a, 0x00a64b},
+    {0x00216b, 0x00217b},
+    {0x001f19, 0x001f11},
+    {0x000058, 0x000078},
+    {0x000139, 0x00013a},
+    {0x010576, 0x01059d},
+    {0x000043, 0x000063},
+    {0x001cb3, 0x0010f3},
+    {0x010405, 0x01042d},
+    {0x000532, 0x000562},
+    {0x001eee, 0x001eef},
+    {0x000537, 0x000567},
+    {0x01e90e, 0x01e930},
+    {0x010ca4, 0x010ce4},
+    {0x0013a2, 0x00ab72},
+    {0x002c20, 0x002c50},
+    {0x010416, 0x01043e},
+    {0x016e54, 0x016e74},
+    {0x0104ba, 0x0104e2},
+    {0x00ff37, 0x00ff57},
+    {0x01e91d, 0x01e93f},
+    {0x000416, 0x000436},
+    {0x00ff2e, 0x00ff4e},
+    {0x00053a, 0x00056a},
+    {0x00047a, 0x00047b},
+    {0x002163, 0x002173},
+    {0x0001ae, 0x000288},
+    {0x00a7c6, 0x001d8e},
+    {0x016e51, 0x016e71},
+    {0x000553, 0x000583},
+    {0x001e78, 0x001e79},
+    {0x00011e, 0x00011f},
+    {0x0004c9, 0x0004ca},
+    {0x001e04, 0x001e05},
+    {0x001f48, 0x001f40},
+    {0x001e6c, 0x001e6d},
+    {0x001ef2, 0x001ef3},
+    {0x0013b6, 0x00ab86},
+    {0x0013cb, 0x00ab9b},
+    {0x002c8e, 0x002c8f},
+    {0x016e41, 0x016e61},
+    {0x00024c, 0x00024d},
+    {0x0104b3, 0x0104db},
+    {0x0013e2, 0x00abb2},
+    {0x00a77b, 0x00a77c},
+    {0x00054e, 0x00057e},
+    {0x001f2b, 0x001f23},
+    {0x010421, 0x010449},
+    {0x001f0d, 0x001f05},
+    {0x00004b, 0x00006b},
+    {0x0000d8, 0x0000f8},
+    {0x01040d, 0x010435},
+    {0x001e1e, 0x001e1f},
+    {0x00053f, 0x00056f},
+    {0x01e90c, 0x01e92e},
+    {0x001f3b, 0x001f33},
+    {0x002132, 0x00214e},
+    {0x0001f6, 0x000195},
+    {0x0013cd, 0x00ab9d},
+    {0x0013d7, 0x00aba7},
+    {0x010c95, 0x010cd5},
+    {0x0024c5, 0x0024df},
+    {0x00023e, 0x002c66},
+    {0x002169, 0x002179},
+    {0x000246, 0x000247},
+    {0x0001cb, 0x0001cc},
+    {0x00216e, 0x00217e},
+    {0x01058d, 0x0105b4},
+    {0x000474, 0x000475},
+    {0x000498, 0x000499},
+    {0x001ec2, 0x001ec3},
+    {0x00a75e, 0x00a75f},
+    {0x0004a4, 0x0004a5},
+    {0x001c96, 0x0010d6},
+    {0x000124, 0x000125},
+    {0x0004d0, 0x0004d1},
+    {0x001f69, 0x001f61},
+    {0x00a7b2, 0x00029d},
+    {0x00a7b3, 0x00ab53},
+    {0x00010e, 0x00010f},
+    {0x00212a, 0x00006b},
+    {0x00a658, 0x00a659},
+    {0x016e56, 0x016e76},
+    {0x000104, 0x000105},
+    {0x001f3e, 0x001f36},
+    {0x002c15, 0x002c45},
+    {0x010578, 0x01059f},
+    {0x002c05, 0x002c35},
+    {0x001fb8, 0x001fb0},
+    {0x000399, 0x0003b9},
+    {0x000397, 0x0003b7},
+    {0x010583, 0x0105aa},
+    {0x0003ff, 0x00037d},
+    {0x00216a, 0x00217a},
+    {0x00a668, 0x00a669},
+    {0x000130, 0x000069},
+    {0x01e908, 0x01e92a},
+    {0x0013f5, 0x0013fd},
+    {0x010582, 0x0105a9},
+    {0x000186, 0x000254},
+    {0x0004c5, 0x0004c6},
+    {0x001c95, 0x0010d5},
+    {0x0004b4, 0x0004b5},
+    {0x00ff23, 0x00ff43},
+    {0x0013cc, 0x00ab9c},
+    {0x0104c7, 0x0104ef},
+    {0x010c88, 0x010cc8},
+    {0x002c8a, 0x002c8b},
+    {0x01e90f, 0x01e931},
+    {0x00048a, 0x00048b},
+    {0x010594, 0x0105bb},
+    {0x0118b0, 0x0118d0},
+    {0x00041a, 0x00043a},
+    {0x010417, 0x01043f},
+    {0x00a766, 0x00a767},
+    {0x0118be, 0x0118de},
+    {0x001cba, 0x0010fa},
+    {0x001e16, 0x001e17},
+    {0x0001a2, 0x0001a3},
+    {0x010c9c, 0x010cdc},
+    {0x0118a7, 0x0118c7},
+    {0x00a7b6, 0x00a7b7},
+    {0x010cac, 0x010cec},
+    {0x0010a9, 0x002d09},
+    {0x002c0a, 0x002c3a},
+    {0x0004ac, 0x0004ad},
+    {0x0024c9, 0x0024e3},
+    {0x0104c3, 0x0104eb},
+    {0x0013c4, 0x00ab94},
+    {0x001fac, 0x001fa4},
+    {0x001eb8, 0x001eb9},
+    {0x00a694, 0x00a695},
+    {0x0004fc, 0x0004fd},
+    {0x002160, 0x002170},
+    {0x001f1b, 0x001f13},
+    {0x00054b, 0x00057b},
+    {0x001ffb, 0x001f7d},
+    {0x00046c, 0x00046d},
+    {0x01e91e, 0x01e940},
+    {0x001e8a, 0x001e8b},
+    {0x001cb2, 0x0010f2},
+    {0x001f6b, 0x001f63},
+    {0x0013ec, 0x00abbc},
+    {0x000204, 0x000205},
+    {0x0004bc, 0x0004bd},
+    {0x001ede, 0x001edf},
+    {0x0104d1, 0x0104f9},
+    {0x002cd6, 0x002cd7},
+    {0x000490, 0x000491},
+    {0x0024c3, 0x0024dd},
+    {0x0024c0, 0x0024da},
+    {0x00ff38, 0x00ff58},
+    {0x0001fc, 0x0001fd},
+    {0x000174, 0x000175},
+    {0x001e38, 0x001e39},
+    {0x0013be, 0x00ab8e},
+    {0x001fcc, 0x001fc3},
+    {0x00a688, 0x00a689},
+    {0x000053, 0x000073},
+    {0x00a75c, 0x00a75d},
+    {0x010415, 0x01043d},
+    {0x000464, 0x000465},
+    {0x001f9a, 0x001f92},
+    {0x001ef0, 0x001ef1},
+    {0x001e08, 0x001e09},
+    {0x000540, 0x000570},
+    {0x0001fe, 0x0001ff},
+    {0x001fca, 0x001f74},
+    {0x001c94, 0x0010d4},
+    {0x002ca2, 0x002ca3},
+    {0x0104ca, 0x0104f2},
+    {0x00051a, 0x00051b},
+    {0x000425, 0x000445},
+    {0x000424, 0x000444},
+    {0x0003a9, 0x0003c9},
+    {0x000412, 0x000432},
+    {0x0013b2, 0x00ab82},
+    {0x0004b2, 0x0004b3},
+    {0x000150, 0x000151},
+    {0x00ff32, 0x00ff52},
+    {0x0000c7, 0x0000e7},
+    {0x00004c, 0x00006c},
+    {0x0003f7, 0x0003f8},
+    {0x0004d8, 0x0004d9},
+    {0x0118ab, 0x0118cb},
+    {0x0118a9, 0x0118c9},
+    {0x001e7c, 0x001e7d},
+    {0x000118, 0x000119},
+    {0x001f1a, 0x001f12},
+    {0x001f8a, 0x001f82},
+    {0x00a646, 0x00a647},
+    {0x002c9e, 0x002c9f},
+    {0x0000d6, 0x0000f6},
+    {0x0001e2, 0x0001e3},
+    {0x010c93, 0x010cd3},
+    {0x00a78b, 0x00a78c},
+    {0x00041d, 0x00043d},
+    {0x00040c, 0x00045c},
+    {0x0004fe, 0x0004ff},
+    {0x01058e, 0x0105b5},
+    {0x001f1d, 0x001f15},
+    {0x00038c, 0x0003cc},
+    {0x002cd8, 0x002cd9},
+    {0x00021e, 0x00021f},
+    {0x001e48, 0x001e49},
+    {0x001cb5, 0x0010f5},
+    {0x010c8b, 0x010ccb},
+    {0x00053e, 0x00056e},
+    {0x001ecc, 0x001ecd},
+    {0x001ef4, 0x001ef5},
+    {0x010ca9, 0x010ce9},
+    {0x00a734, 0x00a735},
+    {0x00212b, 0x0000e5},
+    {0x0013d4, 0x00aba4},
+    {0x00ff33, 0x00ff53},
+    {0x0010c3, 0x002d23},
+    {0x0024c2, 0x0024dc},
+    {0x00ff39, 0x00ff59},
+    {0x00a784, 0x00a785},
+    {0x001e4c, 0x001e4d},
+    {0x0000d4, 0x0000f4},
+    {0x00039b, 0x0003bb},
+    {0x0118a5, 0x0118c5},
+    {0x00a76e, 0x00a76f},
+    {0x000400, 0x000450},
+    {0x001faf, 0x001fa7},
+    {0x000466, 0x000467},
+    {0x010571, 0x010598},
+    {0x0118b1, 0x0118d1},
+    {0x002cbc, 0x002cbd},
+    {0x00a7be, 0x00a7bf},
+    {0x0001e8, 0x0001e9},
+    {0x00a7ad, 0x00026c},
+    {0x001e6e, 0x001e6f},
+    {0x00a7b0, 0x00029e},
+    {0x0013e7, 0x00abb7},
+    {0x00021a, 0x00021b},
+    {0x016e52, 0x016e72},
+    {0x002c16, 0x002c46},
+    {0x000108, 0x000109},
+    {0x0104b5, 0x0104dd},
+    {0x000542, 0x000572},
+    {0x00a77d, 0x001d79},
+    {0x00040f, 0x00045f},
+    {0x001f18, 0x001f10},
+    {0x0003fd, 0x00037b},
+    {0x010422, 0x01044a},
+    {0x01041f, 0x010447},
+    {0x000162, 0x000163},
+    {0x01e921, 0x01e943},
+    {0x000506, 0x000507},
+    {0x0010c0, 0x002d20},
+    {0x002cb6, 0x002cb7},
+    {0x000191, 0x000192},
+    {0x001f5d, 0x001f55},
+    {0x00a722, 0x00a723},
+    {0x0013dc, 0x00abac},
+    {0x0004ae, 0x0004af},
+    {0x016e5d, 0x016e7d},
+    {0x016e4c, 0x016e6c},
+    {0x00a78d, 0x000265},
+    {0x002183, 0x002184},
+    {0x00039a, 0x0003ba},
+    {0x0118a6, 0x0118c6},
+    {0x001e30, 0x001e31},
+    {0x00216f, 0x00217f},
+    {0x001c92, 0x0010d2},
+    {0x000528, 0x000529},
+    {0x001e26, 0x001e27},
+    {0x0000c1, 0x0000e1},
+    {0x000046, 0x000066},
+    {0x01040a, 0x010432},
+    {0x01e91b, 0x01e93d},
+    {0x002c2d, 0x002c5d},
+    {0x010cad, 0x010ced},
+    {0x000206, 0x000207},
+    {0x000243, 0x000180},
+    {0x002c04, 0x002c34},
+    {0x000184, 0x000185},
+    {0x0013c8, 0x00ab98},
+    {0x000224, 0x000225},
+    {0x0013b8, 0x00ab88},
+    {0x00a7a2, 0x00a7a3},
+    {0x00050e, 0x00050f},
+    {0x000160, 0x000161},
+    {0x016e40, 0x016e60},
+    {0x001f29, 0x001f21},
+    {0x0013a9, 0x00ab79},
+    {0x00053d, 0x00056d},
+    {0x00a7c2, 0x00a7c3},
+    {0x000401, 0x000451},
+    {0x000386, 0x0003ac},
+    {0x002c82, 0x002c83},
+    {0x010414, 0x01043c},
+    {0x0010c5, 0x002d25},
+    {0x000370, 0x000371},
+    {0x010400, 0x010428},
+    {0x00054c, 0x00057c},
+    {0x01e915, 0x01e937},
+    {0x00a64c, 0x00a64d},
+    {0x0000ca, 0x0000ea},
+    {0x00a72c, 0x00a72d},
+    {0x0013ce, 0x00ab9e},
+    {0x0010b0, 0x002d10},
+    {0x016e4f, 0x016e6f},
+    {0x001f3a, 0x001f32},
+    {0x00a782, 0x00a783},
+    {0x002c19, 0x002c49},
+    {0x010c8e, 0x010cce},
+    {0x001fa9, 0x001fa1},
+    {0x001f2c, 0x001f24},
+    {0x0004f0, 0x0004f1},
+    {0x001f89, 0x001f81},
+    {0x000132, 0x000133},
+    {0x000556, 0x000586},
+    {0x001e92, 0x001e93},
+    {0x00a752, 0x00a753},
+    {0x00020e, 0x00020f},
+    {0x0013f2, 0x0013fa},
+    {0x00a7c4, 0x00a794},
+    {0x001f5f, 0x001f57},
+    {0x0010ab, 0x002d0b},
+    {0x000120, 0x000121},
+    {0x000102, 0x000103},
+    {0x001e64, 0x001e65},
+    {0x002167, 0x002177},
+    {0x0104c1, 0x0104e9},
+    {0x0024b7, 0x0024d1},
+    {0x001ee0, 0x001ee1},
+    {0x0001cd, 0x0001ce},
+    {0x001e34, 0x001e35},
+    {0x0104c6, 0x0104ee},
+    {0x00016c, 0x00016d},
+    {0x00a764, 0x00a765},
+    {0x002cda, 0x002cdb},
+    {0x01041c, 0x010444},
+    {0x010426, 0x01044e},
+    {0x001e8c, 0x001e8d},
+    {0x010408, 0x010430},
+    {0x01e90b, 0x01e92d},
+    {0x0010ba, 0x002d1a},
+    {0x0013ea, 0x00abba},
+    {0x00a654, 0x00a655},
+    {0x002c98, 0x002c99},
+    {0x0104d3, 0x0104fb},
+    {0x001ef8, 0x001ef9},
+    {0x0004a8, 0x0004a9},
+    {0x00a79a, 0x00a79b},
+    {0x0004b6, 0x0004b7},
+    {0x00ff2d, 0x00ff4d},
+    {0x0010a2, 0x002d02},
+    {0x0010b9, 0x002d19},
+    {0x000478, 0x000479},
+    {0x00ff24, 0x00ff44},
+    {0x001eae, 0x001eaf},
+    {0x001eca, 0x001ecb},
+    {0x001f99, 0x001f91},
+    {0x000045, 0x000065},
+    {0x00054d, 0x00057d},
+    {0x000408, 0x000458},
+    {0x001e0e, 0x001e0f},
+    {0x0000c0, 0x0000e0},
+    {0x0003e6, 0x0003e7},
+    {0x0118b8, 0x0118d8},
+    {0x000200, 0x000201},
+    {0x001f49, 0x001f41},
+    {0x00010a, 0x00010b},
+    {0x00a642, 0x00a643},
+    {0x001fba, 0x001f70},
+    {0x00051c, 0x00051d},
+    {0x0000c6, 0x0000e6},
+    {0x0024bd, 0x0024d7},
+    {0x000423, 0x000443},
+    {0x001f59, 0x001f51},
+    {0x001fbb, 0x001f71},
+    {0x000428, 0x000448},
+    {0x001f9b, 0x001f93},
+    {0x010425, 0x01044d},
+    {0x010423, 0x01044b},
+    {0x00004e, 0x00006e},
+    {0x0010bc, 0x002d1c},
+    {0x010410, 0x010438},
+    {0x001cac, 0x0010ec},
+    {0x000536, 0x000566},
+    {0x001ef6, 0x001ef7},
+    {0x0010af, 0x002d0f},
+    {0x00a73e, 0x00a73f},
+    {0x002c2b, 0x002c5b},
+    {0x001e6a, 0x001e6b},
+    {0x0000c9, 0x0000e9},
+    {0x0013b3, 0x00ab83},
+    {0x0104c5, 0x0104ed},
+    {0x0024c6, 0x0024e0},
+    {0x001fae, 0x001fa6},
+    {0x00041f, 0x00043f},
+    {0x00ff2c, 0x00ff4c},
+    {0x002c6b, 0x002c6c},
+    {0x000394, 0x0003b4},
+    {0x001ea6, 0x001ea7},
+    {0x00a7d0, 0x00a7d1},
+    {0x00013d, 0x00013e},
+    {0x0004f4, 0x0004f5},
+    {0x001fbc, 0x001fb3},
+    {0x00054a, 0x00057a},
+    {0x001fe8, 0x001fe0},
+    {0x001f6d, 0x001f65},
+    {0x01e90a, 0x01e92c},
+    {0x00a656, 0x00a657},
+    {0x0118a0, 0x0118c0},
+    {0x0013a0, 0x00ab70},
+    {0x0010a5, 0x002d05},
+    {0x0013d6, 0x00aba6},
+    {0x001e60, 0x001e61},
+    {0x00a7b1, 0x000287},
+    {0x00042d, 0x00044d},
+    {0x001fab, 0x001fa3},
+    {0x00a786, 0x00a787},
+    {0x01e920, 0x01e942},
+    {0x0001c7, 0x0001c9},
+    {0x0000c8, 0x0000e8},
+    {0x016e48, 0x016e68},
+    {0x010588, 0x0105af},
+    {0x0118bd, 0x0118dd},
+    {0x0001b1, 0x00028a},
+    {0x000136, 0x000137},
+    {0x00a652, 0x00a653},
+    {0x0013a5, 0x00ab75},
+    {0x001e86, 0x001e87},
+    {0x001e36, 0x001e37},
+    {0x0003aa, 0x0003ca},
+    {0x0013f1, 0x0013f9},
+    {0x001e70, 0x001e71},
+    {0x010ca3, 0x010ce3},
+    {0x00a7a8, 0x00a7a9},
+    {0x0004e2, 0x0004e3},
+    {0x0004f6, 0x0004f7},
+    {0x0004a0, 0x0004a1},
+    {0x00a640, 0x00a641},
+    {0x00ff34, 0x00ff54},
+    {0x0013b7, 0x00ab87},
+    {0x01e90d, 0x01e92f},
+    {0x00a68c, 0x00a68d},
+    {0x00ff28, 0x00ff48},
+    {0x000145, 0x000146},
+    {0x0104be, 0x0104e6},
+    {0x0001cf, 0x0001d0},
+    {0x01e918, 0x01e93a},
+    {0x002ccc, 0x002ccd},
+    {0x001e18, 0x001e19},
+    {0x01e912, 0x01e934},
+    {0x000541, 0x000571},
+    {0x00a7b8, 0x00a7b9},
+    {0x00047c, 0x00047d},
+    {0x01e911, 0x01e933},
+    {0x0013de, 0x00abae},
+    {0x002ca0, 0x002ca1},
+    {0x016e5f, 0x016e7f},
+    {0x0001e4, 0x0001e5},
+    {0x0024cc, 0x0024e6},
+    {0x0104b6, 0x0104de},
+    {0x0003ea, 0x0003eb},
+    {0x0104b0, 0x0104d8},
+    {0x000500, 0x000501},
+    {0x01e900, 0x01e922},
+    {0x00a7d6, 0x00a7d7},
+    {0x00038f, 0x0003ce},
+    {0x001f0e, 0x001f06},
+    {0x000404, 0x000454},
+    {0x000048, 0x000068},
+    {0x00012c, 0x00012d},
+    {0x002cc4, 0x002cc5},
+    {0x00a758, 0x00a759},
+    {0x002c60, 0x002c61},
+    {0x000208, 0x000209},
+    {0x0118ae, 0x0118ce},
+    {0x001edc, 0x001edd},
+    {0x00a74c, 0x00a74d},
+    {0x00a742, 0x00a743},
+    {0x0001a6, 0x000280},
+    {0x0010aa, 0x002d0a},
+    {0x001fad, 0x001fa5},
+    {0x0013c2, 0x00ab92},
+    {0x002c84, 0x002c85},
+    {0x002c09, 0x002c39},
+    {0x0013ae, 0x00ab7e},
+    {0x002c72, 0x002c73},
+    {0x01058a, 0x0105b1},
+    {0x0000d1, 0x0000f1},
+    {0x000403, 0x000453},
+    {0x010590, 0x0105b7},
+    {0x010418, 0x010440},
+    {0x001c9c, 0x0010dc},
+    {0x00a7c5, 0x000282},
+    {0x000372, 0x000373},
+    {0x0004cd, 0x0004ce},
+    {0x01e905, 0x01e927},
+    {0x0013a3, 0x00ab73},
+    {0x002c27, 0x002c57},
+    {0x002c23, 0x002c53},
+    {0x00052e, 0x00052f},
+    {0x0104cd, 0x0104f5},
+    {0x00a796, 0x00a797},
+    {0x001cb0, 0x0010f0},
+    {0x0001d9, 0x0001da},
+    {0x0003ab, 0x0003cb},
+    {0x00015c, 0x00015d},
+    {0x00023d, 0x00019a},
+    {0x002c02, 0x002c32},
+    {0x002c24, 0x002c54},
+    {0x010427, 0x01044f},
+    {0x001f8b, 0x001f83},
+    {0x00a768, 0x00a769},
+    {0x010407, 0x01042f},
+    {0x00019c, 0x00026f},
+    {0x001e90, 0x001e91},
+    {0x000210, 0x000211},
+    {0x00a65e, 0x00a65f},
+    {0x001fdb, 0x001f77},
+    {0x001eac, 0x001ead},
+    {0x001efe, 0x001eff},
+    {0x000181, 0x000253},
+    {0x00a7a4, 0x00a7a5},
+    {0x010c9b, 0x010cdb},
+    {0x010c99, 0x010cd9},
+    {0x000516, 0x000517},
+    {0x0024ba, 0x0024d4},
+    {0x010c85, 0x010cc5},
+    {0x000248, 0x000249},
+    {0x016e44, 0x016e64},
+    {0x0000d9, 0x0000f9},
+    {0x00004f, 0x00006f},
+    {0x0004da, 0x0004db},
+    {0x0118b5, 0x0118d5},
+    {0x0000c5, 0x0000e5},
+    {0x00ff2a, 0x00ff4a},
+    {0x0118bb, 0x0118db},
+    {0x002cc6, 0x002cc7},
+    {0x002c9a, 0x002c9b},
+    {0x01e919, 0x01e93b},
+    {0x0013ee, 0x00abbe},
+    {0x002c14, 0x002c44},
+    {0x0013e8, 0x00abb8},
+    {0x0010a6, 0x002d06},
+    {0x0001f2, 0x0001f3},
+    {0x001e1a, 0x001e1b},
+    {0x00042f, 0x00044f},
+    {0x010c92, 0x010cd2},
+    {0x0010b6, 0x002d16},
+    {0x0001db, 0x0001dc},
+    {0x016e43, 0x016e63},
+    {0x000419, 0x000439},
+    {0x0004fa, 0x0004fb},
+    {0x002c6f, 0x000250},
+    {0x0003ee, 0x0003ef},
+    {0x000057, 0x000077},
+    {0x010587, 0x0105ae},
+    {0x0010a4, 0x002d04},
+    {0x01e91c, 0x01e93e},
+    {0x01e91a, 0x01e93c},
+    {0x0001a9, 0x000283},
+    {0x001e0c, 0x001e0d},
+    {0x00a746, 0x00a747},
+    {0x0003d8, 0x0003d9},
+    {0x0003e2, 0x0003e3},
+    {0x002ca8, 0x002ca9},
+    {0x00a79c, 0x00a79d},
+    {0x0013d1, 0x00aba1},
+    {0x00051e, 0x00051f},
+    {0x002caa, 0x002cab},
+    {0x0024bf, 0x0024d9},
+    {0x0013bc, 0x00ab8c},
+    {0x0013ad, 0x00ab7d},
+    {0x001e46, 0x001e47},
+    {0x00a7c7, 0x00a7c8},
+    {0x010570, 0x010597},
+    {0x00ff30, 0x00ff50},
+    {0x00a76a, 0x00a76b},
+    {0x0104cb, 0x0104f3},
+    {0x010420, 0x010448},
+    {0x010412, 0x01043a},
+    {0x000462, 0x000463},
+    {0x00a68a, 0x00a68b},
+    {0x001e80, 0x001e81},
+    {0x001ca9, 0x0010e9},
+    {0x010cb1, 0x010cf1},
+    {0x0010ad, 0x002d0d},
+    {0x00a7a6, 0x00a7a7},
+    {0x001f4d, 0x001f45},
+    {0x0004b0, 0x0004b1},
+    {0x00a7a0, 0x00a7a1},
+    {0x0013c9, 0x00ab99},
+    {0x001e52, 0x001e53},
+    {0x002c11, 0x002c41},
+    {0x000158, 0x000159},
+    {0x0003ec, 0x0003ed},
+    {0x0118b7, 0x0118d7},
+    {0x00040d, 0x00045d},
+    {0x0003fe, 0x00037c},
+    {0x00013f, 0x000140},
+    {0x01057c, 0x0105a3},
+    {0x000049, 0x000069},
+    {0x00a7b4, 0x00a7b5},
+    {0x002cbe, 0x002cbf},
+    {0x00a74e, 0x00a74f},
+    {0x0003e0, 0x0003e1},
+    {0x0000c2, 0x0000e2},
+    {0x000114, 0x000115},
+    {0x0003cf, 0x0003d7},
+    {0x00018e, 0x0001dd},
+    {0x001faa, 0x001fa2},
+    {0x00a74a, 0x00a74b},
+    {0x0004aa, 0x0004ab},
+    {0x0104c0, 0x0104e8},
+    {0x000164, 0x000165},
+    {0x000510, 0x000511},
+    {0x0013bd, 0x00ab8d},
+    {0x000418, 0x000438},
+    {0x00039f, 0x0003bf},
+    {0x00014e, 0x00014f},
+    {0x0000d3, 0x0000f3},
+    {0x001ed2, 0x001ed3},
+    {0x0001b3, 0x0001b4},
+    {0x0000cd, 0x0000ed},
+    {0x010574, 0x01059b},
+    {0x000042, 0x000062},
+    {0x0118b3, 0x0118d3},
+    {0x000470, 0x000471},
+    {0x000544, 0x000574},
+    {0x000189, 0x000256},
+    {0x000170, 0x000171},
+    {0x0013e3, 0x00abb3},
+    {0x0001ee, 0x0001ef},
+    {0x001e42, 0x001e43},
+    {0x0001af, 0x0001b0},
+    {0x002c94, 0x002c95},
+    {0x00016e, 0x00016f},
+    {0x0000d2, 0x0000f2},
+    {0x001e24, 0x001e25},
+    {0x002c96, 0x002c97},
+    {0x000413, 0x000433},
+    {0x000398, 0x0003b8},
+    {0x0004f2, 0x0004f3},
+    {0x001ee2, 0x001ee3},
+    {0x002c29, 0x002c59},
+    {0x001cb4, 0x0010f4},
+    {0x002c0d, 0x002c3d},
+    {0x00018f, 0x000259},
+    {0x0118af, 0x0118cf},
+    {0x0004be, 0x0004bf},
+    {0x00020c, 0x00020d},
+    {0x001cbe, 0x0010fe},
+    {0x002c90, 0x002c91},
+    {0x010592, 0x0105b9},
+    {0x010c9e, 0x010cde},
+    {0x00a72a, 0x00a72b},
+    {0x0010c7, 0x002d27},
+    {0x001e4e, 0x001e4f},
+    {0x016e4d, 0x016e6d},
+    {0x0024b8, 0x0024d2},
+    {0x0003a7, 0x0003c7},
+    {0x00a7f5, 0x00a7f6},
+    {0x001f9c, 0x001f94},
+    {0x001ca3, 0x0010e3},
+    {0x0000cb, 0x0000eb},
+    {0x00a682, 0x00a683},
+    {0x01057e, 0x0105a5},
+    {0x001f0b, 0x001f03},
+    {0x0118bc, 0x0118dc},
+    {0x01040c, 0x010434},
+    {0x001e14, 0x001e15},
+    {0x0010bd, 0x002d1d},
+    {0x010cb0, 0x010cf0},
+    {0x0004c3, 0x0004c4},
+    {0x0004c7, 0x0004c8},
+    {0x00a698, 0x00a699},
+    {0x0013d9, 0x00aba9},
+    {0x0001f1, 0x0001f3},
+    {0x0000cc, 0x0000ec},
+    {0x016e58, 0x016e78},
+    {0x0013c3, 0x00ab93},
+    {0x010c83, 0x010cc3},
+    {0x001ec4, 0x001ec5},
+    {0x001e3c, 0x001e3d},
+    {0x00a724, 0x00a725},
+    {0x0000d5, 0x0000f5},
+    {0x00038e, 0x0003cd},
+    {0x001eea, 0x001eeb},
+    {0x0004e6, 0x0004e7},
+    {0x010c89, 0x010cc9},
+    {0x00046a, 0x00046b},
+    {0x000376, 0x000377},
+    {0x002cc0, 0x002cc1},
+    {0x002c2c, 0x002c5c},
+    {0x0118ac, 0x0118cc},
+    {0x00a738, 0x00a739},
+    {0x000547, 0x000577},
+    {0x0013a4, 0x00ab74},
+    {0x00a732, 0x00a733},
+    {0x0010a0, 0x002d00},
+    {0x00018a, 0x000257},
+    {0x001e3e, 0x001e3f},
+    {0x016e53, 0x016e73},
+    {0x0104b9, 0x0104e1},
+    {0x00050a, 0x00050b},
+    {0x002c7f, 0x000240},
+    {0x000047, 0x000067},
+    {0x010595, 0x0105bc},
+    {0x001eaa, 0x001eab},
+    {0x010584, 0x0105ab},
+    {0x000052, 0x000072},
+    {0x0001ac, 0x0001ad},
+    {0x0013b5, 0x00ab85},
+    {0x002ceb, 0x002cec},
+    {0x0003e8, 0x0003e9},
+    {0x001c9e, 0x0010de},
+    {0x002cb8, 0x002cb9},
+    {0x000534, 0x000564},
+    {0x001c98, 0x0010d8},
+    {0x0013e1, 0x00abb1},
+    {0x00ff26, 0x00ff46},
+    {0x010c9d, 0x010cdd},
+    {0x00a740, 0x00a741},
+    {0x00016a, 0x00016b},
+    {0x00049e, 0x00049f},
+    {0x010c87, 0x010cc7},
+    {0x010c84, 0x010cc4},
+    {0x0104b1, 0x0104d9},
+    {0x000538, 0x000568},
+    {0x001e68, 0x001e69},
+    {0x001ea8, 0x001ea9},
+    {0x000391, 0x0003b1},
+    {0x000472, 0x000473},
+    {0x001c91, 0x0010d1},
+    {0x000220, 0x00019e},
+    {0x00039e, 0x0003be},
+    {0x0001f8, 0x0001f9},
+    {0x00004d, 0x00006d},
+    {0x010c8f, 0x010ccf},
+    {0x0013e0, 0x00abb0},
+    {0x010cab, 0x010ceb},
+    {0x0010a8, 0x002d08},
+    {0x00017b, 0x00017c},
+    {0x0104bc, 0x0104e4},
+    {0x01e903, 0x01e925},
+    {0x0024c8, 0x0024e2},
+    {0x001e50, 0x001e51},
+    {0x0000da, 0x0000fa},
+    {0x010c80, 0x010cc0},
+    {0x00050c, 0x00050d},
+    {0x0001ca, 0x0001cc},
+    {0x010ca7, 0x010ce7},
+    {0x01058c, 0x0105b3},
+    {0x000059, 0x000079},
+    {0x01057a, 0x0105a1},
+    {0x01041b, 0x010443},
+    {0x001ca1, 0x0010e1},
+    {0x00a644, 0x00a645},
+    {0x010406, 0x01042e},
+    {0x00012e, 0x00012f},
+    {0x000152, 0x000153},
+    {0x001c9f, 0x0010df},
+    {0x001c9d, 0x0010dd},
+    {0x000405, 0x000455},
+    {0x0010a1, 0x002d01},
+    {0x000194, 0x000263},
+    {0x01e913, 0x01e935},
+    {0x00a798, 0x00a799},
+    {0x0024c1, 0x0024db},
+    {0x002c18, 0x002c48},
+    {0x0004ba, 0x0004bb},
+    {0x0013f3, 0x0013fb},
+    {0x00a68e, 0x00a68f},
+    {0x000496, 0x000497},
+    {0x0000cf, 0x0000ef},
+    {0x001f8d, 0x001f85},
+    {0x00040b, 0x00045b},
+    {0x002c64, 0x00027d},
+    {0x000197, 0x000268},
+    {0x0013ef, 0x00abbf},
+    {0x01e916, 0x01e938},
+    {0x001e82, 0x001e83},
+    {0x001caa, 0x0010ea},
+    {0x00a690, 0x00a691},
+    {0x00a64e, 0x00a64f},
+    {0x010c97, 0x010cd7},
+    {0x0000d0, 0x0000f0},
+    {0x001f39, 0x001f31},
+    {0x00a7d8, 0x00a7d9},
+    {0x001e58, 0x001e59},
+    {0x0024ca, 0x0024e4},
+    {0x0024bb, 0x0024d5},
+    {0x010c91, 0x010cd1},
+    {0x0001d1, 0x0001d2},
+    {0x001f9e, 0x001f96},
+    {0x00040e, 0x00045e},
+    {0x0001bc, 0x0001bd},
+    {0x000141, 0x000142},
+    {0x002c63, 0x001d7d},
+    {0x001e66, 0x001e67},
+    {0x00004a, 0x00006a},
+    {0x002cc8, 0x002cc9},
+    {0x000550, 0x000580},
+    {0x00a7bc, 0x00a7bd},
+    {0x0013f0, 0x0013f8},
+    {0x002cb4, 0x002cb5},
+    {0x00a73c, 0x00a73d},
+    {0x00a73a, 0x00a73b},
+    {0x010caf, 0x010cef},
+    {0x001f3d, 0x001f35},
+    {0x002c22, 0x002c52},
+    {0x001c97, 0x0010d7},
+    {0x0013c5, 0x00ab95},
+    {0x000512, 0x000513},
+    {0x00a77e, 0x00a77f},
+    {0x002c0b, 0x002c3b},
+    {0x0013af, 0x00ab7f},
+    {0x002c21, 0x002c51},
+    {0x002c70, 0x000252},
+    {0x000230, 0x000231},
+    {0x0001b5, 0x0001b6},
+    {0x001ffa, 0x001f7c},
+    {0x002c88, 0x002c89},
+    {0x000044, 0x000064},
+    {0x0004d2, 0x0004d3},
+    {0x00a75a, 0x00a75b},
+    {0x001f6a, 0x001f62},
+    {0x0010b5, 0x002d15},
+    {0x001e74, 0x001e75},
+    {0x001eda, 0x001edb},
+    {0x000178, 0x0000ff},
+    {0x0104d0, 0x0104f8},
+    {0x000520, 0x000521},
+    {0x000196, 0x000269},
+    {0x00042b, 0x00044b},
+    {0x0104bb, 0x0104e3},
+    {0x002c92, 0x002c93},
+    {0x016e4b, 0x016e6b},
+    {0x000415, 0x000435},
+    {0x001cb8, 0x0010f8},
+    {0x001e5e, 0x001e5f},
+    {0x010586, 0x0105ad},
+    {0x001efc, 0x001efd},
+    {0x001e20, 0x001e21},
+    {0x002cd0, 0x002cd1},
+    {0x000549, 0x000579},
+    {0x00038a, 0x0003af},
+    {0x0118a3, 0x0118c3},
+    {0x000543, 0x000573},
+    {0x0010b2, 0x002d12},
+    {0x00a65a, 0x00a65b},
+    {0x001fcb, 0x001f75},
+    {0x002ca4, 0x002ca5},
+    {0x000172, 0x000173},
+    {0x00014a, 0x00014b},
+    {0x00023b, 0x00023c},
+    {0x00a792, 0x00a793},
+    {0x016e4e, 0x016e6e},
+    {0x00048c, 0x00048d},
+    {0x0003a6, 0x0003c6},
+    {0x001f9d, 0x001f95},
+    {0x0001d7, 0x0001d8},
+    {0x00a686, 0x00a687},
+    {0x001e2e, 0x001e2f},
+    {0x0104c8, 0x0104f0},
+    {0x000552, 0x000582},
+    {0x0000c4, 0x0000e4},
+    {0x00046e, 0x00046f},
+    {0x00022a, 0x00022b},
+    {0x0010bf, 0x002d1f},
+    {0x00a65c, 0x00a65d},
+    {0x001e7a, 0x001e7b},
+    {0x0010b7, 0x002d17},
+    {0x0001f7, 0x0001bf},
+    {0x0013db, 0x00abab},
+    {0x0024cd, 0x0024e7},
+    {0x001ee6, 0x001ee7},
+    {0x001e1c, 0x001e1d},
+    {0x000168, 0x000169},
+    {0x000166, 0x000167},
+    {0x010c82, 0x010cc2},
+    {0x000554, 0x000584},
+    {0x002c08, 0x002c38},
+    {0x0104c2, 0x0104ea},
+    {0x001e44, 0x001e45},
+    {0x000407, 0x000457},
+    {0x001e40, 0x001e41},
+    {0x00013b, 0x00013c},
+    {0x002164, 0x002174},
+    {0x00a660, 0x00a661},
+    {0x0001a0, 0x0001a1},
+    {0x002cc2, 0x002cc3},
+    {0x0010b8, 0x002d18},
+    {0x001e76, 0x001e77},
+    {0x001cab, 0x0010eb},
+    {0x010ca6, 0x010ce6},
+    {0x010ca5, 0x010ce5},
+    {0x0013d5, 0x00aba5},
+    {0x002126, 0x0003c9},
+    {0x00024e, 0x00024f},
+    {0x016e55, 0x016e75},
+    {0x00ff3a, 0x00ff5a},
+    {0x001e4a, 0x001e4b},
+    {0x001ec0, 0x001ec1},
+    {0x0013a1, 0x00ab71},
+    {0x0001c4, 0x0001c6},
+    {0x002c6d, 0x000251},
+    {0x001f8f, 0x001f87},
+    {0x001f8e, 0x001f86},
+    {0x001ff8, 0x001f78},
+    {0x0004ec, 0x0004ed},
+    {0x01041e, 0x010446},
+    {0x0004dc, 0x0004dd},
+    {0x001cad, 0x0010ed},
+    {0x0004cb, 0x0004cc},
+    {0x001e2a, 0x001e2b},
+    {0x001c9a, 0x0010da},
+    {0x002c2f, 0x002c5f},
+    {0x00017d, 0x00017e},
+    {0x0001ec, 0x0001ed},
+    {0x001fb9, 0x001fb1},
+    {0x000187, 0x000188},
+    {0x00ff2b, 0x00ff4b},
+    {0x002165, 0x002175},
+    {0x001f38, 0x001f30},
+    {0x00039c, 0x0003bc},
+    {0x0024b6, 0x0024d0},
+    {0x0003de, 0x0003df},
+    {0x000395, 0x0003b5},
+    {0x010424, 0x01044c},
+    {0x001e2c, 0x001e2d},
+    {0x001f88, 0x001f80},
+    {0x0118bf, 0x0118df},
+    {0x01040f, 0x010437},
+    {0x000551, 0x000581},
+    {0x001efa, 0x001efb},
+    {0x00a7ba, 0x00a7bb},
+    {0x016e45, 0x016e65},
+    {0x002c17, 0x002c47},
+    {0x001fc9, 0x001f73},
+    {0x0013d0, 0x00aba0},
+    {0x001ca8, 0x0010e8},
+    {0x0024cb, 0x0024e5},
+    {0x0013b0, 0x00ab80},
+    {0x001ee4, 0x001ee5},
+    {0x016e49, 0x016e69},
+    {0x016e47, 0x016e67},
+    {0x00a696, 0x00a697},
+    {0x001c99, 0x0010d9},
+    {0x0013bb, 0x00ab8b},
+    {0x00ff25, 0x00ff45},
+    {0x01057d, 0x0105a4},
+    {0x001ea0, 0x001ea1},
+    {0x0004e8, 0x0004e9},
+    {0x010577, 0x01059e},
+    {0x0118b9, 0x0118d9},
+    {0x00021c, 0x00021d},
+    {0x001e10, 0x001e11},
+    {0x00022c, 0x00022d},
+    {0x00a7c0, 0x00a7c1},
+    {0x00018b, 0x00018c},
+    {0x00a69a, 0x00a69b},
+    {0x0010a3, 0x002d03},
+    {0x0104d2, 0x0104fa},
+    {0x000522, 0x000523},
+    {0x00a744, 0x00a745},
+    {0x00042c, 0x00044c},
+    {0x001f3f, 0x001f37},
+    {0x00a79e, 0x00a79f},
+    {0x002c80, 0x002c81},
+    {0x002c07, 0x002c37},
+    {0x0001c5, 0x0001c6},
+    {0x002168, 0x002178},
+    {0x0013a7, 0x00ab77},
+    {0x000054, 0x000074},
+    {0x01058f, 0x0105b6},
+    {0x000468, 0x000469},
+    {0x010572, 0x010599},
+    {0x002162, 0x002172},
+    {0x001e84, 0x001e85},
+    {0x000198, 0x000199},
+    {0x0001ea, 0x0001eb},
+    {0x0010b1, 0x002d11},
+    {0x000190, 0x00025b},
+    {0x002ca6, 0x002ca7},
+    {0x000241, 0x000242},
+    {0x001e5c, 0x001e5d},
+    {0x002c1a, 0x002c4a},
+    {0x0024be, 0x0024d8},
+    {0x010c8a, 0x010cca},
+    {0x001caf, 0x0010ef},
+    {0x00a7c9, 0x00a7ca},
+    {0x000422, 0x000442},
+    {0x000100, 0x000101},
+    {0x002166, 0x002176},
+    {0x000143, 0x000144},
+    {0x00a684, 0x00a685},
+    {0x0118aa, 0x0118ca},
+    {0x00037f, 0x0003f3},
+    {0x002cca, 0x002ccb},
+    {0x01e907, 0x01e929},
+    {0x010c81, 0x010cc1},
+    {0x000193, 0x000260},
+    {0x001ca7, 0x0010e7},
+    {0x010cae, 0x010cee},
+    {0x00a72e, 0x00a72f},
+    {0x00052a, 0x00052b},
+    {0x0003f9, 0x0003f2},
+    {0x002c26, 0x002c56},
+    {0x010ca0, 0x010ce0},
+    {0x0013c7, 0x00ab97},
+    {0x000514, 0x000515},
+    {0x00ff2f, 0x00ff4f},
+    {0x00041e, 0x00043e},
+    {0x0003a3, 0x0003c3},
+    {0x0003a0, 0x0003c0},
+    {0x00216d, 0x00217d},
+    {0x001cbd, 0x0010fd},
+    {0x002c2e, 0x002c5e},
+    {0x01041d, 0x010445},
+    {0x00a760, 0x00a761},
+    {0x01e906, 0x01e928},
+    {0x00ff29, 0x00ff49},
+    {0x001f6e, 0x001f66},
+    {0x001f6c, 0x001f64},
+    {0x00054f, 0x00057f},
+    {0x0004e4, 0x0004e5},
+    {0x00049a, 0x00049b},
+    {0x00a736, 0x00a737},
+    {0x000524, 0x000525},
+    {0x0013d3, 0x00aba3},
+    {0x002c1e, 0x002c4e},
+    {0x001f4c, 0x001f44},
+    {0x0104bd, 0x0104e5},
+    {0x00041c, 0x00043c},
+    {0x000492, 0x000493},
+    {0x000417, 0x000437},
+    {0x001eb0, 0x001eb1},
+    {0x00ff22, 0x00ff42},
+    {0x00047e, 0x00047f},
+    {0x010585, 0x0105ac},
+    {0x0118ba, 0x0118da},
+    {0x002cd2, 0x002cd3},
+    {0x0004e0, 0x0004e1},
+    {0x002c0f, 0x002c3f},
+    {0x001f68, 0x001f60},
+    {0x000460, 0x000461},
+    {0x0003da, 0x0003db},
+    {0x00ff31, 0x00ff51},
+    {0x0013e4, 0x00abb4},
+    {0x001ca2, 0x0010e2},
+    {0x0104ce, 0x0104f6},
+    {0x001ed6, 0x001ed7},
+    {0x0013cf, 0x00ab9f},
+    {0x010c8d, 0x010ccd},
+    {0x0104c4, 0x0104ec},
+    {0x000214, 0x000215},
+    {0x0013b9, 0x00ab89},
+    {0x000420, 0x000440},
+    {0x0000de, 0x0000fe},
+    {0x001e32, 0x001e33},
+    {0x001f8c, 0x001f84},
+    {0x010581, 0x0105a8},
+    {0x00a648, 0x00a649},
+    {0x00019f, 0x000275},
+    {0x0001a7, 0x0001a8},
+    {0x002cd4, 0x002cd5},
+    {0x0010c1, 0x002d21},
+    {0x001fea, 0x001f7a},
+    {0x001e7e, 0x001e7f},
+    {0x001f9f, 0x001f97},
+    {0x0118a2, 0x0118c2},
+    {0x002cba, 0x002cbb},
+    {0x001f28, 0x001f20},
+    {0x016e5e, 0x016e7e},
+    {0x001e56, 0x001e57},
+    {0x0024bc, 0x0024d6},
+    {0x0001e0, 0x0001e1},
+    {0x010409, 0x010431},
+    {0x000555, 0x000585},
+    {0x0013b1, 0x00ab81},
+    {0x001f0a, 0x001f02},
+    {0x01e910, 0x01e932},
+    {0x000232, 0x000233},
+    {0x001e72, 0x001e73},
+    {0x00a662, 0x00a663},
+    {0x010579, 0x0105a0},
+    {0x001e22, 0x001e23},
+    {0x001cb7, 0x0010f7},
+    {0x000126, 0x000127},
+    {0x0010bb, 0x002d1b},
+    {0x000116, 0x000117},
+    {0x0118a1, 0x0118c1},
+    {0x000112, 0x000113},
+    {0x000533, 0x000563},
+    {0x001ca6, 0x0010e6},
+    {0x016e5c, 0x016e7c},
+    {0x016e59, 0x016e79},
+    {0x016e57, 0x016e77},
+    {0x001ec6, 0x001ec7},
+    {0x00a7ab, 0x00025c},
+    {0x00041b, 0x00043b},
+    {0x0003f4, 0x0003b8},
+    {0x00039d, 0x0003bd},
+    {0x0004f8, 0x0004f9},
+    {0x002c6e, 0x000271},
+    {0x000402, 0x000452},
+    {0x01e91f, 0x01e941},
+    {0x0010cd, 0x002d2d},
+    {0x010c9f, 0x010cdf},
+    {0x000216, 0x000217},
+    {0x00053c, 0x00056c},
+    {0x0010c4, 0x002d24},
+    {0x001e0a, 0x001e0b},
+    {0x0010b3, 0x002d13},
+    {0x00a7ac, 0x000261},
+    {0x00a7aa, 0x000266},
+    {0x001ed8, 0x001ed9},
+    {0x00048e, 0x00048f},
+    {0x001e5a, 0x001e5b},
+    {0x001cb6, 0x0010f6},
+    {0x000426, 0x000446},
+    {0x0104b7, 0x0104df},
+    {0x0001d3, 0x0001d4},
+    {0x01e904, 0x01e926},
+    {0x002c01, 0x002c31},
+    {0x00023a, 0x002c65},
+    {0x002ce2, 0x002ce3},
+    {0x001f98, 0x001f90},
+    {0x0004d6, 0x0004d7},
+    {0x001f0f, 0x001f07},
+    {0x001e94, 0x001e95},
+    {0x000055, 0x000075},
+    {0x000222, 0x000223},
+    {0x0003e4, 0x0003e5},
+    {0x001ca0, 0x0010e0},
+    {0x001e02, 0x001e03},
+    {0x0010ac, 0x002d0c},
+    {0x000546, 0x000576},
+    {0x00a728, 0x00a729},
+    {0x010c9a, 0x010cda},
+    {0x0013c0, 0x00ab90},
+    {0x0000dd, 0x0000fd},
+    {0x0013ba, 0x00ab8a},
+    {0x001ebe, 0x001ebf},
+    {0x0024c4, 0x0024de},
+    {0x000154, 0x000155},
+    {0x002c75, 0x002c76},
+    {0x0001c8, 0x0001c9},
+    {0x000128, 0x000129},
+    {0x0004d4, 0x0004d5},
+    {0x0004ea, 0x0004eb},
+    {0x0000c3, 0x0000e3},
+    {0x001cae, 0x0010ee},
+    {0x00a66c, 0x00a66d},
+    {0x001e12, 0x001e13},
+    {0x001cb1, 0x0010f1},
+    {0x0118a4, 0x0118c4},
+    {0x0013ab, 0x00ab7b},
+    {0x00052c, 0x00052d},
+    {0x0013e5, 0x00abb5},
+    {0x002c25, 0x002c55},
+    {0x016e5b, 0x016e7b},
+    {0x002c1f, 0x002c4f},
+    {0x00042e, 0x00044e},
+    {0x0104bf, 0x0104e7},
+    {0x0013c1, 0x00ab91},
+    {0x000494, 0x000495},
+    {0x016e42, 0x016e62},
+    {0x002c06, 0x002c36},
+    {0x001f1c, 0x001f14},
+    {0x010589, 0x0105b0},
+    {0x000056, 0x000076},
+    {0x000388, 0x0003ad},
+    {0x0001a4, 0x0001a5},
+    {0x010573, 0x01059a},
+    {0x002cce, 0x002ccf},
+    {0x001e88, 0x001e89},
+    {0x002cb2, 0x002cb3},
+    {0x0013e9, 0x00abb9},
+    {0x0013e6, 0x00abb6},
+    {0x0118b2, 0x0118d2},
+    {0x000531, 0x000561},
+    {0x000182, 0x000183},
+    {0x000106, 0x000107},
+    {0x0104cc, 0x0104f4},
+    {0x0004a2, 0x0004a3},
+    {0x000427, 0x000447},
+    {0x00ff36, 0x00ff56},
+    {0x0001d5, 0x0001d6},
+    {0x0000db, 0x0000fb},
+    {0x00a748, 0x00a749},
+    {0x000411, 0x000431},
+    {0x002c69, 0x002c6a},
+    {0x002c67, 0x002c68},
+    {0x002161, 0x002171},
+    {0x0003fa, 0x0003fb},
+    {0x001e28, 0x001e29},
+    {0x01e909, 0x01e92b},
+    {0x0013a6, 0x00ab76},
+    {0x0013f4, 0x0013fc},
+    {0x00011c, 0x00011d},
+    {0x001fd9, 0x001fd1},
+    {0x0118b4, 0x0118d4},
+    {0x001fec, 0x001fe5},
+    {0x001c93, 0x0010d3},
+    {0x0024cf, 0x0024e9},
+    {0x010c98, 0x010cd8},
+    {0x001ece, 0x001ecf},
+    {0x002c13, 0x002c43},
+    {0x000392, 0x0003b2},
+    {0x00024a, 0x00024b},
+    {0x0003a5, 0x0003c5},
+    {0x0003a1, 0x0003c1},
+    {0x010591, 0x0105b8},
+    {0x000409, 0x000459},
+    {0x01057f, 0x0105a6},
+    {0x0001b7, 0x000292},
+    {0x000535, 0x000565},
+    {0x001f09, 0x001f01},
+    {0x001e8e, 0x001e8f},
+    {0x001fe9, 0x001fe1},
+    {0x001f6f, 0x001f67},
+    {0x0013ed, 0x00abbd},
+    {0x001f2a, 0x001f22},
+    {0x016e4a, 0x016e6a},
+    {0x010ca8, 0x010ce8},
+    {0x001f4b, 0x001f43},
+    {0x001e62, 0x001e63},
+    {0x000176, 0x000177},
+    {0x001feb, 0x001f7b},
+    {0x0001de, 0x0001df},
+    {0x00042a, 0x00044a},
+    {0x001fa8, 0x001fa0},
+    {0x001e54, 0x001e55},
+    {0x001eb2, 0x001eb3},
+    {0x0001b8, 0x0001b9},
+    {0x00005a, 0x00007a},
+    {0x001ffc, 0x001ff3},
+    {0x0013d2, 0x00aba2},
+    {0x01041a, 0x010442},
+    {0x001eec, 0x001eed},
+    {0x002cac, 0x002cad},
+    {0x001ee8, 0x001ee9},
+    {0x010403, 0x01042b},
+    {0x010402, 0x01042a},
+    {0x000202, 0x000203},
+    {0x001c9b, 0x0010db},
+    {0x00010c, 0x00010d},
+    {0x010ca2, 0x010ce2},
+    {0x010419, 0x010441},
+    {0x0104b4, 0x0104dc},
+    {0x002c0e, 0x002c3e},
+    {0x0013bf, 0x00ab8f},
+    {0x0104b8, 0x0104e0},
+};
+
+template <size_t Buckets, size_t Slots>
+constexpr uint32_t case_hash_find(const uint16_t (&seeds)[Buckets],
+                                  const CaseHashEntry (&slots)[Slots],
+                                  uint32_t cp) {
+  const uint32_t h = case_hash_scramble(cp);
+  const uint16_t seed = seeds[case_hash_reduce(h, Buckets)];
+  const CaseHashEntry &entry =
+      slots[case_hash_reduce((h ^ seed) * 0x85EBCA6Bu, Slots)];
+  return entry.from == cp ? entry.to : cp;
+}
+
+constexpr uint32_t case_hash_towupper(uint32_t cp) {
+  return case_hash_find(to_upper_hash_seeds, to_upper_hash_slots, cp);
+}
+
+constexpr uint32_t case_hash_towlower(uint32_t cp) {
+  return case_hash_find(to_lower_hash_seeds, to_lower_hash_slots, cp);
+}
+
+#endif // CASE_MAPPING_HASH_H
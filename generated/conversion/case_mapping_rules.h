@@ -0,0 +1,532 @@
+// Auto-generated by rule_conversion_generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef CASE_MAPPING_RULES_H
+#define CASE_MAPPING_RULES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Case mappings as rules: every (stride_mask + 1)-th codepoint of
+// [first, first + length) maps to codepoint + delta. A codepoint can only
+// fall under the rule starting last at or before it; the index narrows the
+// search for that rule to the few starting around the codepoint's block.
+struct CaseRule {
+  uint32_t first;
+  int32_t delta;
+  uint16_t length;
+  uint16_t stride_mask;
+};
+
+inline constexpr unsigned case_rule_block_bits = 8;
+
+// 200 rules, 491 index blocks
+inline constexpr CaseRule to_upper_rules[201] = {
+    {0x000000, 0, 0, 0},
+    {0x000061, -32, 26, 0},
+    {0x0000b5, 743, 1, 0},
+    {0x0000e0, -32, 23, 0},
+    {0x0000f8, -32, 7, 0},
+    {0x0000ff, 121, 1, 0},
+    {0x000101, -1, 47, 1},
+    {0x000131, -232, 1, 0},
+    {0x000133, -1, 5, 1},
+    {0x00013a, -1, 15, 1},
+    {0x00014b, -1, 45, 1},
+    {0x00017a, -1, 5, 1},
+    {0x00017f, -300, 1, 0},
+    {0x000180, 195, 1, 0},
+    {0x000183, -1, 3, 1},
+    {0x000188, -1, 1, 0},
+    {0x00018c, -1, 1, 0},
+    {0x000192, -1, 1, 0},
+    {0x000195, 97, 1, 0},
+    {0x000199, -1, 1, 0},
+    {0x00019a, 163, 1, 0},
+    {0x00019e, 130, 1, 0},
+    {0x0001a1, -1, 5, 1},
+    {0x0001a8, -1, 1, 0},
+    {0x0001ad, -1, 1, 0},
+    {0x0001b0, -1, 1, 0},
+    {0x0001b4, -1, 3, 1},
+    {0x0001b9, -1, 1, 0},
+    {0x0001bd, -1, 1, 0},
+    {0x0001bf, 56, 1, 0},
+    {0x0001c5, -1, 1, 0},
+    {0x0001c6, -2, 1, 0},
+    {0x0001c8, -1, 1, 0},
+    {0x0001c9, -2, 1, 0},
+    {0x0001cb, -1, 1, 0},
+    {0x0001cc, -2, 1, 0},
+    {0x0001ce, -1, 15, 1},
+    {0x0001dd, -79, 1, 0},
+    {0x0001df, -1, 17, 1},
+    {0x0001f2, -1, 1, 0},
+    {0x0001f3, -2, 1, 0},
+    {0x0001f5, -1, 1, 0},
+    {0x0001f9, -1, 39, 1},
+    {0x000223, -1, 17, 1},
+    {0x00023c, -1, 1, 0},
+    {0x00023f, 10815, 2, 0},
+    {0x000242, -1, 1, 0},
+    {0x000247, -1, 9, 1},
+    {0x000250, 10783, 1, 0},
+    {0x000251, 10780, 1, 0},
+    {0x000252, 10782, 1, 0},
+    {0x000253, -210, 1, 0},
+    {0x000254, -206, 1, 0},
+    {0x000256, -205, 2, 0},
+    {0x000259, -202, 1, 0},
+    {0x00025b, -203, 1, 0},
+    {0x00025c, 42319, 1, 0},
+    {0x000260, -205, 1, 0},
+    {0x000261, 42315, 1, 0},
+    {0x000263, -207, 1, 0},
+    {0x000265, 42280, 1, 0},
+    {0x000266, 42308, 1, 0},
+    {0x000268, -209, 1, 0},
+    {0x000269, -211, 1, 0},
+    {0x00026a, 42308, 1, 0},
+    {0x00026b, 10743, 1, 0},
+    {0x00026c, 42305, 1, 0},
+    {0x00026f, -211, 1, 0},
+    {0x000271, 10749, 1, 0},
+    {0x000272, -213, 1, 0},
+    {0x000275, -214, 1, 0},
+    {0x00027d, 10727, 1, 0},
+    {0x000280, -218, 1, 0},
+    {0x000282, 42307, 1, 0},
+    {0x000283, -218, 1, 0},
+    {0x000287, 42282, 1, 0},
+    {0x000288, -218, 1, 0},
+    {0x000289, -69, 1, 0},
+    {0x00028a, -217, 2, 0},
+    {0x00028c, -71, 1, 0},
+    {0x000292, -219, 1, 0},
+    {0x00029d, 42261, 1, 0},
+    {0x00029e, 42258, 1, 0},
+    {0x000345, 84, 1, 0},
+    {0x000371, -1, 3, 1},
+    {0x000377, -1, 1, 0},
+    {0x00037b, 130, 3, 0},
+    {0x0003ac, -38, 1, 0},
+    {0x0003ad, -37, 3, 0},
+    {0x0003b1, -32, 17, 0},
+    {0x0003c2, -31, 1, 0},
+    {0x0003c3, -32, 9, 0},
+    {0x0003cc, -64, 1, 0},
+    {0x0003cd, -63, 2, 0},
+    {0x0003d0, -62, 1, 0},
+    {0x0003d1, -57, 1, 0},
+    {0x0003d5, -47, 1, 0},
+    {0x0003d6, -54, 1, 0},
+    {0x0003d7, -8, 1, 0},
+    {0x0003d9, -1, 23, 1},
+    {0x0003f0, -86, 1, 0},
+    {0x0003f1, -80, 1, 0},
+    {0x0003f2, 7, 1, 0},
+    {0x0003f3, -116, 1, 0},
+    {0x0003f5, -96, 1, 0},
+    {0x0003f8, -1, 1, 0},
+    {0x0003fb, -1, 1, 0},
+    {0x000430, -32, 32, 0},
+    {0x000450, -80, 16, 0},
+    {0x000461, -1, 33, 1},
+    {0x00048b, -1, 53, 1},
+    {0x0004c2, -1, 13, 1},
+    {0x0004cf, -15, 1, 0},
+    {0x0004d1, -1, 95, 1},
+    {0x000561, -48, 38, 0},
+    {0x0010d0, 3008, 43, 0},
+    {0x0010fd, 3008, 3, 0},
+    {0x0013f8, -8, 6, 0},
+    {0x001c80, -6254, 1, 0},
+    {0x001c81, -6253, 1, 0},
+    {0x001c82, -6244, 1, 0},
+    {0x001c83, -6242, 2, 0},
+    {0x001c85, -6243, 1, 0},
+    {0x001c86, -6236, 1, 0},
+    {0x001c87, -6181, 1, 0},
+    {0x001c88, 35266, 1, 0},
+    {0x001d79, 35332, 1, 0},
+    {0x001d7d, 3814, 1, 0},
+    {0x001d8e, 35384, 1, 0},
+    {0x001e01, -1, 149, 1},
+    {0x001e9b, -59, 1, 0},
+    {0x001ea1, -1, 95, 1},
+    {0x001f00, 8, 8, 0},
+    {0x001f10, 8, 6, 0},
+    {0x001f20, 8, 8, 0},
+    {0x001f30, 8, 8, 0},
+    {0x001f40, 8, 6, 0},
+    {0x001f51, 8, 7, 1},
+    {0x001f60, 8, 8, 0},
+    {0x001f70, 74, 2, 0},
+    {0x001f72, 86, 4, 0},
+    {0x001f76, 100, 2, 0},
+    {0x001f78, 128, 2, 0},
+    {0x001f7a, 112, 2, 0},
+    {0x001f7c, 126, 2, 0},
+    {0x001f80, 8, 8, 0},
+    {0x001f90, 8, 8, 0},
+    {0x001fa0, 8, 8, 0},
+    {0x001fb0, 8, 2, 0},
+    {0x001fb3, 9, 1, 0},
+    {0x001fbe, -7205, 1, 0},
+    {0x001fc3, 9, 1, 0},
+    {0x001fd0, 8, 2, 0},
+    {0x001fe0, 8, 2, 0},
+    {0x001fe5, 7, 1, 0},
+    {0x001ff3, 9, 1, 0},
+    {0x00214e, -28, 1, 0},
+    {0x002170, -16, 16, 0},
+    {0x002184, -1, 1, 0},
+    {0x0024d0, -26, 26, 0},
+    {0x002c30, -48, 48, 0},
+    {0x002c61, -1, 1, 0},
+    {0x002c65, -10795, 1, 0},
+    {0x002c66, -10792, 1, 0},
+    {0x002c68, -1, 5, 1},
+    {0x002c73, -1, 1, 0},
+    {0x002c76, -1, 1, 0},
+    {0x002c81, -1, 99, 1},
+    {0x002cec, -1, 3, 1},
+    {0x002cf3, -1, 1, 0},
+    {0x002d00, -7264, 38, 0},
+    {0x002d27, -7264, 1, 0},
+    {0x002d2d, -7264, 1, 0},
+    {0x00a641, -1, 45, 1},
+    {0x00a681, -1, 27, 1},
+    {0x00a723, -1, 13, 1},
+    {0x00a733, -1, 61, 1},
+    {0x00a77a, -1, 3, 1},
+    {0x00a77f, -1, 9, 1},
+    {0x00a78c, -1, 1, 0},
+    {0x00a791, -1, 3, 1},
+    {0x00a794, 48, 1, 0},
+    {0x00a797, -1, 19, 1},
+    {0x00a7b5, -1, 15, 1},
+    {0x00a7c8, -1, 3, 1},
+    {0x00a7d1, -1, 1, 0},
+    {0x00a7d7, -1, 3, 1},
+    {0x00a7f6, -1, 1, 0},
+    {0x00ab53, -928, 1, 0},
+    {0x00ab70, -38864, 80, 0},
+    {0x00ff41, -32, 26, 0},
+    {0x010428, -40, 40, 0},
+    {0x0104d8, -40, 36, 0},
+    {0x010597, -39, 11, 0},
+    {0x0105a3, -39, 15, 0},
+    {0x0105b3, -39, 7, 0},
+    {0x0105bb, -39, 2, 0},
+    {0x010cc0, -64, 51, 0},
+    {0x0118c0, -32, 32, 0},
+    {0x016e60, -32, 32, 0},
+    {0x01e922, -34, 34, 0},
+};
+
+inline constexpr uint8_t to_upper_rule_index[491] = {
+    0, 5, 42, 82, 106, 113, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 116, 116, 116, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 125, 128, 132, 155, 155, 158, 158,
+    158, 159, 159, 159, 159, 159, 159, 159, 159, 170, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 174,
+    187, 187, 187, 187, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 190, 190, 190, 190, 190, 192, 196, 196,
+    196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197,
+    197, 197, 197, 197, 197, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 200,
+};
+
+// 182 rules, 491 index blocks
+inline constexpr CaseRule to_lower_rules[183] = {
+    {0x000000, 0, 0, 0},
+    {0x000041, 32, 26, 0},
+    {0x0000c0, 32, 23, 0},
+    {0x0000d8, 32, 7, 0},
+    {0x000100, 1, 47, 1},
+    {0x000130, -199, 1, 0},
+    {0x000132, 1, 5, 1},
+    {0x000139, 1, 15, 1},
+    {0x00014a, 1, 45, 1},
+    {0x000178, -121, 1, 0},
+    {0x000179, 1, 5, 1},
+    {0x000181, 210, 1, 0},
+    {0x000182, 1, 3, 1},
+    {0x000186, 206, 1, 0},
+    {0x000187, 1, 1, 0},
+    {0x000189, 205, 2, 0},
+    {0x00018b, 1, 1, 0},
+    {0x00018e, 79, 1, 0},
+    {0x00018f, 202, 1, 0},
+    {0x000190, 203, 1, 0},
+    {0x000191, 1, 1, 0},
+    {0x000193, 205, 1, 0},
+    {0x000194, 207, 1, 0},
+    {0x000196, 211, 1, 0},
+    {0x000197, 209, 1, 0},
+    {0x000198, 1, 1, 0},
+    {0x00019c, 211, 1, 0},
+    {0x00019d, 213, 1, 0},
+    {0x00019f, 214, 1, 0},
+    {0x0001a0, 1, 5, 1},
+    {0x0001a6, 218, 1, 0},
+    {0x0001a7, 1, 1, 0},
+    {0x0001a9, 218, 1, 0},
+    {0x0001ac, 1, 1, 0},
+    {0x0001ae, 218, 1, 0},
+    {0x0001af, 1, 1, 0},
+    {0x0001b1, 217, 2, 0},
+    {0x0001b3, 1, 3, 1},
+    {0x0001b7, 219, 1, 0},
+    {0x0001b8, 1, 1, 0},
+    {0x0001bc, 1, 1, 0},
+    {0x0001c4, 2, 1, 0},
+    {0x0001c5, 1, 1, 0},
+    {0x0001c7, 2, 1, 0},
+    {0x0001c8, 1, 1, 0},
+    {0x0001ca, 2, 1, 0},
+    {0x0001cb, 1, 17, 1},
+    {0x0001de, 1, 17, 1},
+    {0x0001f1, 2, 1, 0},
+    {0x0001f2, 1, 3, 1},
+    {0x0001f6, -97, 1, 0},
+    {0x0001f7, -56, 1, 0},
+    {0x0001f8, 1, 39, 1},
+    {0x000220, -130, 1, 0},
+    {0x000222, 1, 17, 1},
+    {0x00023a, 10795, 1, 0},
+    {0x00023b, 1, 1, 0},
+    {0x00023d, -163, 1, 0},
+    {0x00023e, 10792, 1, 0},
+    {0x000241, 1, 1, 0},
+    {0x000243, -195, 1, 0},
+    {0x000244, 69, 1, 0},
+    {0x000245, 71, 1, 0},
+    {0x000246, 1, 9, 1},
+    {0x000370, 1, 3, 1},
+    {0x000376, 1, 1, 0},
+    {0x00037f, 116, 1, 0},
+    {0x000386, 38, 1, 0},
+    {0x000388, 37, 3, 0},
+    {0x00038c, 64, 1, 0},
+    {0x00038e, 63, 2, 0},
+    {0x000391, 32, 17, 0},
+    {0x0003a3, 32, 9, 0},
+    {0x0003cf, 8, 1, 0},
+    {0x0003d8, 1, 23, 1},
+    {0x0003f4, -60, 1, 0},
+    {0x0003f7, 1, 1, 0},
+    {0x0003f9, -7, 1, 0},
+    {0x0003fa, 1, 1, 0},
+    {0x0003fd, -130, 3, 0},
+    {0x000400, 80, 16, 0},
+    {0x000410, 32, 32, 0},
+    {0x000460, 1, 33, 1},
+    {0x00048a, 1, 53, 1},
+    {0x0004c0, 15, 1, 0},
+    {0x0004c1, 1, 13, 1},
+    {0x0004d0, 1, 95, 1},
+    {0x000531, 48, 38, 0},
+    {0x0010a0, 7264, 38, 0},
+    {0x0010c7, 7264, 1, 0},
+    {0x0010cd, 7264, 1, 0},
+    {0x0013a0, 38864, 80, 0},
+    {0x0013f0, 8, 6, 0},
+    {0x001c90, -3008, 43, 0},
+    {0x001cbd, -3008, 3, 0},
+    {0x001e00, 1, 149, 1},
+    {0x001e9e, -7615, 1, 0},
+    {0x001ea0, 1, 95, 1},
+    {0x001f08, -8, 8, 0},
+    {0x001f18, -8, 6, 0},
+    {0x001f28, -8, 8, 0},
+    {0x001f38, -8, 8, 0},
+    {0x001f48, -8, 6, 0},
+    {0x001f59, -8, 7, 1},
+    {0x001f68, -8, 8, 0},
+    {0x001f88, -8, 8, 0},
+    {0x001f98, -8, 8, 0},
+    {0x001fa8, -8, 8, 0},
+    {0x001fb8, -8, 2, 0},
+    {0x001fba, -74, 2, 0},
+    {0x001fbc, -9, 1, 0},
+    {0x001fc8, -86, 4, 0},
+    {0x001fcc, -9, 1, 0},
+    {0x001fd8, -8, 2, 0},
+    {0x001fda, -100, 2, 0},
+    {0x001fe8, -8, 2, 0},
+    {0x001fea, -112, 2, 0},
+    {0x001fec, -7, 1, 0},
+    {0x001ff8, -128, 2, 0},
+    {0x001ffa, -126, 2, 0},
+    {0x001ffc, -9, 1, 0},
+    {0x002126, -7517, 1, 0},
+    {0x00212a, -8383, 1, 0},
+    {0x00212b, -8262, 1, 0},
+    {0x002132, 28, 1, 0},
+    {0x002160, 16, 16, 0},
+    {0x002183, 1, 1, 0},
+    {0x0024b6, 26, 26, 0},
+    {0x002c00, 48, 48, 0},
+    {0x002c60, 1, 1, 0},
+    {0x002c62, -10743, 1, 0},
+    {0x002c63, -3814, 1, 0},
+    {0x002c64, -10727, 1, 0},
+    {0x002c67, 1, 5, 1},
+    {0x002c6d, -10780, 1, 0},
+    {0x002c6e, -10749, 1, 0},
+    {0x002c6f, -10783, 1, 0},
+    {0x002c70, -10782, 1, 0},
+    {0x002c72, 1, 1, 0},
+    {0x002c75, 1, 1, 0},
+    {0x002c7e, -10815, 2, 0},
+    {0x002c80, 1, 99, 1},
+    {0x002ceb, 1, 3, 1},
+    {0x002cf2, 1, 1, 0},
+    {0x00a640, 1, 45, 1},
+    {0x00a680, 1, 27, 1},
+    {0x00a722, 1, 13, 1},
+    {0x00a732, 1, 61, 1},
+    {0x00a779, 1, 3, 1},
+    {0x00a77d, -35332, 1, 0},
+    {0x00a77e, 1, 9, 1},
+    {0x00a78b, 1, 1, 0},
+    {0x00a78d, -42280, 1, 0},
+    {0x00a790, 1, 3, 1},
+    {0x00a796, 1, 19, 1},
+    {0x00a7aa, -42308, 1, 0},
+    {0x00a7ab, -42319, 1, 0},
+    {0x00a7ac, -42315, 1, 0},
+    {0x00a7ad, -42305, 1, 0},
+    {0x00a7ae, -42308, 1, 0},
+    {0x00a7b0, -42258, 1, 0},
+    {0x00a7b1, -42282, 1, 0},
+    {0x00a7b2, -42261, 1, 0},
+    {0x00a7b3, 928, 1, 0},
+    {0x00a7b4, 1, 15, 1},
+    {0x00a7c4, -48, 1, 0},
+    {0x00a7c5, -42307, 1, 0},
+    {0x00a7c6, -35384, 1, 0},
+    {0x00a7c7, 1, 3, 1},
+    {0x00a7d0, 1, 1, 0},
+    {0x00a7d6, 1, 3, 1},
+    {0x00a7f5, 1, 1, 0},
+    {0x00ff21, 32, 26, 0},
+    {0x010400, 40, 40, 0},
+    {0x0104b0, 40, 36, 0},
+    {0x010570, 39, 11, 0},
+    {0x01057c, 39, 15, 0},
+    {0x01058c, 39, 7, 0},
+    {0x010594, 39, 2, 0},
+    {0x010c80, 64, 51, 0},
+    {0x0118a0, 32, 32, 0},
+    {0x016e40, 32, 32, 0},
+    {0x01e900, 34, 34, 0},
+};
+
+inline constexpr uint8_t to_lower_rule_index[491] = {
+    0, 4, 52, 63, 80, 86, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 90, 90, 90, 92, 92, 92, 92,
+    92, 92, 92, 92, 92, 94, 95, 97, 120, 120, 126, 126,
+    126, 127, 127, 127, 127, 127, 127, 127, 128, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 145,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 172, 172, 172, 172, 173, 174, 178, 178,
+    178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179,
+    179, 179, 179, 179, 179, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 182, 182,
+};
+
+template <size_t Rules, typename Index, size_t Blocks>
+constexpr uint32_t case_rule_find(const CaseRule (&rules)[Rules],
+                                  const Index (&index)[Blocks], uint32_t cp) {
+  const uint32_t block = cp >> case_rule_block_bits;
+  const CaseRule *rule = &rules[index[Blocks - 1]];
+  if (block < Blocks - 1) {
+    // Branchless search over the rules the block can see
+    rule = &rules[index[block]];
+    size_t len = index[block + 1] - index[block] + 1;
+    while (len > 1) {
+      const size_t half = len / 2;
+      rule = rule[half].first <= cp ? rule + half : rule;
+      len -= half;
+    }
+  }
+  const uint32_t offset = cp - rule->first;
+  return offset < rule->length && (offset & rule->stride_mask) == 0
+             ? cp + rule->delta
+             : cp;
+}
+
+constexpr uint32_t case_rules_towupper(uint32_t cp) {
+  return case_rule_find(to_upper_rules, to_upper_rule_index, cp);
+}
+
+constexpr uint32_t case_rules_towlower(uint32_t cp) {
+  return case_rule_find(to_lower_rules, to_lower_rule_index, cp);
+}
+
+#endif // CASE_MAPPING_RULES_H
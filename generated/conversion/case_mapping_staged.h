@@ -8,28 +8,62 @@
 #include <stdint.h>
 #include <wctype.h>
 
-
-// Level 1: maps upper 8 bits to level2 offset
+// 256-codepoint blocks; level1 holds level2 offsets, level2 deltas
+inline constexpr unsigned staged_case_block_bits = 8;
+inline constexpr unsigned staged_case_index_shift = 0;
+inline constexpr unsigned staged_case_block_mask =
+    (1u << staged_case_block_bits) - 1;
+inline constexpr int32_t staged_case_escape_end = INT16_MIN + 64;
+
+// Level 1: maps codepoint >> staged_case_block_bits to level2 offset
 inline constexpr uint16_t to_upper_level1[491] = {
 #include "case_mapping_upper_level1_staged.inc"
 };
 
-// Level 2: target codepoints (0 = no mapping, return identity)
-inline constexpr uint32_t to_upper_level2[6912] = {
+// Level 2: target - codepoint (0 = no mapping, return identity); codes
+// below staged_case_escape_end stand for the escapes entry code - INT16_MIN
+inline constexpr int16_t to_upper_level2[5372] = {
 #include "case_mapping_upper_level2_staged.inc"
 };
 
-// Level 1: maps upper 8 bits to level2 offset
+inline constexpr int32_t to_upper_escapes[13] = {
+    42319, 42315, 42280, 42308, 42305, 42307, 42282, 42261,
+    42258, 35266, 35332, 35384, -38864,
+};
+
+constexpr wint_t to_upper_target(wint_t wc, unsigned l2_idx) {
+  const int32_t code = to_upper_level2[l2_idx];
+  if (code < staged_case_escape_end) [[unlikely]] {
+    return wc + to_upper_escapes[code - INT16_MIN];
+  }
+  return wc + code;
+}
+
+// Level 1: maps codepoint >> staged_case_block_bits to level2 offset
 inline constexpr uint16_t to_lower_level1[491] = {
 #include "case_mapping_lower_level1_staged.inc"
 };
 
-// Level 2: target codepoints (0 = no mapping, return identity)
-inline constexpr uint32_t to_lower_level2[6144] = {
+// Level 2: target - codepoint (0 = no mapping, return identity); codes
+// below staged_case_escape_end stand for the escapes entry code - INT16_MIN
+inline constexpr int16_t to_lower_level2[4990] = {
 #include "case_mapping_lower_level2_staged.inc"
 };
 
-inline wint_t towupper_impl(wint_t wc) {
+inline constexpr int32_t to_lower_escapes[12] = {
+    38864, -35332, -42280, -42308, -42319, -42315, -42305, -42258,
+    -42282, -42261, -42307, -35384,
+};
+
+constexpr wint_t to_lower_target(wint_t wc, unsigned l2_idx) {
+  const int32_t code = to_lower_level2[l2_idx];
+  if (code < staged_case_escape_end) [[unlikely]] {
+    return wc + to_lower_escapes[code - INT16_MIN];
+  }
+  return wc + code;
+}
+
+constexpr wint_t towupper_impl(wint_t wc) {
   if (wc == WEOF) {
     return WEOF;
   }
@@ -46,19 +80,18 @@ inline wint_t towupper_impl(wint_t wc) {
     return wc;  // ASCII non-letters
   }
 
-  unsigned l1_idx = wc >> 8;
+  unsigned l1_idx = wc >> staged_case_block_bits;
   if (l1_idx >= 491) {
     return wc;  // Beyond table range
   }
 
-  unsigned l2_offset = to_upper_level1[l1_idx];
-  unsigned l2_idx = l2_offset + (wc & 0xFF);
+  unsigned l2_offset = to_upper_level1[l1_idx] << staged_case_index_shift;
+  unsigned l2_idx = l2_offset + (wc & staged_case_block_mask);
 
-  uint32_t target = to_upper_level2[l2_idx];
-  return target ? target : wc;
+  return to_upper_target(wc, l2_idx);
 }
 
-inline wint_t towlower_impl(wint_t wc) {
+constexpr wint_t towlower_impl(wint_t wc) {
   if (wc == WEOF) {
     return WEOF;
   }
@@ -76,16 +109,62 @@ inline wint_t towlower_impl(wint_t wc) {
     return wc;  // ASCII non-letters
   }
 
-  unsigned l1_idx = wc >> 8;
+  unsigned l1_idx = wc >> staged_case_block_bits;
   if (l1_idx >= 491) {
     return wc;  // Beyond table range
   }
 
-  unsigned l2_offset = to_lower_level1[l1_idx];
-  unsigned l2_idx = l2_offset + (wc & 0xFF);
+  unsigned l2_offset = to_lower_level1[l1_idx] << staged_case_index_shift;
+  unsigned l2_idx = l2_offset + (wc & staged_case_block_mask);
+
+  return to_lower_target(wc, l2_idx);
+}
+
+// Batched lookups for scattered input, in two stages per group: all level1
+// loads of the group are issued first, prefetching the level2 lines they
+// point to, and only then are the level2 loads resolved.
+template <typename Index, size_t L1, typename Entry, size_t L2,
+          typename Target>
+inline void staged_case_batch(const Index (&level1)[L1],
+                              const Entry (&level2)[L2], Target target,
+                              const wint_t *in, wint_t *out, size_t n) {
+  constexpr size_t group = 16;
+  uint32_t offsets[group];
+
+  // Anything past the table, WEOF included, maps to itself like U+0000
+  auto index = [](wint_t wc) -> wint_t {
+    return wc < (L1 << staged_case_block_bits) ? wc : 0;
+  };
+
+  for (size_t base = 0; base < n; base += group) {
+    const size_t len = n - base < group ? n - base : group;
+    for (size_t i = 0; i < len; ++i) {
+      const wint_t idx = index(in[base + i]);
+      offsets[i] = (level1[idx >> staged_case_block_bits]
+                    << staged_case_index_shift) +
+                   (idx & staged_case_block_mask);
+      __builtin_prefetch(&level2[offsets[i]]);
+    }
+    for (size_t i = 0; i < len; ++i) {
+      out[base + i] = target(in[base + i], offsets[i]);
+    }
+  }
+}
+
+// out[i] = towupper_impl(in[i]) for n scattered characters
+inline void towupper_batch_impl(const wint_t *in, wint_t *out, size_t n) {
+  staged_case_batch(
+      to_upper_level1, to_upper_level2,
+      [](wint_t wc, unsigned l2_idx) { return to_upper_target(wc, l2_idx); },
+      in, out, n);
+}
 
-  uint32_t target = to_lower_level2[l2_idx];
-  return target ? target : wc;
+// out[i] = towlower_impl(in[i]) for n scattered characters
+inline void towlower_batch_impl(const wint_t *in, wint_t *out, size_t n) {
+  staged_case_batch(
+      to_lower_level1, to_lower_level2,
+      [](wint_t wc, unsigned l2_idx) { return to_lower_target(wc, l2_idx); },
+      in, out, n);
 }
 
 #endif // CASE_MAPPING_STAGED_H
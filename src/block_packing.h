@@ -0,0 +1,109 @@
+#ifndef BLOCK_PACKING_H
+#define BLOCK_PACKING_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// Block size and level1 encoding of a two-level table
+struct TableShape {
+  unsigned block_bits = 8;
+  // level1 holds block numbers, multiplied by the block size on lookup, and
+  // level2 is not packed; otherwise level1 holds level2 offsets
+  bool block_ids = false;
+};
+
+// Bytes of the narrowest unsigned type that holds every entry of index
+inline size_t index_width(const std::vector<uint32_t> &index) {
+  const uint32_t max = index.empty() ? 0 : *std::ranges::max_element(index);
+  return max <= 0xFF ? 1 : max <= 0xFFFF ? 2 : 4;
+}
+
+inline const char *index_type(size_t width) {
+  return width == 1 ? "uint8_t" : width == 2 ? "uint16_t" : "uint32_t";
+}
+
+// Distinct blocks of a staged table laid out in one array, where a block may
+// start inside the tail of an earlier one or sit entirely inside it
+template <typename T>
+struct PackedBlocks {
+  std::vector<T> data;
+  std::vector<size_t> offsets; // Where each block starts in data
+};
+
+// Greedy shortest common superstring. The first `placed` blocks are laid
+// out in the order given, so block 0 stays at offset 0 and hot blocks stay
+// together; after them the block overlapping the end of the array the most
+// goes next. Block 0 may be longer than the others.
+template <typename T>
+PackedBlocks<T> pack_blocks(const std::vector<std::vector<T>> &blocks,
+                            size_t placed = 1) {
+  PackedBlocks<T> packed;
+  packed.offsets.assign(blocks.size(), 0);
+  if (blocks.empty()) {
+    return packed;
+  }
+  const size_t block_size = blocks.back().size();
+
+  std::vector<size_t> pending;
+  for (size_t i = 1; i < blocks.size(); ++i) {
+    pending.push_back(i);
+  }
+
+  // Longest suffix of data that block starts with
+  const auto overlap = [&](const std::vector<T> &block) {
+    const T *end = packed.data.data() + packed.data.size();
+    for (size_t k = std::min(block.size() - 1, packed.data.size()); k > 0;
+         --k) {
+      if (std::equal(block.data(), block.data() + k, end - k)) {
+        return k;
+      }
+    }
+    return size_t{0};
+  };
+
+  // Resolves pending blocks that now occur in data, looking only at the
+  // part from `from` on, since earlier matches would have been found before
+  const auto take_contained = [&](size_t from) {
+    std::erase_if(pending, [&](size_t i) {
+      const auto begin = packed.data.begin() + from;
+      const auto it = std::search(begin, packed.data.end(), blocks[i].begin(),
+                                  blocks[i].end());
+      if (it == packed.data.end()) {
+        return false;
+      }
+      packed.offsets[i] = it - packed.data.begin();
+      return true;
+    });
+  };
+
+  packed.data = blocks.front();
+  take_contained(0);
+  while (!pending.empty()) {
+    size_t best = 0;
+    size_t best_overlap = overlap(blocks[pending[0]]);
+    for (size_t p = 1; p < pending.size() && pending[0] >= placed; ++p) {
+      const size_t k = overlap(blocks[pending[p]]);
+      if (k > best_overlap) {
+        best = p;
+        best_overlap = k;
+      }
+    }
+    const auto &block = blocks[pending[best]];
+    const size_t offset = packed.data.size() - best_overlap;
+    packed.offsets[pending[best]] = offset;
+    packed.data.insert(packed.data.end(), block.begin() + best_overlap,
+                       block.end());
+    pending.erase(pending.begin() + best);
+    take_contained(offset > block_size ? offset - block_size : 0);
+  }
+
+  const size_t unpacked = (blocks.size() - 1) * block_size + blocks[0].size();
+  std::cout << "  Overlap packing: " << unpacked << " -> "
+      << packed.data.size() << " entries\n";
+  return packed;
+}
+
+#endif // BLOCK_PACKING_H
@@ -0,0 +1,81 @@
+#ifndef BLOCK_PROFILER_H
+#define BLOCK_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Block histogram of the codepoints the library classifies, in the format
+// the generator reads (see block_profile.txt). Builds with MYWCTYPE_PROFILE
+// defined count every lookup of mywctype.h here, and write the profile to
+// $MYWCTYPE_PROFILE_OUT at exit.
+namespace my_wctype::block_profiler {
+
+inline constexpr uint32_t num_blocks = 0x110000 >> 8;
+
+// Hits per block (codepoint >> 8); relaxed, only the totals matter
+inline std::atomic<uint64_t> block_hits[num_blocks];
+
+inline void record(wint_t wc) {
+  if (wc < 0x110000) {
+    block_hits[wc >> 8].fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+inline void record(std::span<const wchar_t> in) {
+  for (wchar_t wc : in) {
+    record(static_cast<wint_t>(wc));
+  }
+}
+
+inline void reset() {
+  for (auto &hits : block_hits) {
+    hits.store(0, std::memory_order_relaxed);
+  }
+}
+
+// Blocks with hits, hottest first
+inline std::vector<std::pair<uint32_t, uint64_t>> snapshot() {
+  std::vector<std::pair<uint32_t, uint64_t>> blocks;
+  for (uint32_t block = 0; block < num_blocks; ++block) {
+    if (const uint64_t hits = block_hits[block].load(std::memory_order_relaxed)) {
+      blocks.emplace_back(block, hits);
+    }
+  }
+  std::ranges::stable_sort(blocks, std::greater{},
+                           &std::pair<uint32_t, uint64_t>::second);
+  return blocks;
+}
+
+inline bool write_block_profile(const char *filename) {
+  std::ofstream f(filename);
+  if (!f.is_open()) {
+    return false;
+  }
+  f << "# Block profile recorded by a MYWCTYPE_PROFILE build: <block> <hits>,\n"
+    << "# block is codepoint >> 8 in hex\n";
+  for (const auto &[block, hits] : snapshot()) {
+    f << std::hex << block << std::dec << " " << hits << "\n";
+  }
+  return f.good();
+}
+
+#ifdef MYWCTYPE_PROFILE
+struct ExitWriter {
+  ~ExitWriter() {
+    if (const char *filename = std::getenv("MYWCTYPE_PROFILE_OUT")) {
+      write_block_profile(filename);
+    }
+  }
+};
+
+inline ExitWriter exit_writer;
+#endif
+
+} // namespace my_wctype::block_profiler
+
+#endif // BLOCK_PROFILER_H
@@ -0,0 +1,502 @@
+#ifndef WCTYPE_SRC_BULK_KERNELS_H
+#define WCTYPE_SRC_BULK_KERNELS_H
+
+#include "wctype_bitplanes.h"
+#include "wctype_table.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Instruction sets the kernels use, from the compiler flags unless
+// MYWCTYPE_SCALAR_KERNELS asks for the portable versions only
+#if !defined(MYWCTYPE_SCALAR_KERNELS)
+#if defined(__SSE2__)
+#define MYWCTYPE_SSE2 1
+#endif
+#if defined(__SSSE3__)
+#define MYWCTYPE_SSSE3 1
+#endif
+#if defined(__AVX2__)
+#define MYWCTYPE_AVX2 1
+#endif
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define MYWCTYPE_AVX512 1
+#endif
+#endif
+
+// Kernels are named after the instruction set they are compiled for, so
+// translation units built with different flags can be linked together
+// (see dispatch.h)
+#if defined(MYWCTYPE_AVX512)
+#define MYWCTYPE_KERNEL_NS avx512
+#elif defined(MYWCTYPE_AVX2)
+#define MYWCTYPE_KERNEL_NS avx2
+#elif defined(MYWCTYPE_SSSE3)
+#define MYWCTYPE_KERNEL_NS ssse3
+#elif defined(MYWCTYPE_SSE2)
+#define MYWCTYPE_KERNEL_NS sse2
+#else
+#define MYWCTYPE_KERNEL_NS scalar
+#endif
+
+#if defined(MYWCTYPE_SSE2)
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(wchar_t) == 4, "bulk kernels assume UTF-32 wchar_t");
+
+namespace my_wctype::detail::inline MYWCTYPE_KERNEL_NS {
+
+// U+0000..U+00FF are contiguous in every table layout
+inline constexpr const uint16_t *latin1_properties = wctype_layout::entry(0);
+
+// First codepoint not covered by the table
+inline constexpr uint32_t table_limit = wctype_layout::limit;
+
+// Characters handled per kernel step: one AVX2 compare covers 32, SSE2 16
+#if defined(MYWCTYPE_AVX2)
+inline constexpr size_t kernel_width = 32;
+#else
+inline constexpr size_t kernel_width = 16;
+#endif
+
+// Surrogates are stored as zero, so any invalid input can be redirected there
+static_assert(*wctype_layout::entry(0xD800) == 0 &&
+              *wctype_layout::entry(0xDFFF) == 0);
+inline constexpr uint32_t invalid_codepoint = 0xD800;
+
+// Codepoint to look up for wc: itself, or invalid_codepoint if out of range
+inline uint32_t table_index(wchar_t wc) {
+  const uint32_t cp = static_cast<uint32_t>(wc);
+  return cp < table_limit ? cp : invalid_codepoint;
+}
+
+// Same result as lookup_properties, without branches on the input
+inline uint16_t lookup_properties_branchless(wchar_t wc) {
+  return *wctype_layout::entry(table_index(wc));
+}
+
+// True if all kernel_width characters starting at p are in U+0000..max,
+// where max is 0x7F (ASCII) or 0xFF (Latin-1)
+inline bool is_run_within(const wchar_t *p, uint32_t max) {
+#if defined(MYWCTYPE_AVX512)
+  static_assert(kernel_width == 32);
+  const __m512i acc = _mm512_or_si512(_mm512_loadu_si512(p),
+                                      _mm512_loadu_si512(p + 16));
+  return _mm512_test_epi32_mask(acc, _mm512_set1_epi32(~max)) == 0;
+#elif defined(MYWCTYPE_AVX2)
+  __m256i acc = _mm256_setzero_si256();
+  for (size_t i = 0; i < kernel_width; i += 8) {
+    acc = _mm256_or_si256(
+        acc, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)));
+  }
+  return _mm256_testz_si256(acc, _mm256_set1_epi32(~max));
+#elif defined(MYWCTYPE_SSE2)
+  __m128i acc = _mm_setzero_si128();
+  for (size_t i = 0; i < kernel_width; i += 4) {
+    acc = _mm_or_si128(
+        acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)));
+  }
+  const __m128i high = _mm_and_si128(acc, _mm_set1_epi32(~max));
+  return _mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) ==
+         0xFFFF;
+#else
+  uint32_t acc = 0;
+  for (size_t i = 0; i < kernel_width; ++i) {
+    acc |= static_cast<uint32_t>(p[i]);
+  }
+  return acc <= max;
+#endif
+}
+
+inline void classify_ascii_run(const wchar_t *in, uint16_t *out) {
+  for (size_t i = 0; i < kernel_width; ++i) {
+    out[i] = latin1_properties[in[i]];
+  }
+}
+
+// Two-level lookup for a run with at least one non-ASCII character. There
+// are no branches on the input, so the loads of consecutive characters are
+// independent and overlap in the pipeline
+inline void classify_run(const wchar_t *in, uint16_t *out) {
+  for (size_t i = 0; i < kernel_width; ++i) {
+    out[i] = lookup_properties_branchless(in[i]);
+  }
+}
+
+inline void classify_n(const wchar_t *in, size_t n, uint16_t *out) {
+  size_t i = 0;
+  for (; i + kernel_width <= n; i += kernel_width) {
+    if (is_run_within(in + i, 0x7F)) {
+      classify_ascii_run(in + i, out + i);
+    } else {
+      classify_run(in + i, out + i);
+    }
+  }
+  for (; i < n; ++i) {
+    out[i] = lookup_properties_branchless(in[i]);
+  }
+}
+
+// Lookups of scattered codepoints, in two stages per group: all level1
+// loads of the group are issued first, prefetching the level2 lines they
+// point to, and only then are the level2 loads resolved. The dependent
+// loads of a whole group overlap instead of serializing per character.
+inline void lookup_properties_pipelined(const wchar_t *in, size_t n,
+                                        uint16_t *out) {
+  constexpr size_t group = 16;
+  const uint16_t *entries[group];
+
+  for (size_t base = 0; base < n; base += group) {
+    const size_t len = std::min(group, n - base);
+    for (size_t i = 0; i < len; ++i) {
+      entries[i] = wctype_layout::entry(table_index(in[base + i]));
+      __builtin_prefetch(entries[i]);
+    }
+    for (size_t i = 0; i < len; ++i) {
+      out[base + i] = *entries[i];
+    }
+  }
+}
+
+// A wctype descriptor is a set of PropertyBits; the bits of any other
+// value are ignored
+constexpr uint16_t class_mask(uint16_t desc) { return desc & PROP_ALL; }
+
+// Union of a set of descriptors
+constexpr uint16_t class_mask(const uint16_t *descs, size_t count) {
+  uint16_t mask = 0;
+  for (size_t k = 0; k < count; ++k) {
+    mask |= class_mask(descs[k]);
+  }
+  return mask;
+}
+
+// Property words of one run: Latin-1 runs need no level1 access at all,
+// other runs go through the table for every lane
+inline void class_words_run(const wchar_t *in, uint16_t *out) {
+  if (is_run_within(in, 0xFF)) {
+    for (size_t i = 0; i < kernel_width; ++i) {
+      out[i] = latin1_properties[in[i]];
+    }
+  } else {
+    classify_run(in, out);
+  }
+}
+
+// Bit i of the result is set when words[i] has any bit of mask set, for
+// N a multiple of 16 up to 64
+template <size_t N = 64>
+inline uint64_t movemask_any(const uint16_t *words, uint16_t mask) {
+  static_assert(N % 16 == 0 && N <= 64);
+#if defined(MYWCTYPE_SSE2)
+  const __m128i bits = _mm_set1_epi16(static_cast<short>(mask));
+  const __m128i zero = _mm_setzero_si128();
+  uint64_t result = 0;
+  for (size_t i = 0; i < N; i += 16) {
+    const __m128i lo = _mm_and_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + i)), bits);
+    const __m128i hi = _mm_and_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + i + 8)),
+        bits);
+    // Lanes without any of the bits compare equal to zero
+    const __m128i none =
+        _mm_packs_epi16(_mm_cmpeq_epi16(lo, zero), _mm_cmpeq_epi16(hi, zero));
+    result |= static_cast<uint64_t>(~_mm_movemask_epi8(none) & 0xFFFF) << i;
+  }
+  return result;
+#else
+  uint64_t result = 0;
+  for (size_t i = 0; i < N; ++i) {
+    result |= static_cast<uint64_t>((words[i] & mask) != 0) << i;
+  }
+  return result;
+#endif
+}
+
+// Bitmap k, made of (n + 63) / 64 words starting at bitmaps[k * words],
+// gets bit i set when in[i] is in class descs[k]
+inline void class_bitmaps_n(const wchar_t *in, size_t n,
+                            const uint16_t *descs, size_t count,
+                            uint64_t *bitmaps) {
+  const size_t words = (n + 63) / 64;
+  uint16_t classes[64];
+  for (size_t w = 0; w < words; ++w) {
+    const size_t begin = w * 64;
+    const size_t len = std::min<size_t>(64, n - begin);
+    classify_n(in + begin, len, classes);
+    std::fill(classes + len, classes + 64, 0);
+
+    for (size_t k = 0; k < count; ++k) {
+      bitmaps[k * words + w] = movemask_any(classes, class_mask(descs[k]));
+    }
+  }
+}
+
+// Bit i of the result is the top bit of bytes[i]
+inline uint64_t movemask_bytes64(const uint8_t *bytes) {
+#if defined(MYWCTYPE_SSE2)
+  uint64_t result = 0;
+  for (size_t i = 0; i < 64; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+    result |= static_cast<uint64_t>(_mm_movemask_epi8(v) & 0xFFFF) << i;
+  }
+  return result;
+#else
+  uint64_t result = 0;
+  for (size_t i = 0; i < 64; ++i) {
+    result |= static_cast<uint64_t>(bytes[i] >> 7) << i;
+  }
+  return result;
+#endif
+}
+
+// 0xFF where a Latin-1 character is in the plane, 0 elsewhere
+constexpr std::array<uint8_t, 256>
+latin1_lanes(const wctype_bitplanes::Plane &plane) {
+  std::array<uint8_t, 256> lanes{};
+  for (unsigned cp = 0; cp < 256; cp += 64) {
+    const uint64_t bits = wctype_bitplanes::word(plane, cp);
+    for (unsigned i = 0; i < 64; ++i) {
+      lanes[cp + i] = bits >> i & 1 ? 0xFF : 0;
+    }
+  }
+  return lanes;
+}
+
+// Bit i of bitmap[i / 64] is set when in[i] is in plane; Latin-1 runs read
+// the lanes expanded from the plane's first block instead
+inline void plane_bitmap_n(const wchar_t *in, size_t n,
+                           const wctype_bitplanes::Plane &plane,
+                           const uint8_t *latin1, uint64_t *bitmap) {
+  // One byte per character, so the lookups don't chain through a shift-or
+  uint8_t lanes[64];
+  for (size_t w = 0; w < (n + 63) / 64; ++w) {
+    const wchar_t *run = in + w * 64;
+    const size_t len = std::min<size_t>(64, n - w * 64);
+    bool is_latin1 = len == 64;
+    for (size_t i = 0; is_latin1 && i < 64; i += kernel_width) {
+      is_latin1 = is_run_within(run + i, 0xFF);
+    }
+
+    if (is_latin1) {
+      for (size_t i = 0; i < 64; ++i) {
+        lanes[i] = latin1[run[i]];
+      }
+    } else {
+      for (size_t i = 0; i < len; ++i) {
+        const uint32_t cp = static_cast<uint32_t>(run[i]);
+        lanes[i] = wctype_bitplanes::test(plane, cp) ? 0xFF : 0;
+      }
+      std::fill(lanes + len, lanes + 64, 0);
+    }
+    bitmap[w] = movemask_bytes64(lanes);
+  }
+}
+
+// Bit i of bitmap[i / 64] is set when in[i] is in class desc, looked up in
+// the bit-plane of that class only, a few KB instead of the whole level2.
+// Unions of classes have no plane and take the class_bitmaps_n path.
+inline void class_bitmap_lookup_n(const wchar_t *in, size_t n, uint16_t desc,
+                                  uint64_t *bitmap) {
+  desc = class_mask(desc);
+  if (!std::has_single_bit(desc)) {
+    class_bitmaps_n(in, n, &desc, 1, bitmap);
+    return;
+  }
+  const auto &plane = wctype_bitplanes::planes[std::countr_zero(desc)];
+  const auto latin1 = latin1_lanes(plane);
+  plane_bitmap_n(in, n, plane, latin1.data(), bitmap);
+}
+
+// Same for a class known at compile time, whose Latin-1 lanes are computed
+// by the compiler rather than expanded on every call. They are still
+// copied to the stack: read from .rodata they ran 1.7x slower here.
+template <uint16_t Desc>
+inline void class_bitmap_lookup_n(const wchar_t *in, size_t n,
+                                  uint64_t *bitmap) {
+  constexpr uint16_t mask = class_mask(Desc);
+  if constexpr (!std::has_single_bit(mask)) {
+    class_bitmaps_n(in, n, &mask, 1, bitmap);
+  } else {
+    constexpr const auto &plane =
+        wctype_bitplanes::planes[std::countr_zero(mask)];
+    constexpr auto latin1 = latin1_lanes(plane);
+    plane_bitmap_n(in, n, plane, latin1.data(), bitmap);
+  }
+}
+
+inline constexpr size_t class_count = 12;
+
+// Adds to counts[b] the number of characters with class bit b set. Each
+// class has its own vector of 16-bit lane counters; a run adds at most
+// kernel_width / 8 to a lane, so they are flushed before they can wrap.
+inline void class_counts_n(const wchar_t *in, size_t n, size_t *counts) {
+  size_t i = 0;
+#if defined(MYWCTYPE_SSE2)
+  constexpr size_t flush_runs = 0xFFFF / (kernel_width / 8);
+  const __m128i one = _mm_set1_epi16(1);
+  uint16_t classes[kernel_width];
+  while (i + kernel_width <= n) {
+    __m128i acc[class_count];
+    for (auto &a : acc) {
+      a = _mm_setzero_si128();
+    }
+    for (size_t run = 0; run < flush_runs && i + kernel_width <= n;
+         ++run, i += kernel_width) {
+      class_words_run(in + i, classes);
+      for (size_t j = 0; j < kernel_width; j += 8) {
+        __m128i w =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(classes + j));
+        for (size_t b = 0; b < class_count; ++b) {
+          acc[b] = _mm_add_epi16(acc[b], _mm_and_si128(w, one));
+          w = _mm_srli_epi16(w, 1);
+        }
+      }
+    }
+    for (size_t b = 0; b < class_count; ++b) {
+      // Widen the unsigned lanes to 32 bits, then add up the four lanes
+      const __m128i zero = _mm_setzero_si128();
+      alignas(16) uint32_t sums[4];
+      _mm_store_si128(reinterpret_cast<__m128i *>(sums),
+                      _mm_add_epi32(_mm_unpacklo_epi16(acc[b], zero),
+                                    _mm_unpackhi_epi16(acc[b], zero)));
+      counts[b] += sums[0] + sums[1] + sums[2] + sums[3];
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    const uint16_t w = lookup_properties_branchless(in[i]);
+    for (size_t b = 0; b < class_count; ++b) {
+      counts[b] += (w >> b) & 1;
+    }
+  }
+}
+
+#if defined(MYWCTYPE_SSSE3)
+// ASCII members of each class as nibble tables: byte lo of the table for
+// class bit b has bit hi set when U+00hl (h = hi, l = lo) is in the class
+inline constexpr auto ascii_nibble_sets = [] {
+  std::array<std::array<uint8_t, 16>, 12> sets{};
+  for (unsigned bit = 0; bit < 12; ++bit) {
+    for (unsigned cp = 0; cp < 128; ++cp) {
+      if (latin1_properties[cp] & (1 << bit)) {
+        sets[bit][cp & 0x0F] |= 1 << (cp >> 4);
+      }
+    }
+  }
+  return sets;
+}();
+
+// Nibble table of the ASCII characters with any bit of mask
+inline __m128i ascii_set(uint16_t mask) {
+  __m128i set = _mm_setzero_si128();
+  for (unsigned bit = 0; bit < 12; ++bit) {
+    if (mask & (1 << bit)) {
+      set = _mm_or_si128(set, _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                  ascii_nibble_sets[bit].data())));
+    }
+  }
+  return set;
+}
+
+// Bit i set when p[i] is in set, for 16 ASCII characters
+inline uint32_t ascii_match_16(const wchar_t *p, __m128i set) {
+  const __m128i *v = reinterpret_cast<const __m128i *>(p);
+  const __m128i bytes = _mm_packus_epi16(
+      _mm_packs_epi32(_mm_loadu_si128(v), _mm_loadu_si128(v + 1)),
+      _mm_packs_epi32(_mm_loadu_si128(v + 2), _mm_loadu_si128(v + 3)));
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  const __m128i column_bits =
+      _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+
+  const __m128i rows = _mm_shuffle_epi8(set, _mm_and_si128(bytes, nibble));
+  const __m128i columns = _mm_shuffle_epi8(
+      column_bits, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+  const __m128i miss =
+      _mm_cmpeq_epi8(_mm_and_si128(rows, columns), _mm_setzero_si128());
+  return ~_mm_movemask_epi8(miss) & 0xFFFF;
+}
+#endif
+
+// Index of the first character whose class test against mask equals
+// match, or n. The first few characters are tested one by one since most
+// scans end right away; after that whole runs are tested at once. Mask and
+// Match are uint16_t and bool, or std::integral_constant of them for the
+// per-class instances.
+template <typename Mask, typename Match>
+inline size_t find_class_impl(const wchar_t *in, size_t n, Mask mask,
+                              Match match) {
+  constexpr size_t prologue = 8;
+  constexpr uint64_t run_bits = (uint64_t{1} << kernel_width) - 1;
+
+  size_t i = 0;
+  for (; i < n && i < prologue; ++i) {
+    if (((lookup_properties_branchless(in[i]) & mask) != 0) == match) {
+      return i;
+    }
+  }
+  if (i + kernel_width > n) {
+    for (; i < n; ++i) {
+      if (((lookup_properties_branchless(in[i]) & mask) != 0) == match) {
+        return i;
+      }
+    }
+    return n;
+  }
+
+#if defined(MYWCTYPE_SSSE3)
+  const __m128i set = ascii_set(mask);
+#endif
+  uint16_t classes[kernel_width];
+  for (; i + kernel_width <= n; i += kernel_width) {
+    uint64_t bits;
+#if defined(MYWCTYPE_SSSE3)
+    if (is_run_within(in + i, 0x7F)) {
+      bits = 0;
+      for (size_t j = 0; j < kernel_width; j += 16) {
+        bits |= static_cast<uint64_t>(ascii_match_16(in + i + j, set)) << j;
+      }
+    } else {
+      class_words_run(in + i, classes);
+      bits = movemask_any<kernel_width>(classes, mask);
+    }
+#else
+    class_words_run(in + i, classes);
+    bits = movemask_any<kernel_width>(classes, mask);
+#endif
+    if (!match) {
+      bits = ~bits & run_bits;
+    }
+    if (bits) {
+      return i + std::countr_zero(bits);
+    }
+  }
+  for (; i < n; ++i) {
+    if (((lookup_properties_branchless(in[i]) & mask) != 0) == match) {
+      return i;
+    }
+  }
+  return n;
+}
+
+inline size_t find_class_n(const wchar_t *in, size_t n, uint16_t mask,
+                           bool match) {
+  return find_class_impl(in, n, mask, match);
+}
+
+// Same, with the mask folded into the kernel
+template <uint16_t Mask, bool Match>
+inline size_t find_class_n(const wchar_t *in, size_t n) {
+  return find_class_impl(in, n, std::integral_constant<uint16_t, Mask>{},
+                         std::bool_constant<Match>{});
+}
+
+} // namespace my_wctype::detail::inline MYWCTYPE_KERNEL_NS
+
+#endif // WCTYPE_SRC_BULK_KERNELS_H
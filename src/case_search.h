@@ -0,0 +1,37 @@
+#ifndef WCTYPE_SRC_CASE_SEARCH_H
+#define WCTYPE_SRC_CASE_SEARCH_H
+
+#include "case_mapping.h"
+
+#include <wctype.h>
+
+// Case conversion through the sorted mappings of case_mapping.h, searched
+// as a B-tree of 16-key nodes: three node compares per lookup, no branch
+// on the keys
+
+constexpr wint_t towlower_impl(wint_t wc) noexcept {
+  if (wc == WEOF) {
+    return WEOF;
+  }
+
+  // Out of valid Unicode range
+  if (wc < 0 || wc > 0x10FFFF || (wc >= 0xD800 && wc <= 0xDFFF)) {
+    return wc;
+  }
+
+  return case_search_towlower(wc);
+}
+
+constexpr wint_t towupper_impl(wint_t wc) noexcept {
+  if (wc == WEOF) {
+    return WEOF;
+  }
+
+  // Out of valid Unicode range
+  if (wc < 0 || wc > 0x10FFFF || (wc >= 0xD800 && wc <= 0xDFFF)) {
+    return wc;
+  }
+
+  return case_search_towupper(wc);
+}
+#endif  // WCTYPE_SRC_CASE_SEARCH_H
@@ -0,0 +1,213 @@
+#ifndef CLASS_CASE_GENERATOR_H
+#define CLASS_CASE_GENERATOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "block_packing.h"
+#include "staged_conversion_generator.h"
+
+// A codepoint's property word and both case mappings, the latter as the
+// int16_t codes of the delta-encoded staged case tables (see
+// staged_case_code)
+struct ClassCaseEntry {
+  uint16_t properties = 0;
+  uint16_t lower = 0;
+  uint16_t upper = 0;
+
+  auto operator<=>(const ClassCaseEntry &) const = default;
+};
+
+inline constexpr unsigned class_case_block_bits = 8;
+
+// Two-level table of entry ids: only a couple of hundred distinct entries
+// exist, so level2 holds one byte per codepoint and the entries themselves
+// fit in a few cache lines
+struct ClassCaseTable {
+  std::vector<uint32_t> level1; // Level2 offsets, per 256-codepoint block
+  std::vector<uint8_t> level2;
+  std::vector<ClassCaseEntry> entries; // Entry 0 is all zeros
+  std::vector<int32_t> escapes; // Deltas of the escape codes, both ways
+
+  size_t bytes() const {
+    return level1.size() * index_width(level1) + level2.size() +
+           entries.size() * 6 + escapes.size() * 4;
+  }
+};
+
+inline ClassCaseTable build_class_case_table(
+    const std::unordered_map<uint32_t, uint16_t> &properties,
+    const std::vector<StagedCaseMappingEntry> &case_entries) {
+  constexpr uint32_t unicode_max = 0x110000;
+  constexpr uint32_t block_size = 1u << class_case_block_bits;
+  constexpr uint32_t num_blocks = unicode_max / block_size;
+
+  ClassCaseTable table;
+  std::unordered_map<uint32_t, ClassCaseEntry> by_codepoint;
+  for (const auto &[codepoint, props] : properties) {
+    by_codepoint[codepoint].properties = props;
+  }
+  for (const auto &entry : case_entries) {
+    if (entry.lowercase != 0) {
+      by_codepoint[entry.codepoint].lower =
+          staged_case_code(entry.codepoint, entry.lowercase, table.escapes);
+    }
+    if (entry.uppercase != 0) {
+      by_codepoint[entry.codepoint].upper =
+          staged_case_code(entry.codepoint, entry.uppercase, table.escapes);
+    }
+  }
+
+  // Ids in order of first appearance, so that the empty entry is 0
+  std::map<ClassCaseEntry, uint8_t> ids{{ClassCaseEntry{}, 0}};
+  table.entries.push_back({});
+  const auto id_of = [&](const ClassCaseEntry &entry) {
+    const auto [it, inserted] = ids.emplace(entry, table.entries.size());
+    if (inserted) {
+      if (table.entries.size() > UINT8_MAX) {
+        throw std::runtime_error("Too many distinct class and case entries");
+      }
+      table.entries.push_back(entry);
+    }
+    return it->second;
+  };
+
+  using Block = std::vector<uint8_t>;
+  std::map<Block, size_t> blocks;
+  std::vector<Block> unique_blocks;
+  uint32_t max_block = 0;
+  for (uint32_t block_num = 0; block_num < num_blocks; ++block_num) {
+    Block block(block_size);
+    for (uint32_t offset = 0; offset < block_size; ++offset) {
+      const uint32_t codepoint = block_num << class_case_block_bits | offset;
+      if (auto it = by_codepoint.find(codepoint); it != by_codepoint.end()) {
+        block[offset] = id_of(it->second);
+        max_block = block_num;
+      }
+    }
+    const auto [it, inserted] = blocks.emplace(block, unique_blocks.size());
+    if (inserted) {
+      unique_blocks.push_back(std::move(block));
+    }
+    table.level1.push_back(it->second);
+  }
+
+  std::cout << "Class and case table:\n";
+  auto packed = pack_blocks(unique_blocks);
+  table.level2 = std::move(packed.data);
+  for (auto &entry : table.level1) {
+    entry = packed.offsets[entry];
+  }
+  table.level1.resize(max_block + 1);
+
+  std::cout << "  Unique blocks: " << unique_blocks.size() << "\n";
+  std::cout << "  Distinct entries: " << table.entries.size() << "\n";
+  std::cout << "  Memory: Level1="
+      << table.level1.size() * index_width(table.level1) << " bytes, "
+      << "Level2=" << table.level2.size() << " bytes, Entries="
+      << table.entries.size() * 6 << " bytes, Escapes="
+      << table.escapes.size() * 4 << " bytes\n";
+  return table;
+}
+
+inline void generate_class_case_code(const ClassCaseTable &table) {
+  std::ofstream f("wctype_class_case.h");
+  if (!f.is_open()) {
+    throw std::runtime_error("Cannot create wctype_class_case.h");
+  }
+
+  f << R"(// Auto-generated by class_case_generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef WCTYPE_CLASS_CASE_H
+#define WCTYPE_CLASS_CASE_H
+
+#include <stdint.h>
+#include <wctype.h>
+
+// Property word and both case mappings of each codepoint, so that
+// classifying a character and converting its case share one lookup.
+// level2 holds ids into the few distinct entries; case mappings are
+// target - codepoint (0 = no mapping), and codes below escape_end stand for
+// the escapes entry code - INT16_MIN.
+namespace wctype_class_case {
+
+struct Entry {
+  uint16_t properties;
+  int16_t lower;
+  int16_t upper;
+};
+
+inline constexpr unsigned block_bits = )" << class_case_block_bits << R"(;
+inline constexpr int32_t escape_end = INT16_MIN + )"
+    << staged_case_escape_end - INT16_MIN << R"(;
+
+// Level 1 table: maps codepoint >> block_bits to a level2 offset
+inline constexpr )" << index_type(index_width(table.level1)) << " level1["
+    << table.level1.size() << "] = {";
+  for (size_t i = 0; i < table.level1.size(); ++i) {
+    f << (i % 12 == 0 ? "\n    " : " ") << table.level1[i] << ",";
+  }
+  f << "\n};\n\n";
+
+  f << "// Level 2 table: entry id of each codepoint\n"
+    << "inline constexpr uint8_t level2[" << table.level2.size() << "] = {";
+  for (size_t i = 0; i < table.level2.size(); ++i) {
+    f << (i % 16 == 0 ? "\n    " : " ") << +table.level2[i] << ",";
+  }
+  f << "\n};\n\n";
+
+  f << "alignas(64) inline constexpr Entry entries[" << table.entries.size()
+    << "] = {\n";
+  for (const auto &entry : table.entries) {
+    f << "    {0x" << std::hex << std::setw(4) << std::setfill('0')
+      << entry.properties << std::dec << std::setfill(' ') << ", "
+      << static_cast<int16_t>(entry.lower) << ", "
+      << static_cast<int16_t>(entry.upper) << "},\n";
+  }
+  f << "};\n\n";
+
+  f << "inline constexpr int32_t escapes["
+    << std::max<size_t>(table.escapes.size(), 1) << "] = {";
+  for (size_t i = 0; i < table.escapes.size(); ++i) {
+    f << (i % 8 == 0 ? "\n    " : " ") << table.escapes[i] << ",";
+  }
+  f << R"(
+};
+
+// First codepoint past the table
+inline constexpr uint32_t limit = )" << table.level1.size()
+    << R"(u << block_bits;
+
+// Entry of wc; entry 0, all zeros, outside Unicode, for surrogates and WEOF
+constexpr const Entry &entry(wint_t wc) {
+  if (wc >= limit || (wc >= 0xD800 && wc <= 0xDFFF)) {
+    return entries[0];
+  }
+  return entries[level2[level1[wc >> block_bits] +
+                        (wc & ((1u << block_bits) - 1))]];
+}
+
+// wc with one of the case mapping codes of its entry applied
+constexpr wint_t apply(wint_t wc, int32_t code) {
+  if (code < escape_end) [[unlikely]] {
+    return wc + escapes[code - INT16_MIN];
+  }
+  return wc + code;
+}
+
+} // namespace wctype_class_case
+
+#endif // WCTYPE_CLASS_CASE_H
+)";
+}
+
+#endif // CLASS_CASE_GENERATOR_H
@@ -4,10 +4,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -165,6 +167,70 @@ inline void generate_mapping_inc(const std::vector<CaseMapping> &mappings,
   f.close();
 }
 
+// The sorted mappings as an implicit B-tree of case_search_node_keys keys
+// per node (see generate_case_mapping_code), so that a lookup compares a
+// whole node at a time instead of branching on every key. The last node is
+// padded with keys past every codepoint.
+struct CaseSearchTree {
+  std::vector<int32_t> keys;
+  std::vector<uint32_t> values;
+};
+
+inline constexpr size_t case_search_node_keys = 16;
+
+inline CaseSearchTree
+build_case_search_tree(const std::vector<CaseMapping> &mappings) {
+  const size_t nodes =
+      (mappings.size() + case_search_node_keys - 1) / case_search_node_keys;
+  CaseSearchTree tree{
+      std::vector<int32_t>(nodes * case_search_node_keys, INT32_MAX),
+      std::vector<uint32_t>(nodes * case_search_node_keys, 0)};
+
+  // In-order walk, handing out the mappings in sorted order
+  size_t next = 0;
+  const std::function<void(size_t)> fill = [&](const size_t node) {
+    if (node >= nodes) {
+      return;
+    }
+    for (size_t i = 0; i <= case_search_node_keys; ++i) {
+      fill(node * (case_search_node_keys + 1) + i + 1);
+      if (i < case_search_node_keys && next < mappings.size()) {
+        tree.keys[node * case_search_node_keys + i] =
+            static_cast<int32_t>(mappings[next].from);
+        tree.values[node * case_search_node_keys + i] = mappings[next].to;
+        ++next;
+      }
+    }
+  };
+  fill(0);
+  return tree;
+}
+
+inline void write_case_search_tree(std::ofstream &f, const std::string &name,
+                                   const CaseSearchTree &tree) {
+  f << "alignas(64) inline constexpr int32_t " << name << "_search_keys["
+    << tree.keys.size() << "] = {";
+  for (size_t i = 0; i < tree.keys.size(); ++i) {
+    f << (i % 8 == 0 ? "\n    " : " ");
+    if (tree.keys[i] == INT32_MAX) {
+      f << "INT32_MAX,";
+    } else {
+      f << "0x" << std::hex << std::setw(6) << std::setfill('0')
+        << tree.keys[i] << "," << std::dec << std::setfill(' ');
+    }
+  }
+  f << "\n};\n\n";
+
+  f << "inline constexpr uint32_t " << name << "_search_values["
+    << tree.values.size() << "] = {";
+  for (size_t i = 0; i < tree.values.size(); ++i) {
+    f << (i % 8 == 0 ? "\n    " : " ") << "0x" << std::hex << std::setw(6)
+      << std::setfill('0') << tree.values[i] << "," << std::dec
+      << std::setfill(' ');
+  }
+  f << "\n};\n\n";
+}
+
 inline void generate_case_mapping_code(const std::vector<CaseMapping> &to_upper,
                                        const std::vector<CaseMapping> &
                                        to_lower) {
@@ -182,77 +248,251 @@ inline void generate_case_mapping_code(const std::vector<CaseMapping> &to_upper,
 #ifndef CASE_MAPPING_H
 #define CASE_MAPPING_H
 
+#include <stddef.h>
 #include <stdint.h>
-#include <wctype.h>
-#include <cstddef>
 
-struct CaseMapping {
-  uint32_t from;
-  uint32_t to;
-};
+#include <bit>
 
-inline constexpr CaseMapping to_upper_table[)" << to_upper.size() << R"(] = {
-#include "case_mapping_upper.inc"
-};
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
-inline constexpr CaseMapping to_lower_table[)" << to_lower.size() << R"(] = {
-#include "case_mapping_lower.inc"
-};
+// The sorted case mappings as an implicit B-tree of 16-key nodes, one
+// cache line each: node k's children are nodes k * 17 + 1 .. k * 17 + 17,
+// and child i holds the keys between key i - 1 and key i. Each value sits
+// at the index of its key; padding keys are INT32_MAX.
+inline constexpr size_t case_search_node_keys = )"
+    << case_search_node_keys << R"(;
 
-inline const CaseMapping *find_mapping(const CaseMapping *table, size_t size,
-                                       uint32_t codepoint) {
-  size_t left = 0;
-  size_t right = size;
-
-  while (left < right) {
-    size_t mid = left + (right - left) / 2;
-    if (table[mid].from == codepoint) {
-      return &table[mid];
-    } else if (table[mid].from < codepoint) {
-      left = mid + 1;
-    } else {
-      right = mid;
-    }
+)";
+  write_case_search_tree(f, "to_upper", build_case_search_tree(to_upper));
+  write_case_search_tree(f, "to_lower", build_case_search_tree(to_lower));
+  f << R"(// Keys of a node less than cp; the keys are sorted, so the compare mask
+// is a run of ones
+constexpr unsigned case_search_rank(const int32_t *node, int32_t cp) {
+#if defined(__SSE2__)
+  if !consteval {
+    const __m128i x = _mm_set1_epi32(cp);
+    const __m128i *keys = reinterpret_cast<const __m128i *>(node);
+    const __m128i lo =
+        _mm_packs_epi32(_mm_cmpgt_epi32(x, _mm_load_si128(keys)),
+                        _mm_cmpgt_epi32(x, _mm_load_si128(keys + 1)));
+    const __m128i hi =
+        _mm_packs_epi32(_mm_cmpgt_epi32(x, _mm_load_si128(keys + 2)),
+                        _mm_cmpgt_epi32(x, _mm_load_si128(keys + 3)));
+    return std::countr_one(
+        static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(lo, hi))));
   }
-  return nullptr;
+#endif
+  unsigned rank = 0;
+  for (size_t i = 0; i < case_search_node_keys; ++i) {
+    rank += node[i] < cp;
+  }
+  return rank;
 }
 
-inline wint_t towupper_impl(wint_t wc) {
-  if (wc == WEOF) {
-    return WEOF;
+constexpr int case_search_levels(size_t nodes) {
+  int levels = 0;
+  for (size_t full = 0; full < nodes;
+       full = full * (case_search_node_keys + 1) + 1) {
+    ++levels;
   }
+  return levels;
+}
 
-  // Out of valid Unicode range
-  if (wc < 0 || wc > 0x10FFFF || (wc >= 0xD800 && wc <= 0xDFFF)) {
-    return wc;
+// Descends every level without branching; the first key not less than cp
+// is the last one a node offered
+template <size_t Keys>
+constexpr uint32_t case_search_find(const int32_t (&keys)[Keys],
+                                    const uint32_t (&values)[Keys],
+                                    uint32_t cp) {
+  constexpr size_t nodes = Keys / case_search_node_keys;
+  const int32_t key = static_cast<int32_t>(cp);
+  size_t node = 0;
+  size_t found = 0; // Any key would do: one equal to cp is its own mapping
+  for (int level = 0; level < case_search_levels(nodes); ++level) {
+    const bool exists = node < nodes;
+    const unsigned rank =
+        case_search_rank(&keys[(exists ? node : 0) * case_search_node_keys],
+                         key);
+    found = exists && rank < case_search_node_keys
+                ? node * case_search_node_keys + rank
+                : found;
+    node = node * (case_search_node_keys + 1) + rank + 1;
   }
+  const uint32_t to = values[found];
+  return keys[found] == key ? to : cp;
+}
+
+constexpr uint32_t case_search_towupper(uint32_t cp) {
+  return case_search_find(to_upper_search_keys, to_upper_search_values, cp);
+}
+
+constexpr uint32_t case_search_towlower(uint32_t cp) {
+  return case_search_find(to_lower_search_keys, to_lower_search_values, cp);
+}
+
+#endif // CASE_MAPPING_H
+)";
+
+  f.close();
+}
+
+// Minimal perfect hash of a mapping list (hash and displace): codepoints
+// are split into buckets, and each bucket gets the seed that sends all of
+// its codepoints to slots no earlier bucket took. A lookup then reads one
+// seed and compares one slot. The hashes must match the ones
+// generate_case_hash_code emits.
+struct CaseHashTable {
+  std::vector<uint16_t> seeds;     // Per bucket
+  std::vector<CaseMapping> slots;  // One per mapping
+};
+
+inline constexpr size_t case_hash_bucket_size = 4;
 
-  const CaseMapping *mapping =
-      find_mapping(to_upper_table, )" << to_upper.size() << R"(, wc);
+constexpr uint32_t case_hash_scramble(const uint32_t cp) {
+  return cp * 0x9E3779B1u;
+}
+
+constexpr uint32_t case_hash_reduce(const uint32_t h, const size_t n) {
+  return static_cast<uint32_t>(static_cast<uint64_t>(h) * n >> 32);
+}
 
-  return mapping ? mapping->to : wc;
+constexpr uint32_t case_hash_slot(const uint32_t h, const uint16_t seed,
+                                  const size_t slots) {
+  return case_hash_reduce((h ^ seed) * 0x85EBCA6Bu, slots);
 }
 
-inline wint_t towlower_impl(wint_t wc) {
-  if (wc == WEOF) {
-    return WEOF;
+inline CaseHashTable
+build_case_hash_table(const std::vector<CaseMapping> &mappings) {
+  const size_t num_slots = mappings.size();
+  const size_t num_buckets =
+      (num_slots + case_hash_bucket_size - 1) / case_hash_bucket_size;
+
+  std::vector<std::vector<CaseMapping>> buckets(num_buckets);
+  for (const auto &m : mappings) {
+    buckets[case_hash_reduce(case_hash_scramble(m.from), num_buckets)]
+        .push_back(m);
+  }
+
+  // Largest buckets first, while most slots are free
+  std::vector<size_t> order(num_buckets);
+  for (size_t b = 0; b < num_buckets; ++b) {
+    order[b] = b;
+  }
+  std::ranges::stable_sort(order, std::greater{},
+                           [&](size_t b) { return buckets[b].size(); });
+
+  CaseHashTable table{std::vector<uint16_t>(num_buckets),
+                      std::vector<CaseMapping>(num_slots, {0, 0})};
+  std::vector<bool> taken(num_slots);
+  std::vector<uint32_t> picked;
+  for (const size_t b : order) {
+    if (buckets[b].empty()) {
+      continue;
+    }
+    bool placed = false;
+    for (uint32_t seed = 0; seed <= UINT16_MAX && !placed; ++seed) {
+      picked.clear();
+      placed = true;
+      for (const auto &m : buckets[b]) {
+        const uint32_t slot =
+            case_hash_slot(case_hash_scramble(m.from), seed, num_slots);
+        if (taken[slot] || std::ranges::find(picked, slot) != picked.end()) {
+          placed = false;
+          break;
+        }
+        picked.push_back(slot);
+      }
+      if (placed) {
+        table.seeds[b] = static_cast<uint16_t>(seed);
+        for (size_t i = 0; i < picked.size(); ++i) {
+          taken[picked[i]] = true;
+          table.slots[picked[i]] = buckets[b][i];
+        }
+      }
+    }
+    if (!placed) {
+      throw std::runtime_error("No case hash seed for bucket " +
+                               std::to_string(b));
+    }
   }
+  return table;
+}
 
-  // Out of valid Unicode range
-  if (wc < 0 || wc > 0x10FFFF || (wc >= 0xD800 && wc <= 0xDFFF)) {
-    return wc;
+inline void write_case_hash_table(std::ofstream &f, const std::string &name,
+                                  const CaseHashTable &table) {
+  f << "inline constexpr uint16_t " << name << "_hash_seeds["
+    << table.seeds.size() << "] = {";
+  for (size_t i = 0; i < table.seeds.size(); ++i) {
+    f << (i % 12 == 0 ? "\n    " : " ") << table.seeds[i] << ",";
+  }
+  f << "\n};\n\n";
+
+  f << "inline constexpr CaseHashEntry " << name << "_hash_slots["
+    << table.slots.size() << "] = {\n";
+  for (const auto &slot : table.slots) {
+    f << "    {0x" << std::hex << std::setw(6) << std::setfill('0')
+      << slot.from << ", 0x" << std::setw(6) << slot.to << "},\n"
+      << std::dec << std::setfill(' ');
   }
+  f << "};\n\n";
+}
 
-  const CaseMapping *mapping =
-      find_mapping(to_lower_table, )" << to_lower.size() << R"(, wc);
+inline void generate_case_hash_code(const CaseHashTable &to_upper,
+                                    const CaseHashTable &to_lower) {
+  std::ofstream f("case_mapping_hash.h");
+  if (!f.is_open()) {
+    throw std::runtime_error("Cannot create case_mapping_hash.h");
+  }
 
-  return mapping ? mapping->to : wc;
+  f << R"(// Auto-generated by conversion_generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef CASE_MAPPING_HASH_H
+#define CASE_MAPPING_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Minimal perfect hashes of the case mappings: one slot per mapping, found
+// through its bucket's seed. A codepoint without a mapping lands on some
+// other codepoint's slot and maps to itself.
+struct CaseHashEntry {
+  uint32_t from;
+  uint32_t to;
+};
+
+constexpr uint32_t case_hash_scramble(uint32_t cp) { return cp * 0x9E3779B1u; }
+
+constexpr uint32_t case_hash_reduce(uint32_t h, size_t n) {
+  return static_cast<uint32_t>(static_cast<uint64_t>(h) * n >> 32);
 }
 
-#endif // CASE_MAPPING_H
 )";
+  write_case_hash_table(f, "to_upper", to_upper);
+  write_case_hash_table(f, "to_lower", to_lower);
+  f << R"(template <size_t Buckets, size_t Slots>
+constexpr uint32_t case_hash_find(const uint16_t (&seeds)[Buckets],
+                                  const CaseHashEntry (&slots)[Slots],
+                                  uint32_t cp) {
+  const uint32_t h = case_hash_scramble(cp);
+  const uint16_t seed = seeds[case_hash_reduce(h, Buckets)];
+  const CaseHashEntry &entry =
+      slots[case_hash_reduce((h ^ seed) * 0x85EBCA6Bu, Slots)];
+  return entry.from == cp ? entry.to : cp;
+}
 
-  f.close();
+constexpr uint32_t case_hash_towupper(uint32_t cp) {
+  return case_hash_find(to_upper_hash_seeds, to_upper_hash_slots, cp);
+}
+
+constexpr uint32_t case_hash_towlower(uint32_t cp) {
+  return case_hash_find(to_lower_hash_seeds, to_lower_hash_slots, cp);
+}
+
+#endif // CASE_MAPPING_HASH_H
+)";
 }
 
 #endif // CASE_MAPPING_GENERATOR_H
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "dispatch.h"
+
+#include <atomic>
+#include <cassert>
+
+namespace my_wctype::dispatch {
+
+namespace {
+
+const KernelTable *table_for(Isa isa) {
+  switch (isa) {
+  case Isa::Scalar:
+    return &scalar_kernels;
+#if defined(MYWCTYPE_X86_KERNELS)
+  case Isa::SSE42:
+    return &sse42_kernels;
+  case Isa::AVX2:
+    return &avx2_kernels;
+  case Isa::AVX512:
+    return &avx512_kernels;
+#endif
+  default:
+    return nullptr;
+  }
+}
+
+bool cpu_supports(Isa isa) {
+#if defined(MYWCTYPE_X86_KERNELS)
+  __builtin_cpu_init();
+  switch (isa) {
+  case Isa::Scalar:
+    return true;
+  case Isa::SSE42:
+    return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+  case Isa::AVX2:
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2") &&
+           __builtin_cpu_supports("popcnt");
+  case Isa::AVX512:
+    return __builtin_cpu_supports("avx512f") &&
+           __builtin_cpu_supports("avx512bw") && cpu_supports(Isa::AVX2);
+  }
+  return false;
+#else
+  return isa == Isa::Scalar;
+#endif
+}
+
+// Resolved on first use; every thread that races there stores the same
+// table
+std::atomic<const KernelTable *> active_table{nullptr};
+
+const KernelTable &kernels() {
+  const KernelTable *table = active_table.load(std::memory_order_relaxed);
+  if (!table) {
+    table = table_for(best_isa());
+    active_table.store(table, std::memory_order_relaxed);
+  }
+  return *table;
+}
+
+} // namespace
+
+Isa best_isa() {
+  for (Isa isa : {Isa::AVX512, Isa::AVX2, Isa::SSE42}) {
+    if (table_for(isa) && cpu_supports(isa)) {
+      return isa;
+    }
+  }
+  return Isa::Scalar;
+}
+
+Isa active_isa() { return kernels().isa; }
+
+bool force_isa(Isa isa) {
+  const KernelTable *table = table_for(isa);
+  if (!table || !cpu_supports(isa)) {
+    return false;
+  }
+  active_table.store(table, std::memory_order_relaxed);
+  return true;
+}
+
+void reset_isa() {
+  active_table.store(table_for(best_isa()), std::memory_order_relaxed);
+}
+
+const char *isa_name(Isa isa) {
+  switch (isa) {
+  case Isa::Scalar:
+    return "scalar";
+  case Isa::SSE42:
+    return "sse4.2";
+  case Isa::AVX2:
+    return "avx2";
+  case Isa::AVX512:
+    return "avx512";
+  }
+  return "unknown";
+}
+
+void classify(std::span<const wchar_t> in, std::span<uint16_t> out) {
+  assert(out.size() >= in.size());
+  kernels().classify(in.data(), in.size(), out.data());
+}
+
+void classify_scattered(std::span<const wchar_t> in, std::span<uint16_t> out) {
+  assert(out.size() >= in.size());
+  kernels().classify_scattered(in.data(), in.size(), out.data());
+}
+
+void iswctype_bitmap(std::span<const wchar_t> in,
+                     std::span<const mywctype_t> descs,
+                     std::span<uint64_t> bitmaps) {
+  assert(bitmaps.size() >= descs.size() * bitmap_words(in.size()));
+  kernels().class_bitmaps(in.data(), in.size(), descs.data(), descs.size(),
+                          bitmaps.data());
+}
+
+size_t find_first_of_class(std::span<const wchar_t> s, mywctype_t desc) {
+  return kernels().find_class(s.data(), s.size(), detail::class_mask(desc),
+                              true);
+}
+
+size_t find_first_of_class(std::span<const wchar_t> s,
+                           std::span<const mywctype_t> descs) {
+  return kernels().find_class(s.data(), s.size(),
+                              detail::class_mask(descs.data(), descs.size()),
+                              true);
+}
+
+size_t find_first_not_of_class(std::span<const wchar_t> s, mywctype_t desc) {
+  return kernels().find_class(s.data(), s.size(), detail::class_mask(desc),
+                              false);
+}
+
+size_t find_first_not_of_class(std::span<const wchar_t> s,
+                               std::span<const mywctype_t> descs) {
+  return kernels().find_class(s.data(), s.size(),
+                              detail::class_mask(descs.data(), descs.size()),
+                              false);
+}
+
+bool all_of_class(std::span<const wchar_t> s, mywctype_t desc) {
+  return find_first_not_of_class(s, desc) == s.size();
+}
+
+bool all_of_class(std::span<const wchar_t> s,
+                  std::span<const mywctype_t> descs) {
+  return find_first_not_of_class(s, descs) == s.size();
+}
+
+ClassHistogram class_histogram(std::span<const wchar_t> in) {
+  ClassHistogram histogram;
+  histogram.total = in.size();
+  kernels().class_counts(in.data(), in.size(), histogram.counts.data());
+  return histogram;
+}
+
+} // namespace my_wctype::dispatch
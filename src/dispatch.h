@@ -0,0 +1,56 @@
+#ifndef WCTYPE_SRC_DISPATCH_H
+#define WCTYPE_SRC_DISPATCH_H
+
+#include "kernel_table.h"
+#include "mywctype.h"
+
+#include <span>
+
+// The bulk functions of mywctype.h, with kernels picked at runtime for the
+// CPU the program runs on instead of the flags it was compiled with. Part
+// of mywctype_static.
+namespace my_wctype::dispatch {
+
+// Best instruction set this CPU supports
+Isa best_isa();
+
+// Instruction set the functions below currently use
+Isa active_isa();
+
+// Switches to isa, e.g. to test every variant on one machine. Returns false
+// and keeps the current kernels if the CPU or the build lacks it.
+bool force_isa(Isa isa);
+
+// Back to best_isa()
+void reset_isa();
+
+const char *isa_name(Isa isa);
+
+void classify(std::span<const wchar_t> in, std::span<uint16_t> out);
+
+void classify_scattered(std::span<const wchar_t> in, std::span<uint16_t> out);
+
+void iswctype_bitmap(std::span<const wchar_t> in,
+                     std::span<const mywctype_t> descs,
+                     std::span<uint64_t> bitmaps);
+
+size_t find_first_of_class(std::span<const wchar_t> s, mywctype_t desc);
+
+size_t find_first_of_class(std::span<const wchar_t> s,
+                           std::span<const mywctype_t> descs);
+
+size_t find_first_not_of_class(std::span<const wchar_t> s, mywctype_t desc);
+
+size_t find_first_not_of_class(std::span<const wchar_t> s,
+                               std::span<const mywctype_t> descs);
+
+bool all_of_class(std::span<const wchar_t> s, mywctype_t desc);
+
+bool all_of_class(std::span<const wchar_t> s,
+                  std::span<const mywctype_t> descs);
+
+ClassHistogram class_histogram(std::span<const wchar_t> in);
+
+} // namespace my_wctype::dispatch
+
+#endif // WCTYPE_SRC_DISPATCH_H
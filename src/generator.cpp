@@ -1,23 +1,87 @@
 #include "generator.h"
+#include "class_case_generator.h"
 #include "staged_conversion_generator.h"
 #include "conversion_generator.h"
+#include "rule_conversion_generator.h"
+#include "table_autotune.h"
 
-int main() {
+// "offset" or "block_id", see TableShape
+static bool parse_level1_index(const std::string_view value) {
+  if (value != "offset" && value != "block_id") {
+    throw std::runtime_error("Unknown level1 index: " + std::string(value));
+  }
+  return value == "block_id";
+}
+
+// "target" or "delta", what the staged case tables' level2 holds
+static bool parse_case_encoding(const std::string_view value) {
+  if (value != "target" && value != "delta") {
+    throw std::runtime_error("Unknown case encoding: " + std::string(value));
+  }
+  return value == "delta";
+}
+
+// Options: --block-bits=N and --level1-index=offset|block_id shape the
+// two-level classification table, --case-block-bits,
+// --case-level1-index and --case-encoding=target|delta the staged case
+// tables. --autotune sweeps the shapes
+// instead of generating. Any other argument is the block profile to order
+// level2 by and to pick the fast paths from, see block_profile.txt.
+int main(int argc, char *argv[]) {
   std::string_view filename = "unicodedata/UnicodeData.txt";
 
+  TableShape shape;
+  TableShape case_shape;
+  bool case_deltas = false;
+  bool autotune = false;
+  BlockProfile profile;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const auto value = arg.substr(arg.find('=') + 1);
+    if (arg == "--autotune") {
+      autotune = true;
+    } else if (arg.starts_with("--block-bits=")) {
+      shape.block_bits = std::stoul(std::string(value));
+    } else if (arg.starts_with("--level1-index=")) {
+      shape.block_ids = parse_level1_index(value);
+    } else if (arg.starts_with("--case-block-bits=")) {
+      case_shape.block_bits = std::stoul(std::string(value));
+    } else if (arg.starts_with("--case-level1-index=")) {
+      case_shape.block_ids = parse_level1_index(value);
+    } else if (arg.starts_with("--case-encoding=")) {
+      case_deltas = parse_case_encoding(value);
+    } else {
+      profile = read_block_profile(arg);
+    }
+  }
+
   const auto entries = read_unicode_data(filename);
   const auto properties = parse_unicode_data(entries);
-  const auto table = build_lookup_tables(properties);
-  generate_code(table);
+  const auto staged_case_mappings = read_staged_case_mappings(filename);
+  if (autotune) {
+    autotune_tables(properties, staged_case_mappings, profile, case_deltas);
+    return 0;
+  }
+
+  const auto table = build_lookup_tables(properties, 0, profile, shape);
+  const auto flat_bmp_table = build_flat_bmp_table(properties, profile);
+  const auto three_stage_table = build_three_stage_table(properties);
+  generate_code(table, flat_bmp_table, three_stage_table);
+  generate_bit_planes(build_bit_planes(properties));
+  generate_fast_paths(build_fast_paths(properties, profile), properties);
+  generate_class_case_code(
+      build_class_case_table(properties, staged_case_mappings));
 
   const auto case_entries = read_case_mappings(filename);
   auto [to_upper, to_lower] = build_case_mapping_tables(case_entries);
   generate_case_mapping_code(to_upper, to_lower);
+  generate_case_hash_code(build_case_hash_table(to_upper),
+                          build_case_hash_table(to_lower));
+  generate_case_rule_code(to_upper, to_lower);
 
-  const auto staged_case_mappings = read_staged_case_mappings(filename);
-  auto to_upper_table = build_staged_table(staged_case_mappings, true);
-  auto to_lower_table = build_staged_table(staged_case_mappings, false);
+  auto to_upper_table =
+      build_staged_table(staged_case_mappings, true, case_shape, case_deltas);
+  auto to_lower_table =
+      build_staged_table(staged_case_mappings, false, case_shape, case_deltas);
   generate_staged_case_code(to_upper_table, to_lower_table);
 }
-
-
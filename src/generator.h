@@ -12,11 +12,18 @@
 #include <sstream>
 #include <cassert>
 #include <map>
+#include <numeric>
+#include <optional>
 #include <ranges>
 #include <iomanip>
 #include <iostream>
 
-enum PropertyBits : uint8_t {
+#include "block_packing.h"
+
+// One bit per wctype class. The low eight come from UnicodeData.txt, the
+// rest are derived from them and stored so no classifier has to combine
+// bits at lookup time.
+enum PropertyBits : uint16_t {
   PROP_UPPER = 1 << 0,
   PROP_LOWER = 1 << 1,
   PROP_ALPHA = 1 << 2,
@@ -25,6 +32,10 @@ enum PropertyBits : uint8_t {
   PROP_BLANK = 1 << 5,
   PROP_CNTRL = 1 << 6,
   PROP_PUNCT = 1 << 7,
+  PROP_GRAPH = 1 << 8,
+  PROP_ALNUM = 1 << 9,
+  PROP_DIGIT = 1 << 10,
+  PROP_XDIGIT = 1 << 11,
 };
 
 // Non-whitespace spaces in C.UTF-8
@@ -86,11 +97,11 @@ inline std::vector<UnicodeEntry> read_unicode_data(
 }
 
 // Handles Unicode ranges defined by <First> and <Last>
-inline void handle_ranges(std::unordered_map<uint32_t, uint8_t> &properties,
+inline void handle_ranges(std::unordered_map<uint32_t, uint16_t> &properties,
                           const std::vector<UnicodeEntry> &entries) {
   struct RangeInfo {
     uint32_t start;
-    uint8_t props;
+    uint16_t props;
   };
 
   std::optional<RangeInfo> range_info;
@@ -108,11 +119,11 @@ inline void handle_ranges(std::unordered_map<uint32_t, uint8_t> &properties,
 }
 
 // Creates the properties flag for a given UnicodeEntry
-inline uint8_t get_props(const UnicodeEntry &entry) {
+inline uint16_t get_props(const UnicodeEntry &entry) {
   const uint32_t codepoint = entry.codepoint;
   const std::string_view category = entry.category;
 
-  uint8_t props = 0;
+  uint16_t props = 0;
   // Letter
   if (starts_with(category, 'L')) {
     props |= PROP_ALPHA;
@@ -170,7 +181,7 @@ inline uint8_t get_props(const UnicodeEntry &entry) {
 
 // Handle special cases not parseable from UnicodeData.txt
 inline void handle_special_cases(
-    std::unordered_map<uint32_t, uint8_t> &properties) {
+    std::unordered_map<uint32_t, uint16_t> &properties) {
   // ASCII whitespace characters
   properties[0x0020] |= PROP_SPACE; // SPACE
   properties[0x0009] |= PROP_SPACE; // TAB
@@ -182,13 +193,40 @@ inline void handle_special_cases(
   // Blank (horizontal spacing only)
   properties[0x0020] |= PROP_BLANK; // SPACE
   properties[0x0009] |= PROP_BLANK; // TAB
+
+  // ASCII digits are Nd, but digit & alpha must be disjoint for iswalpha
+  for (uint32_t codepoint = '0'; codepoint <= '9'; ++codepoint) {
+    properties[codepoint] &= ~PROP_ALPHA;
+  }
+
+  // Digits are ASCII only in C.UTF-8
+  for (uint32_t codepoint = '0'; codepoint <= '9'; ++codepoint) {
+    properties[codepoint] |= PROP_DIGIT | PROP_XDIGIT;
+  }
+  for (uint32_t codepoint : {'A', 'B', 'C', 'D', 'E', 'F'}) {
+    properties[codepoint] |= PROP_XDIGIT;
+    properties[codepoint + 0x20] |= PROP_XDIGIT;
+  }
+}
+
+// Classes that combine others, once the base bits are final
+inline void handle_derived_classes(
+    std::unordered_map<uint32_t, uint16_t> &properties) {
+  for (auto &props : properties | std::views::values) {
+    if ((props & PROP_PRINT) && !(props & PROP_SPACE)) {
+      props |= PROP_GRAPH;
+    }
+    if (props & (PROP_ALPHA | PROP_DIGIT)) {
+      props |= PROP_ALNUM;
+    }
+  }
 }
 
 
 // Returns codepoint -> property flag mappings
-inline std::unordered_map<uint32_t, uint8_t> parse_unicode_data(
+inline std::unordered_map<uint32_t, uint16_t> parse_unicode_data(
     const std::vector<UnicodeEntry> &entries) {
-  std::unordered_map<uint32_t, uint8_t> properties;
+  std::unordered_map<uint32_t, uint16_t> properties;
 
   for (const auto &entry : entries) {
     const uint32_t codepoint = entry.codepoint;
@@ -203,6 +241,7 @@ inline std::unordered_map<uint32_t, uint8_t> parse_unicode_data(
 
   handle_ranges(properties, entries);
   handle_special_cases(properties);
+  handle_derived_classes(properties);
 
   // TODO: assert disjoint set invariants defined by C standard
   // digit & alpha must be disjoint
@@ -214,70 +253,668 @@ inline std::unordered_map<uint32_t, uint8_t> parse_unicode_data(
 }
 
 struct StagedLookupTable {
-  std::vector<uint16_t> level1; // Maps codepoint >> 8 to level2 offset
-  std::vector<uint8_t> level2; // Actual properties
+  TableShape shape;
+  std::vector<uint32_t> level1; // Maps codepoint >> block_bits into level2
+  std::vector<uint16_t> level2; // Actual properties
+
+  size_t bytes() const {
+    return level1.size() * index_width(level1) + level2.size() * 2;
+  }
 };
 
+// How often each block (codepoint >> 8) is looked up in typical text
+using BlockProfile = std::unordered_map<uint32_t, uint64_t>;
+
+// Profile file: one "<block in hex> <hits>" per line, '#' starts a comment
+inline BlockProfile read_block_profile(const std::string_view filename) {
+  std::ifstream file(filename.data());
+  if (!file.is_open()) {
+    throw std::runtime_error("Cannot open file: " + std::string(filename));
+  }
+
+  BlockProfile profile;
+  std::string line;
+  while (std::getline(file, line)) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields(line);
+    uint32_t block;
+    uint64_t hits;
+    if (fields >> std::hex >> block >> std::dec >> hits) {
+      profile[block] += hits;
+    }
+  }
+  return profile;
+}
+
+// Two-level table for the codepoints from first_codepoint on, level1 is
+// indexed by (codepoint - first_codepoint) >> block_bits. Blocks hit in
+// profile come first in level2, hottest first, so the common ones share
+// cache lines and pages. U+0000..U+00FF stay contiguous at the start of
+// level2 whatever the block size, the bulk kernels read them as one array.
 inline StagedLookupTable build_lookup_tables(
-    const std::unordered_map<uint32_t, uint8_t> &properties) {
+    const std::unordered_map<uint32_t, uint16_t> &properties,
+    uint32_t first_codepoint = 0, const BlockProfile &profile = {},
+    const TableShape &shape = {}) {
   constexpr uint32_t unicode_max = 0x110000;
-  constexpr uint32_t block_size = 256;
-  constexpr uint32_t num_blocks = unicode_max / block_size;
-
-  // Block type: 256 property values
-  using Block = std::array<uint8_t, block_size>;
-
-  // Map: block content -> block index in level2
-  std::map<Block, size_t> blocks;
-  std::vector<uint16_t> level1;
-  std::vector<uint8_t> level2;
-
-  for (uint32_t block_num = 0; block_num < num_blocks; ++block_num) {
-    // Extract properties for this 256-character block
-    Block block_content;
-    for (uint32_t offset = 0; offset < block_size; ++offset) {
-      uint32_t codepoint = block_num << 8 | offset;
+  const uint32_t block_size = 1u << shape.block_bits;
+  const uint32_t num_blocks = (unicode_max - first_codepoint) / block_size;
+  // Blocks that make up unique block 0
+  const uint32_t lead_blocks =
+      first_codepoint == 0 ? std::max(1u, 256u >> shape.block_bits) : 1;
+
+  const auto block_at = [&](uint32_t block_num, uint32_t count) {
+    std::vector<uint16_t> block(count * block_size);
+    for (uint32_t offset = 0; offset < block.size(); ++offset) {
+      uint32_t codepoint = first_codepoint + block_num * block_size + offset;
       auto it = properties.find(codepoint);
-      const uint8_t props = it != properties.end() ? it->second : 0;
-      block_content[offset] = props;
+      block[offset] = it != properties.end() ? it->second : 0;
     }
+    return block;
+  };
+
+  // Where a level1 entry points: unique block, and how far into it
+  struct Slot {
+    size_t block;
+    uint32_t offset;
+  };
+
+  // Map: block content -> slot, in order of first appearance. Blocks equal
+  // to a part of block 0 point there. Keyed by their bytes, GCC 12 warns
+  // spuriously about comparing vector keys.
+  const auto key = [&](const uint16_t *block) {
+    return std::string(reinterpret_cast<const char *>(block), block_size * 2);
+  };
+  std::map<std::string, Slot> blocks;
+  std::vector<std::vector<uint16_t>> unique_blocks{block_at(0, lead_blocks)};
+  std::vector<Slot> slots;
+  for (uint32_t i = 0; i < lead_blocks; ++i) {
+    blocks.emplace(key(unique_blocks[0].data() + i * block_size),
+                   Slot{0, i * block_size});
+    slots.push_back({0, i * block_size});
+  }
+
+  for (uint32_t block_num = lead_blocks; block_num < num_blocks; ++block_num) {
+    auto block_content = block_at(block_num, 1);
 
     // Check if we've seen this block before (block sharing)
-    if (auto it = blocks.find(block_content); it != blocks.end()) {
-      // Reuse existing block
-      level1.push_back(it->second);
-    } else {
-      // New block - add to level2
-      const size_t block_index = level2.size();
-      blocks[block_content] = block_index;
+    const auto [it, inserted] =
+        blocks.emplace(key(block_content.data()), Slot{unique_blocks.size(), 0});
+    if (inserted) {
+      unique_blocks.push_back(std::move(block_content));
+    }
+    slots.push_back(it->second);
+  }
+
+  // The first block keeps its place, then the hot ones
+  std::vector<uint64_t> hits(unique_blocks.size(), 0);
+  for (size_t i = 0; i < slots.size(); ++i) {
+    const uint32_t first = first_codepoint + i * block_size;
+    for (uint32_t block = first >> 8; block <= (first + block_size - 1) >> 8;
+         ++block) {
+      if (auto it = profile.find(block); it != profile.end()) {
+        hits[slots[i].block] += it->second;
+      }
+    }
+  }
+  std::vector<size_t> order(unique_blocks.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin() + 1, order.end(), [&](size_t a, size_t b) {
+    return hits[a] > hits[b];
+  });
+  const size_t hot = 1 + std::count_if(order.begin() + 1, order.end(),
+                                       [&](size_t i) { return hits[i] > 0; });
+  std::vector<std::vector<uint16_t>> ordered_blocks;
+  for (size_t i : order) {
+    ordered_blocks.push_back(unique_blocks[i]);
+  }
 
-      // Add all 256 entries to level2
-      level2.insert(level2.end(), block_content.begin(), block_content.end());
-      level1.push_back(block_index);
+  // Blocks may overlap in level2 when level1 holds offsets; block numbers
+  // need them block_size apart
+  std::vector<uint16_t> level2;
+  std::vector<size_t> offsets(unique_blocks.size());
+  if (shape.block_ids) {
+    for (size_t i = 0; i < order.size(); ++i) {
+      offsets[order[i]] = level2.size();
+      level2.insert(level2.end(), ordered_blocks[i].begin(),
+                    ordered_blocks[i].end());
+    }
+  } else {
+    auto packed = pack_blocks(ordered_blocks, hot);
+    level2 = std::move(packed.data);
+    for (size_t i = 0; i < order.size(); ++i) {
+      offsets[order[i]] = packed.offsets[i];
     }
   }
+  std::vector<uint32_t> level1;
+  for (const Slot &slot : slots) {
+    const size_t offset = offsets[slot.block] + slot.offset;
+    level1.push_back(shape.block_ids ? offset >> shape.block_bits : offset);
+  }
+  if (hot > 1) {
+    std::cout << "  Hot blocks first: " << hot << "\n";
+  }
+
   // Only keep level1 entries we actually need (up to the highest used codepoint)
-  uint32_t max_block = 0;
+  uint32_t max_codepoint = first_codepoint;
   for (const auto &codepoint : properties | std::views::keys) {
-    max_block = std::max(max_block, codepoint >> 8);
+    max_codepoint = std::max(max_codepoint, codepoint);
   }
-  level1.resize(max_block + 1);
+  level1.resize(((max_codepoint - first_codepoint) >> shape.block_bits) + 1);
 
+  const StagedLookupTable table{shape, level1, level2};
   std::cout << "Table statistics:\n";
+  std::cout << "  Block size: " << block_size << ", level1 holds "
+      << (shape.block_ids ? "block numbers" : "offsets") << "\n";
   std::cout << "  Level 1 entries: " << level1.size() << "\n";
   std::cout << "  Level 2 entries: " << level2.size() << "\n";
   std::cout << "  Unique blocks: " << blocks.size() << "\n";
-  std::cout << "  Block sharing: " << (0x1100 - blocks.size()) <<
-      " blocks saved\n";
-  std::cout << "  Memory: Level1=" << (level1.size() * 2) << " bytes, "
-      << "Level2=" << (level2.size() * 1) << " bytes\n";
+  std::cout << "  Block sharing: " << (num_blocks - blocks.size())
+      << " blocks saved\n";
+  std::cout << "  Memory: Level1=" << (level1.size() * index_width(level1))
+      << " bytes, " << "Level2=" << (level2.size() * 2) << " bytes\n";
+
+  return table;
+}
+
+// Direct-mapped BMP, two-level table for the supplementary planes only
+struct FlatBmpTable {
+  std::vector<uint16_t> bmp; // Properties of U+0000..U+FFFF
+  StagedLookupTable supplementary; // From U+10000 on
+};
+
+inline FlatBmpTable build_flat_bmp_table(
+    const std::unordered_map<uint32_t, uint16_t> &properties,
+    const BlockProfile &profile = {}) {
+  constexpr uint32_t bmp_size = 0x10000;
+
+  std::vector<uint16_t> bmp(bmp_size, 0);
+  for (const auto &[codepoint, props] : properties) {
+    if (codepoint < bmp_size) {
+      bmp[codepoint] = props;
+    }
+  }
+
+  std::cout << "Flat BMP table: " << bmp.size() * 2 << " bytes\n";
+  return {bmp, build_lookup_tables(properties, bmp_size, profile)};
+}
+
+// Three-stage trie: level1[cp >> (mid_bits + leaf_bits)] picks a level2
+// block, whose entry for the middle bits picks a level3 leaf. Both index
+// tables store block numbers rather than offsets, so either one is a byte
+// wide as long as it points at no more than 256 blocks.
+struct ThreeStageTable {
+  unsigned mid_bits;
+  unsigned leaf_bits;
+  std::vector<uint16_t> level1; // Block number in level2
+  std::vector<uint16_t> level2; // Leaf number in level3
+  std::vector<uint16_t> level3; // Properties, U+0000..U+00FF first
+
+  size_t level1_width() const {
+    return level2.size() >> mid_bits > 256 ? 2 : 1;
+  }
+  size_t level2_width() const {
+    return level3.size() >> leaf_bits > 256 ? 2 : 1;
+  }
+
+  size_t bytes() const {
+    return level1.size() * level1_width() + level2.size() * level2_width() +
+           level3.size() * 2;
+  }
+};
+
+inline ThreeStageTable build_three_stage_table(
+    const std::vector<uint16_t> &props, unsigned mid_bits, unsigned leaf_bits) {
+  const size_t leaf_size = size_t{1} << leaf_bits;
+  const size_t block_size = size_t{1} << mid_bits;
+  ThreeStageTable table{mid_bits, leaf_bits, {}, {}, {}};
+
+  // Latin-1 leaves go first and stay verbatim so the bulk kernels can index
+  // U+0000..U+00FF directly; later leaves may still share them
+  // Leaves are keyed by their bytes: comparing vector keys trips a bogus
+  // -Wstringop-overread in GCC 12
+  std::map<std::string, uint16_t> leaves;
+  std::vector<uint16_t> leaf_of;
+  for (size_t begin = 0; begin < props.size(); begin += leaf_size) {
+    const std::string leaf(reinterpret_cast<const char *>(&props[begin]),
+                           leaf_size * 2);
+    const auto number = static_cast<uint16_t>(table.level3.size() >> leaf_bits);
+    if (begin < 0x100) {
+      leaves.emplace(leaf, number);
+    } else if (auto it = leaves.find(leaf); it != leaves.end()) {
+      leaf_of.push_back(it->second);
+      continue;
+    } else {
+      leaves.emplace(leaf, number);
+    }
+    table.level3.insert(table.level3.end(), props.begin() + begin,
+                        props.begin() + begin + leaf_size);
+    leaf_of.push_back(number);
+  }
+
+  std::map<std::vector<uint16_t>, uint16_t> blocks;
+  for (size_t begin = 0; begin < leaf_of.size(); begin += block_size) {
+    std::vector<uint16_t> block(leaf_of.begin() + begin,
+                                leaf_of.begin() + begin + block_size);
+    const auto number = static_cast<uint16_t>(table.level2.size() >> mid_bits);
+    const auto [it, inserted] = blocks.emplace(block, number);
+    if (inserted) {
+      table.level2.insert(table.level2.end(), block.begin(), block.end());
+    }
+    table.level1.push_back(it->second);
+  }
+  return table;
+}
+
+// Tries every split of the codepoint bits and keeps the smallest table
+inline ThreeStageTable build_three_stage_table(
+    const std::unordered_map<uint32_t, uint16_t> &properties) {
+  uint32_t max_codepoint = 0;
+  for (const auto &codepoint : properties | std::views::keys) {
+    max_codepoint = std::max(max_codepoint, codepoint);
+  }
+
+  std::optional<ThreeStageTable> best;
+  for (unsigned leaf_bits = 2; leaf_bits <= 8; ++leaf_bits) {
+    for (unsigned mid_bits = 2; mid_bits <= 8; ++mid_bits) {
+      // Pad to whole level1 entries
+      const uint32_t span = uint32_t{1} << (mid_bits + leaf_bits);
+      std::vector<uint16_t> props((max_codepoint / span + 1) * span, 0);
+      for (const auto &[codepoint, value] : properties) {
+        props[codepoint] = value;
+      }
+      auto table = build_three_stage_table(props, mid_bits, leaf_bits);
+      if (!best || table.bytes() < best->bytes()) {
+        best = std::move(table);
+      }
+    }
+  }
+
+  std::cout << "Three-stage table:\n";
+  std::cout << "  Split: " << (21 - best->mid_bits - best->leaf_bits) << "/"
+      << best->mid_bits << "/" << best->leaf_bits << " bits\n";
+  std::cout << "  Memory: Level1=" << best->level1.size() * best->level1_width()
+      << " bytes, Level2=" << best->level2.size() * best->level2_width()
+      << " bytes, Level3=" << best->level3.size() * 2 << " bytes\n";
+  return *best;
+}
+
+// One bitset per property bit: level1 maps codepoint >> 8 to a block of
+// four 64-bit words, deduplicated per property
+struct BitPlane {
+  std::string name;
+  std::vector<uint8_t> level1; // Block number, up to the last set bit
+  std::vector<uint64_t> words;
+};
+
+inline std::vector<BitPlane> build_bit_planes(
+    const std::unordered_map<uint32_t, uint16_t> &properties) {
+  constexpr uint32_t num_blocks = 0x110000 >> 8;
+  constexpr const char *names[] = {"upper", "lower", "alpha", "space",
+                                   "print", "blank", "cntrl", "punct",
+                                   "graph", "alnum", "digit", "xdigit"};
+
+  std::cout << "Bit planes:\n";
+  std::vector<BitPlane> planes;
+  for (unsigned bit = 0; bit < std::size(names); ++bit) {
+    BitPlane plane{names[bit], {}, {}};
+    std::map<std::array<uint64_t, 4>, uint8_t> blocks;
+    uint32_t last_block = 0;
+    for (uint32_t block_num = 0; block_num < num_blocks; ++block_num) {
+      std::array<uint64_t, 4> block{};
+      for (uint32_t offset = 0; offset < 256; ++offset) {
+        auto it = properties.find(block_num << 8 | offset);
+        if (it != properties.end() && it->second >> bit & 1) {
+          block[offset >> 6] |= uint64_t{1} << (offset & 63);
+        }
+      }
+      if (block != std::array<uint64_t, 4>{}) {
+        last_block = block_num;
+      }
+
+      auto it = blocks.find(block);
+      if (it == blocks.end()) {
+        if (blocks.size() == 256) {
+          throw std::runtime_error("Too many blocks for a uint8_t level1");
+        }
+        it = blocks.emplace(block, blocks.size()).first;
+        plane.words.insert(plane.words.end(), block.begin(), block.end());
+      }
+      plane.level1.push_back(it->second);
+    }
+    plane.level1.resize(last_block + 1);
+
+    std::cout << "  " << plane.name << ": Level1=" << plane.level1.size()
+        << " bytes, Words=" << plane.words.size() * 8 << " bytes\n";
+    planes.push_back(std::move(plane));
+  }
+  return planes;
+}
+
+inline void generate_bit_planes(const std::vector<BitPlane> &planes) {
+  std::ofstream f("wctype_bitplanes.h");
+  f << R"(// Auto-generated by generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef WCTYPE_BITPLANES_H
+#define WCTYPE_BITPLANES_H
+
+#include <stdint.h>
+
+// One bitset per property: level1 maps codepoint >> 8 to a block of four
+// 64-bit words, and bit cp & 63 of word (cp >> 6) & 3 is set iff cp has
+// the property
+namespace wctype_bitplanes {
+
+struct Plane {
+  const uint8_t *level1;
+  const uint64_t *words;
+  uint32_t limit; // First codepoint past level1
+};
+)";
+  for (const auto &plane : planes) {
+    f << "\nalignas(64) inline constexpr uint8_t " << plane.name << "_level1["
+        << plane.level1.size() << "] = {\n";
+    for (size_t i = 0; i < plane.level1.size(); i += 16) {
+      f << " ";
+      for (size_t j = i; j < i + 16 && j < plane.level1.size(); ++j) {
+        f << " " << static_cast<int>(plane.level1[j]) << ",";
+      }
+      f << "\n";
+    }
+    f << "};\n\nalignas(64) inline constexpr uint64_t " << plane.name
+        << "_words[" << plane.words.size() << "] = {\n";
+    for (size_t i = 0; i < plane.words.size(); i += 4) {
+      f << "   ";
+      for (size_t j = i; j < i + 4; ++j) {
+        f << " 0x" << std::hex << std::setw(16) << std::setfill('0')
+            << plane.words[j] << std::dec << std::setfill(' ') << ",";
+      }
+      f << "\n";
+    }
+    f << "};\n";
+  }
+
+  f << R"(
+// Indexed by the bit number of the PropertyBits flag
+inline constexpr Plane planes[)" << planes.size() << R"(] = {
+)";
+  for (const auto &plane : planes) {
+    f << "    {" << plane.name << "_level1, " << plane.name << "_words, "
+        << plane.level1.size() << " << 8},\n";
+  }
+  f << R"(};
+
+// Bits of the 64 codepoints from cp & ~63 on
+constexpr uint64_t word(const Plane &plane, uint32_t cp) {
+  return cp < plane.limit
+             ? plane.words[plane.level1[cp >> 8] * 4 + (cp >> 6 & 3)]
+             : 0;
+}
+
+constexpr bool test(const Plane &plane, uint32_t cp) {
+  return word(plane, cp) >> (cp & 63) & 1;
+}
+
+} // namespace wctype_bitplanes
+
+#endif // WCTYPE_BITPLANES_H
+)";
+}
+
+// A range the generated lookup answers before the tables: a constant when
+// every codepoint in it has the same properties, else a load from a copy of
+// its entries (or from the layout's own Latin-1 entries for block 0)
+struct FastPath {
+  uint32_t first;
+  uint32_t last;
+  uint64_t hits;
+  std::optional<uint16_t> uniform;
+};
+
+inline constexpr size_t max_fast_paths = 4;
+
+// Blocks with a smaller share of the profile's hits get no check of their
+// own, since every check is paid for by the codepoints that miss it
+inline constexpr double min_fast_path_share = 0.02;
+
+// Property word of cp as lookup_properties returns it
+inline uint16_t properties_of(
+    const std::unordered_map<uint32_t, uint16_t> &properties, uint32_t cp) {
+  if (cp >= 0xD800 && cp <= 0xDFFF) {
+    return 0;
+  }
+  auto it = properties.find(cp);
+  return it != properties.end() ? it->second : 0;
+}
+
+inline std::optional<uint16_t> uniform_block(
+    const std::unordered_map<uint32_t, uint16_t> &properties, uint32_t block) {
+  const uint16_t first = properties_of(properties, block << 8);
+  for (uint32_t offset = 1; offset < 256; ++offset) {
+    if (properties_of(properties, block << 8 | offset) != first) {
+      return std::nullopt;
+    }
+  }
+  return first;
+}
+
+// Checks for the hottest blocks of profile, hottest first. A uniform block
+// grows into the run of neighbouring blocks with the same properties, which
+// is how e.g. all of U+4E00..U+9FFF becomes one check. Without a profile
+// only Latin-1 gets one.
+inline std::vector<FastPath> build_fast_paths(
+    const std::unordered_map<uint32_t, uint16_t> &properties,
+    const BlockProfile &profile) {
+  constexpr uint32_t num_blocks = 0x110000 >> 8;
+  std::vector<std::pair<uint32_t, uint64_t>> blocks;
+  uint64_t total = 0;
+  for (const auto &[block, hits] : profile) {
+    if (block < num_blocks) {
+      blocks.emplace_back(block, hits);
+      total += hits;
+    }
+  }
+  if (blocks.empty()) {
+    blocks.emplace_back(0, 1);
+    total = 1;
+  }
+  std::ranges::sort(blocks, [](const auto &a, const auto &b) {
+    return a.second != b.second ? a.second > b.second : a.first < b.first;
+  });
+
+  std::vector<FastPath> paths;
+  for (const auto &[block, hits] : blocks) {
+    const uint32_t first = block << 8;
+    const bool covered = std::ranges::any_of(paths, [&](const FastPath &p) {
+      return first >= p.first && first <= p.last;
+    });
+    if (covered || paths.size() == max_fast_paths ||
+        hits < total * min_fast_path_share) {
+      continue;
+    }
+
+    FastPath path{first, first | 0xFF, 0, uniform_block(properties, block)};
+    if (path.uniform) {
+      for (uint32_t b = block;
+           b > 0 && uniform_block(properties, b - 1) == path.uniform; --b) {
+        path.first = (b - 1) << 8;
+      }
+      for (uint32_t b = block + 1;
+           b < num_blocks && uniform_block(properties, b) == path.uniform;
+           ++b) {
+        path.last = b << 8 | 0xFF;
+      }
+    }
+    paths.push_back(path);
+  }
+
+  // Neighbouring blocks share a check and a copy
+  std::ranges::sort(paths, {}, &FastPath::first);
+  std::vector<FastPath> merged;
+  for (const auto &path : paths) {
+    if (!merged.empty() && merged.back().last + 1 == path.first &&
+        merged.back().first != 0 && !merged.back().uniform && !path.uniform) {
+      merged.back().last = path.last;
+    } else {
+      merged.push_back(path);
+    }
+  }
+  paths = std::move(merged);
+
+  // A run also takes the hits of the colder blocks in it
+  for (auto &path : paths) {
+    for (const auto &[block, hits] : blocks) {
+      if (block << 8 >= path.first && block << 8 <= path.last) {
+        path.hits += hits;
+      }
+    }
+  }
+  std::ranges::stable_sort(paths, std::greater{}, &FastPath::hits);
 
-  return {level1, level2};
+  std::cout << "Fast paths (" << total << " profiled hits):\n";
+  for (const auto &path : paths) {
+    std::cout << "  U+" << std::hex << std::uppercase << std::setfill('0')
+        << std::setw(4) << path.first << "..U+" << std::setw(4) << path.last
+        << std::dec << std::nouppercase << std::setfill(' ') << ": "
+        << path.hits << " hits" << (path.uniform ? ", uniform" : "") << "\n";
+  }
+  return paths;
+}
+
+inline void generate_fast_paths(
+    const std::vector<FastPath> &paths,
+    const std::unordered_map<uint32_t, uint16_t> &properties) {
+  const auto hex = [](uint32_t value, int width) {
+    std::ostringstream s;
+    s << "0x" << std::hex << std::uppercase << std::setw(width)
+        << std::setfill('0') << value;
+    return s.str();
+  };
+
+  std::ofstream f("wctype_fast_paths.h");
+  f << R"(// Auto-generated by generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef WCTYPE_FAST_PATHS_H
+#define WCTYPE_FAST_PATHS_H
+
+#include "wctype_table.h"
+
+// lookup_properties with a check for each of the block profile's hottest
+// ranges in front of the tables, hottest first
+namespace wctype_fast_paths {
+)";
+  for (const auto &path : paths) {
+    if (path.uniform || path.first == 0) {
+      continue;
+    }
+    const uint32_t size = path.last - path.first + 1;
+    f << "\nWCTYPE_INDEX_TABLE(fast_path_" << std::hex << path.first
+        << ")\ninline constexpr uint16_t range_" << path.first << std::dec
+        << "[" << size << "] = {\n";
+    for (uint32_t i = 0; i < size; i += 8) {
+      f << " ";
+      for (uint32_t j = i; j < i + 8; ++j) {
+        f << " " << hex(properties_of(properties, path.first + j), 4) << ",";
+      }
+      f << "\n";
+    }
+    f << "};\n";
+  }
+
+  f << R"(
+constexpr uint16_t lookup_properties(wint_t wc) {
+)";
+  for (const auto &path : paths) {
+    f << "  // U+" << hex(path.first, 4).substr(2) << "..U+"
+        << hex(path.last, 4).substr(2) << ", " << path.hits
+        << " profiled hits\n";
+    if (path.first == 0) {
+      f << "  if (wc <= " << hex(path.last, 4) << ") {\n";
+    } else {
+      f << "  if (wc - " << hex(path.first, 4)
+          << " <= " << hex(path.last - path.first, 4) << ") {\n";
+    }
+    if (path.uniform) {
+      f << "    return " << hex(*path.uniform, 4) << ";\n";
+    } else if (path.first == 0) {
+      f << "    return wctype_layout::entry(0)[wc];\n";
+    } else {
+      f << "    return range_" << std::hex << path.first << std::dec << "[wc - "
+          << hex(path.first, 4) << "];\n";
+    }
+    f << "  }\n";
+  }
+  f << R"(  return ::lookup_properties(wc);
+}
+
+// Whether lookup_properties answers wc without the tables
+constexpr bool covers(wint_t wc) {
+  return )";
+  for (size_t i = 0; i < paths.size(); ++i) {
+    const auto &path = paths[i];
+    f << (i == 0 ? "" : " ||\n         ");
+    if (path.first == 0) {
+      f << "wc <= " << hex(path.last, 4);
+    } else {
+      f << "wc - " << hex(path.first, 4) << " <= "
+          << hex(path.last - path.first, 4);
+    }
+  }
+  f << (paths.empty() ? "false" : "") << R"(;
+}
+
+} // namespace wctype_fast_paths
+
+#endif // WCTYPE_FAST_PATHS_H
+)";
 }
 
-inline void generate_code(const StagedLookupTable &lookup_table) {
-  auto level1 = lookup_table.level1;
-  auto level2 = lookup_table.level2;
+template <typename Index>
+void generate_level1_inc(const std::vector<Index> &level1,
+                         const std::string_view filename,
+                         const std::string_view comment) {
+  std::ofstream f(filename.data());
+  f << "// Auto-generated " << comment << "\n";
+  for (size_t i = 0; i < level1.size(); i += 8) {
+    f << "  ";
+    for (size_t j = i; j < i + 8 && j < level1.size(); ++j) {
+      f << std::setw(5) << level1[j];
+      if (j + 1 < level1.size()) {
+        f << ",";
+      }
+    }
+    f << "\n";
+  }
+}
+
+inline void generate_properties_inc(const std::vector<uint16_t> &props,
+                                    const std::string_view filename,
+                                    const std::string_view comment) {
+  std::ofstream f(filename.data());
+  f << "// Auto-generated " << comment << "\n";
+  for (size_t i = 0; i < props.size(); i += 8) {
+    f << "  ";
+    for (size_t j = i; j < i + 8 && j < props.size(); ++j) {
+      f << "0x" << std::hex << std::setw(4) << std::setfill('0') << props[j]
+          << std::dec << std::setfill(' ');
+      if (j + 1 < props.size()) {
+        f << ", ";
+      }
+    }
+    f << "\n";
+  }
+}
+
+inline void generate_code(const StagedLookupTable &lookup_table,
+                          const FlatBmpTable &flat_bmp_table,
+                          const ThreeStageTable &three_stage_table) {
+  const auto &level1 = lookup_table.level1;
+  const auto &level2 = lookup_table.level2;
+  const auto &supplementary = flat_bmp_table.supplementary;
+  const auto &trie = three_stage_table;
+  // The flat layout's supplementary table is always 256-entry blocks
+  assert(supplementary.shape.block_bits == 8 && !supplementary.shape.block_ids);
   // Generate property bit definitions
   {
     std::ofstream f("wctype_properties.h");
@@ -289,7 +926,8 @@ inline void generate_code(const StagedLookupTable &lookup_table) {
 
 #include <stdint.h>
 
-enum PropertyBits : uint8_t {
+// One bit per wctype class; GRAPH and up are derived from the others
+enum PropertyBits : uint16_t {
   PROP_UPPER = 1 << 0,
   PROP_LOWER = 1 << 1,
   PROP_ALPHA = 1 << 2,
@@ -298,44 +936,34 @@ enum PropertyBits : uint8_t {
   PROP_BLANK = 1 << 5,
   PROP_CNTRL = 1 << 6,
   PROP_PUNCT = 1 << 7,
+  PROP_GRAPH = 1 << 8,
+  PROP_ALNUM = 1 << 9,
+  PROP_DIGIT = 1 << 10,
+  PROP_XDIGIT = 1 << 11,
 };
 
+// All of the above
+inline constexpr uint16_t PROP_ALL = 0x0FFF;
+
 #endif // WCTYPE_PROPERTIES_H
 )";
   }
-  // Generate level1 table
-  {
-    std::ofstream f("wctype_level1.inc");
-    f << "// Auto-generated level1 table\n";
-    for (size_t i = 0; i < level1.size(); i += 8) {
-      f << "  ";
-      for (size_t j = i; j < i + 8 && j < level1.size(); ++j) {
-        f << std::setw(5) << level1[j];
-        if (j + 1 < level1.size()) {
-          f << ",";
-        }
-      }
-      f << "\n";
-    }
-  }
-  // Generate level2 table
-  {
-    std::ofstream f("wctype_level2.inc");
-    f << "// Auto-generated level2 table\n";
-    for (size_t i = 0; i < level2.size(); i += 8) {
-      f << "  ";
-      for (size_t j = i; j < i + 8 && j < level2.size(); ++j) {
-        f << "0x" << std::hex << std::setw(2) << std::setfill('0') <<
-            static_cast<int>(level2[j])
-            << std::dec <<
-            std::setfill(' ');
-        if (j + 1 < level2.size()) {
-          f << ", ";
-        }
-      }
-      f << "\n";
-    }
-  }
+  generate_level1_inc(level1, "wctype_level1.inc", "level1 table");
+  generate_properties_inc(level2, "wctype_level2.inc", "level2 table");
+  generate_properties_inc(flat_bmp_table.bmp, "wctype_flat_bmp.inc",
+                          "flat BMP table");
+  generate_level1_inc(supplementary.level1, "wctype_flat_bmp_level1.inc",
+                      "supplementary level1 table");
+  generate_properties_inc(supplementary.level2,
+                          "wctype_flat_bmp_level2.inc",
+                          "supplementary level2 table");
+  generate_level1_inc(trie.level1, "wctype_three_stage_level1.inc",
+                      "three-stage level1 table");
+  generate_level1_inc(trie.level2, "wctype_three_stage_level2.inc",
+                      "three-stage level2 table");
+  generate_properties_inc(trie.level3, "wctype_three_stage_level3.inc",
+                          "three-stage level3 table");
+
   // Generate the main header with lookup function
   {
     std::ofstream f("wctype_table.h");
@@ -349,33 +977,178 @@ enum PropertyBits : uint8_t {
 #include <stdint.h>
 #include <wctype.h>
 
-// Level 1 table: maps upper 8 bits to level2 offset
-inline constexpr uint16_t level1[)" << level1.size() << R"(] = {
+// Every layout is always available under its own namespace;
+// WCTYPE_TABLE_LAYOUT picks the one behind lookup_properties
+#define WCTYPE_LAYOUT_TWO_LEVEL 1
+#define WCTYPE_LAYOUT_FLAT_BMP 2
+#define WCTYPE_LAYOUT_THREE_STAGE 3
+
+#ifndef WCTYPE_TABLE_LAYOUT
+#define WCTYPE_TABLE_LAYOUT WCTYPE_LAYOUT_TWO_LEVEL
+#endif
+
+// Tables live in read-only wctype_tables.* sections, index tables cache-line
+// aligned and property tables page aligned, so the hot blocks at the start
+// of level2 share as few lines and pages as possible. One section per table:
+// GCC would put inline variables sharing a section into one COMDAT group.
+#if defined(__GNUC__) && defined(__ELF__)
+#define WCTYPE_TABLE_SECTION(name)                                             \
+  __attribute__((section("wctype_tables." #name)))
+#else
+#define WCTYPE_TABLE_SECTION(name)
+#endif
+#define WCTYPE_INDEX_TABLE(name) alignas(64) WCTYPE_TABLE_SECTION(name)
+#define WCTYPE_DATA_TABLE(name) alignas(4096) WCTYPE_TABLE_SECTION(name)
+
+namespace wctype_two_level {
+
+// )" << (1u << lookup_table.shape.block_bits)
+        << "-codepoint blocks; level1 holds "
+        << (lookup_table.shape.block_ids ? "block numbers" : "level2 offsets")
+        << R"(
+inline constexpr unsigned block_bits = )" << lookup_table.shape.block_bits
+        << R"(;
+inline constexpr unsigned index_shift = )"
+        << (lookup_table.shape.block_ids ? lookup_table.shape.block_bits : 0)
+        << R"(;
+
+// Level 1 table: maps codepoint >> block_bits to level2 offset >> index_shift
+WCTYPE_INDEX_TABLE(two_level_level1)
+inline constexpr )" << index_type(index_width(level1)) << " level1["
+        << level1.size() << R"(] = {
 #include "wctype_level1.inc"
 };
 
 // Level 2 table: property bitfields for each character
-inline constexpr uint8_t level2[)" << level2.size() << R"(] = {
+WCTYPE_DATA_TABLE(two_level_level2)
+inline constexpr uint16_t level2[)" << level2.size() << R"(] = {
 #include "wctype_level2.inc"
 };
 
-inline uint8_t lookup_properties(wint_t wc) {
+// First codepoint past the table
+inline constexpr uint32_t limit = )" << level1.size() << R"(u << block_bits;
+
+// Property word of cp, for cp < limit
+constexpr const uint16_t *entry(uint32_t cp) {
+  return &level2[(level1[cp >> block_bits] << index_shift) +
+                 (cp & ((1u << block_bits) - 1))];
+}
+
+constexpr uint16_t lookup_properties(wint_t wc) {
   // Out of Unicode range
   if (wc > 0x10FFFF || (wc >= 0xD800 && wc <= 0xDFFF)) {
     return 0;
   }
 
-  unsigned l1_idx = wc >> 8;
+  unsigned l1_idx = wc >> block_bits;
   if (l1_idx >= )" << level1.size() << R"() {
     return 0;
   }
 
-  unsigned l2_offset = level1[l1_idx];
-  unsigned l2_idx = l2_offset + (wc & 0xFF);
+  unsigned l2_offset = level1[l1_idx] << index_shift;
+  unsigned l2_idx = l2_offset + (wc & ((1u << block_bits) - 1));
 
   return level2[l2_idx];
 }
 
+} // namespace wctype_two_level
+
+// BMP direct-mapped, no dependent level1 load; two-level for the rest
+namespace wctype_flat_bmp {
+
+WCTYPE_DATA_TABLE(flat_bmp_bmp)
+inline constexpr uint16_t bmp[0x10000] = {
+#include "wctype_flat_bmp.inc"
+};
+
+// Level 1 table: maps (codepoint >> 8) - 0x100 to level2 offset
+WCTYPE_INDEX_TABLE(flat_bmp_level1)
+inline constexpr )" << index_type(index_width(supplementary.level1))
+        << " level1[" << supplementary.level1.size() << R"(] = {
+#include "wctype_flat_bmp_level1.inc"
+};
+
+// Level 2 table: property bitfields for the supplementary planes
+WCTYPE_DATA_TABLE(flat_bmp_level2)
+inline constexpr uint16_t level2[)" << supplementary.level2.size()
+        << R"(] = {
+#include "wctype_flat_bmp_level2.inc"
+};
+
+// First codepoint past the table
+inline constexpr uint32_t limit = 0x10000 + ()" << supplementary.level1.size()
+        << R"( << 8);
+
+// Property word of cp, for cp < limit
+constexpr const uint16_t *entry(uint32_t cp) {
+  return cp < 0x10000 ? &bmp[cp]
+                      : &level2[level1[(cp >> 8) - 0x100] + (cp & 0xFF)];
+}
+
+// Surrogates are zero in the table
+constexpr uint16_t lookup_properties(wint_t wc) {
+  return wc < limit ? *entry(wc) : 0;
+}
+
+} // namespace wctype_flat_bmp
+
+// Smallest three-stage split the generator found: )"
+        << (21 - trie.mid_bits - trie.leaf_bits) << "/" << trie.mid_bits
+        << "/" << trie.leaf_bits << R"( bits
+namespace wctype_three_stage {
+
+inline constexpr unsigned mid_bits = )" << trie.mid_bits << R"(;
+inline constexpr unsigned leaf_bits = )" << trie.leaf_bits << R"(;
+
+// Level 1 table: maps codepoint >> (mid_bits + leaf_bits) to a level2 block
+WCTYPE_INDEX_TABLE(three_stage_level1)
+inline constexpr )" << index_type(trie.level1_width()) << " level1["
+        << trie.level1.size() << R"(] = {
+#include "wctype_three_stage_level1.inc"
+};
+
+// Level 2 table: maps the middle bits within a block to a level3 leaf
+WCTYPE_INDEX_TABLE(three_stage_level2)
+inline constexpr )" << index_type(trie.level2_width()) << " level2["
+        << trie.level2.size() << R"(] = {
+#include "wctype_three_stage_level2.inc"
+};
+
+// Level 3 table: property bitfields, U+0000..U+00FF first and contiguous
+WCTYPE_DATA_TABLE(three_stage_level3)
+inline constexpr uint16_t level3[)" << trie.level3.size() << R"(] = {
+#include "wctype_three_stage_level3.inc"
+};
+
+// First codepoint past the table
+inline constexpr uint32_t limit = )" << trie.level1.size()
+        << R"(u << (mid_bits + leaf_bits);
+
+// Property word of cp, for cp < limit
+constexpr const uint16_t *entry(uint32_t cp) {
+  const unsigned block = level1[cp >> (mid_bits + leaf_bits)];
+  const unsigned mid = (cp >> leaf_bits) & ((1u << mid_bits) - 1);
+  const unsigned leaf = level2[block << mid_bits | mid];
+  return &level3[leaf << leaf_bits | (cp & ((1u << leaf_bits) - 1))];
+}
+
+// Surrogates are zero in the table
+constexpr uint16_t lookup_properties(wint_t wc) {
+  return wc < limit ? *entry(wc) : 0;
+}
+
+} // namespace wctype_three_stage
+
+#if WCTYPE_TABLE_LAYOUT == WCTYPE_LAYOUT_FLAT_BMP
+namespace wctype_layout = wctype_flat_bmp;
+#elif WCTYPE_TABLE_LAYOUT == WCTYPE_LAYOUT_THREE_STAGE
+namespace wctype_layout = wctype_three_stage;
+#else
+namespace wctype_layout = wctype_two_level;
+#endif
+
+using wctype_layout::lookup_properties;
+
 #endif // WCTYPE_TABLE_H
 )";
   }
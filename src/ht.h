@@ -1,17 +1,13 @@
 #ifndef WCTYPE_SRC_HT_H
 #define WCTYPE_SRC_HT_H
 
-#include <unordered_map>
-#include <unordered_set>
-#include <wctype.h>
+#include "case_mapping_hash.h"
 
-static std::unordered_map<wint_t, wint_t> ht_upper_map = {
-#include "case_mapping_upper.inc"
-};
+#include <wctype.h>
 
-static std::unordered_map<wint_t, wint_t> ht_lower_map = {
-#include "case_mapping_lower.inc"
-};
+// Case conversion through the generated perfect hashes of
+// case_mapping_hash.h: constexpr tables in .rodata, one slot compared per
+// lookup
 
 // TODO(bassiounix): remove unnecessary passes
 // static std::unordered_set<wint_t> lower_classes = {
@@ -28,7 +24,7 @@ static std::unordered_map<wint_t, wint_t> ht_lower_map = {
 //     0x1F8A, 0x1F8E, 0x1F8C, 0x03F4, 0x1FFC, 0x1F98, 0x1F88, 0x1FA8, 0x1F89,
 //     0x1F9B, 0x1FAE, 0x1F9F, 0x1F99, 0x1F8F, 0x0130};
 
-inline wint_t towlower_impl(wint_t wc) noexcept {
+constexpr wint_t towlower_impl(wint_t wc) noexcept {
   if (wc == WEOF) {
     return WEOF;
   }
@@ -46,14 +42,10 @@ inline wint_t towlower_impl(wint_t wc) noexcept {
     return wc;  // ASCII non-letters
   }
 
-  if (ht_lower_map.find(wc) == ht_lower_map.end()) {
-    return wc;
-  }
-
-  return ht_lower_map[wc];
+  return case_hash_towlower(wc);
 }
 
-inline wint_t towupper_impl(wint_t wc) noexcept {
+constexpr wint_t towupper_impl(wint_t wc) noexcept {
   // Handle special cases
   if (wc == WEOF) {
     return WEOF;
@@ -72,10 +64,6 @@ inline wint_t towupper_impl(wint_t wc) noexcept {
     return wc;  // ASCII non-letters
   }
 
-  if (ht_upper_map.find(wc) == ht_upper_map.end()) {
-    return wc;
-  }
-
-  return ht_upper_map.at(wc);
+  return case_hash_towupper(wc);
 }
 #endif  // WCTYPE_SRC_HT_H
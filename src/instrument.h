@@ -0,0 +1,260 @@
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#include <cstdint>
+
+// Hot-path counters of MYWCTYPE_INSTRUMENT builds: per function, how many
+// calls a fast path answered, how many went to the tables and, for case
+// conversion, how many found no mapping there; plus how often each chunk of
+// the classification layout's property array was read. Without
+// MYWCTYPE_INSTRUMENT only the function names below exist and mywctype.h
+// counts nothing.
+namespace my_wctype::instrument {
+
+enum class Function : uint8_t {
+  iswalnum,
+  iswalpha,
+  iswblank,
+  iswcntrl,
+  iswdigit,
+  iswgraph,
+  iswlower,
+  iswprint,
+  iswpunct,
+  iswspace,
+  iswupper,
+  iswxdigit,
+  iswctype,
+  towlower,
+  towupper,
+};
+
+inline constexpr size_t function_count = 15;
+
+inline constexpr const char *function_names[function_count] = {
+    "iswalnum", "iswalpha", "iswblank", "iswcntrl", "iswdigit",
+    "iswgraph", "iswlower", "iswprint", "iswpunct", "iswspace",
+    "iswupper", "iswxdigit", "iswctype", "towlower", "towupper",
+};
+
+} // namespace my_wctype::instrument
+
+#ifdef MYWCTYPE_INSTRUMENT
+
+#include "wctype_fast_paths.h"
+#include "wctype_table.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace my_wctype::instrument {
+
+struct FunctionCounters {
+  uint64_t fast_path = 0;
+  uint64_t table = 0;
+  uint64_t unmapped = 0; // Case conversions the table left unchanged
+
+  uint64_t calls() const { return fast_path + table; }
+};
+
+// The property array of the layout in 256-entry chunks (8 cache lines); a
+// flat BMP layout's chunks are its BMP rows, then its supplementary level2
+#if WCTYPE_TABLE_LAYOUT == WCTYPE_LAYOUT_FLAT_BMP
+inline constexpr size_t heatmap_chunks =
+    256 + (std::size(wctype_flat_bmp::level2) + 255) / 256;
+
+inline size_t table_chunk(uint32_t cp) {
+  return cp < 0x10000
+             ? cp >> 8
+             : 256 + (wctype_flat_bmp::entry(cp) - wctype_flat_bmp::level2) /
+                         256;
+}
+#elif WCTYPE_TABLE_LAYOUT == WCTYPE_LAYOUT_THREE_STAGE
+inline constexpr size_t heatmap_chunks =
+    (std::size(wctype_three_stage::level3) + 255) / 256;
+
+inline size_t table_chunk(uint32_t cp) {
+  return (wctype_three_stage::entry(cp) - wctype_three_stage::level3) / 256;
+}
+#else
+inline constexpr size_t heatmap_chunks =
+    (std::size(wctype_two_level::level2) + 255) / 256;
+
+inline size_t table_chunk(uint32_t cp) {
+  return (wctype_two_level::entry(cp) - wctype_two_level::level2) / 256;
+}
+#endif
+
+// Every thread's counters added up
+struct Snapshot {
+  std::array<FunctionCounters, function_count> functions{};
+  std::vector<uint64_t> heatmap = std::vector<uint64_t>(heatmap_chunks);
+
+  const FunctionCounters &operator[](Function f) const {
+    return functions[static_cast<size_t>(f)];
+  }
+};
+
+namespace detail {
+
+// Written by its own thread only, so an increment is a relaxed load and
+// store rather than a locked add; snapshot() reads them from other threads
+struct ThreadCounters {
+  std::array<std::array<std::atomic<uint64_t>, 3>, function_count> functions{};
+  std::array<std::atomic<uint64_t>, heatmap_chunks> heatmap{};
+
+  ThreadCounters();
+  ~ThreadCounters();
+
+  void add_to(Snapshot &snapshot) const {
+    for (size_t f = 0; f < function_count; ++f) {
+      snapshot.functions[f].fast_path +=
+          functions[f][0].load(std::memory_order_relaxed);
+      snapshot.functions[f].table +=
+          functions[f][1].load(std::memory_order_relaxed);
+      snapshot.functions[f].unmapped +=
+          functions[f][2].load(std::memory_order_relaxed);
+    }
+    for (size_t c = 0; c < heatmap_chunks; ++c) {
+      snapshot.heatmap[c] += heatmap[c].load(std::memory_order_relaxed);
+    }
+  }
+
+  void clear() {
+    for (auto &counters : functions) {
+      for (auto &counter : counters) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+    for (auto &counter : heatmap) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+  }
+};
+
+// Live threads, and the totals of those that have exited
+struct Registry {
+  std::mutex mutex;
+  std::vector<ThreadCounters *> threads;
+  Snapshot exited;
+};
+
+inline Registry &registry() {
+  static Registry instance;
+  return instance;
+}
+
+inline ThreadCounters::ThreadCounters() {
+  std::lock_guard lock(registry().mutex);
+  registry().threads.push_back(this);
+}
+
+inline ThreadCounters::~ThreadCounters() {
+  std::lock_guard lock(registry().mutex);
+  add_to(registry().exited);
+  std::erase(registry().threads, this);
+}
+
+inline ThreadCounters &local() {
+  thread_local ThreadCounters counters;
+  return counters;
+}
+
+inline void bump(std::atomic<uint64_t> &counter) {
+  counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+// A classification: answered by the fast paths of wctype_fast_paths.h when
+// those are in use, else by the tables
+inline void count_lookup(Function f, uint32_t cp) {
+  auto &counters = detail::local();
+#ifdef MYWCTYPE_FAST_PATHS
+  if (wctype_fast_paths::covers(cp)) {
+    detail::bump(counters.functions[static_cast<size_t>(f)][0]);
+    return;
+  }
+#endif
+  detail::bump(counters.functions[static_cast<size_t>(f)][1]);
+  if (cp < wctype_layout::limit && (cp < 0xD800 || cp > 0xDFFF)) {
+    detail::bump(counters.heatmap[table_chunk(cp)]);
+  }
+}
+
+// A call answered without any table
+inline void count_fast_path(Function f) {
+  detail::bump(detail::local().functions[static_cast<size_t>(f)][0]);
+}
+
+// A case conversion that went to the tables
+inline void count_case_lookup(Function f, bool mapped) {
+  auto &counters = detail::local().functions[static_cast<size_t>(f)];
+  detail::bump(counters[1]);
+  if (!mapped) {
+    detail::bump(counters[2]);
+  }
+}
+
+inline Snapshot snapshot() {
+  auto &registry = detail::registry();
+  std::lock_guard lock(registry.mutex);
+  Snapshot total = registry.exited;
+  for (const auto *thread : registry.threads) {
+    thread->add_to(total);
+  }
+  return total;
+}
+
+// Zeroes every counter; increments racing with it may survive
+inline void reset() {
+  auto &registry = detail::registry();
+  std::lock_guard lock(registry.mutex);
+  registry.exited = Snapshot{};
+  for (auto *thread : registry.threads) {
+    thread->clear();
+  }
+}
+
+// The counters of every function that was called, then the heatmap chunks
+// that were read, hottest first
+inline void dump(std::ostream &out) {
+  const Snapshot total = snapshot();
+  out << "function        calls    fast path        table     unmapped\n";
+  for (size_t f = 0; f < function_count; ++f) {
+    const auto &c = total.functions[f];
+    if (c.calls() != 0) {
+      out << std::left << std::setw(10) << function_names[f] << std::right
+          << std::setw(11) << c.calls() << std::setw(13) << c.fast_path
+          << std::setw(13) << c.table << std::setw(13) << c.unmapped << "\n";
+    }
+  }
+
+  std::vector<std::pair<uint64_t, size_t>> chunks;
+  uint64_t reads = 0;
+  for (size_t c = 0; c < total.heatmap.size(); ++c) {
+    if (total.heatmap[c] != 0) {
+      chunks.emplace_back(total.heatmap[c], c);
+      reads += total.heatmap[c];
+    }
+  }
+  std::ranges::sort(chunks, std::greater{});
+  out << "\ntable chunk (256 entries)        reads  share\n";
+  for (const auto &[hits, chunk] : chunks) {
+    out << std::setw(25) << chunk << std::setw(13) << hits << std::setw(6)
+        << hits * 100 / reads << "%\n";
+  }
+}
+
+} // namespace my_wctype::instrument
+
+#endif // MYWCTYPE_INSTRUMENT
+
+#endif // INSTRUMENT_H
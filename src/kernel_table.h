@@ -0,0 +1,47 @@
+#ifndef WCTYPE_SRC_KERNEL_TABLE_H
+#define WCTYPE_SRC_KERNEL_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace my_wctype::dispatch {
+
+enum class Isa {
+  Scalar,
+  SSE42,
+  AVX2,
+  AVX512,
+};
+
+// Bulk kernels of one instruction set, see bulk_kernels.h for what each
+// of them does
+struct KernelTable {
+  Isa isa;
+  void (*classify)(const wchar_t *in, size_t n, uint16_t *out);
+  void (*classify_scattered)(const wchar_t *in, size_t n, uint16_t *out);
+  void (*class_bitmaps)(const wchar_t *in, size_t n, const uint16_t *descs,
+                        size_t count, uint64_t *bitmaps);
+  size_t (*find_class)(const wchar_t *in, size_t n, uint16_t mask,
+                       bool match);
+  void (*class_counts)(const wchar_t *in, size_t n, size_t *counts);
+};
+
+// One per kernels_<isa>.cpp, each compiled with its own -m flags
+extern const KernelTable scalar_kernels;
+extern const KernelTable sse42_kernels;
+extern const KernelTable avx2_kernels;
+extern const KernelTable avx512_kernels;
+
+} // namespace my_wctype::dispatch
+
+// The kernels bulk_kernels.h was compiled into in the including file
+#define MYWCTYPE_KERNEL_TABLE(isa)                                             \
+  {                                                                            \
+    isa, &::my_wctype::detail::classify_n,                                     \
+        &::my_wctype::detail::lookup_properties_pipelined,                     \
+        &::my_wctype::detail::class_bitmaps_n,                                 \
+        &::my_wctype::detail::find_class_n,                                    \
+        &::my_wctype::detail::class_counts_n                                   \
+  }
+
+#endif // WCTYPE_SRC_KERNEL_TABLE_H
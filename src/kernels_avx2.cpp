@@ -0,0 +1,7 @@
+// Built with -mavx2 -mbmi2 -mpopcnt, see CMakeLists.txt
+#include "bulk_kernels.h"
+#include "kernel_table.h"
+
+namespace my_wctype::dispatch {
+const KernelTable avx2_kernels = MYWCTYPE_KERNEL_TABLE(Isa::AVX2);
+} // namespace my_wctype::dispatch
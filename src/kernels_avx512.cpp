@@ -0,0 +1,7 @@
+// Built with -mavx512f -mavx512bw -mavx2 -mbmi2 -mpopcnt, see CMakeLists.txt
+#include "bulk_kernels.h"
+#include "kernel_table.h"
+
+namespace my_wctype::dispatch {
+const KernelTable avx512_kernels = MYWCTYPE_KERNEL_TABLE(Isa::AVX512);
+} // namespace my_wctype::dispatch
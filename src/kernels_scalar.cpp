@@ -0,0 +1,7 @@
+// Built with MYWCTYPE_SCALAR_KERNELS: no intrinsics, runs anywhere, see CMakeLists.txt
+#include "bulk_kernels.h"
+#include "kernel_table.h"
+
+namespace my_wctype::dispatch {
+const KernelTable scalar_kernels = MYWCTYPE_KERNEL_TABLE(Isa::Scalar);
+} // namespace my_wctype::dispatch
@@ -0,0 +1,7 @@
+// Built with -msse4.2 -mpopcnt, see CMakeLists.txt
+#include "bulk_kernels.h"
+#include "kernel_table.h"
+
+namespace my_wctype::dispatch {
+const KernelTable sse42_kernels = MYWCTYPE_KERNEL_TABLE(Isa::SSE42);
+} // namespace my_wctype::dispatch
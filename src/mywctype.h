@@ -2,226 +2,478 @@
 #define MYWCTYPE_H
 
 #include "wctype_table.h"
-// #include "case_mapping.h"
-// #include "case_mapping_staged.h"
-#include "ht.h"
-
+#include "wctype_fast_paths.h"
+#include "wctype_class_case.h"
+// #include "case_search.h"
+#include "case_mapping_staged.h"
+// #include "ht.h"
+#include "bulk_kernels.h"
+#include "instrument.h"
+#ifdef MYWCTYPE_PROFILE
+#include "block_profiler.h"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <span>
 #include <string_view>
+#include <utility>
 
 namespace my_wctype {
 
-using mywctype_t = uint8_t;
-
-inline constexpr mywctype_t WCTYPE_ALNUM = 1;
-inline constexpr mywctype_t WCTYPE_ALPHA = 2;
-inline constexpr mywctype_t WCTYPE_BLANK = 3;
-inline constexpr mywctype_t WCTYPE_CNTRL = 4;
-inline constexpr mywctype_t WCTYPE_DIGIT = 5;
-inline constexpr mywctype_t WCTYPE_GRAPH = 6;
-inline constexpr mywctype_t WCTYPE_LOWER = 7;
-inline constexpr mywctype_t WCTYPE_PRINT = 8;
-inline constexpr mywctype_t WCTYPE_PUNCT = 9;
-inline constexpr mywctype_t WCTYPE_SPACE = 10;
-inline constexpr mywctype_t WCTYPE_UPPER = 11;
-inline constexpr mywctype_t WCTYPE_XDIGIT = 12;
-
-inline int iswalpha(wchar_t wc) {
-  // Fast path: ASCII
-  if (wc <= 0x7F) {
-    return (wc >= 'A' && wc <= 'Z') || (wc >= 'a' && wc <= 'z');
+// A descriptor is a set of PropertyBits, so a union of classes such as
+// WCTYPE_ALPHA | WCTYPE_DIGIT is a descriptor too
+using mywctype_t = uint16_t;
+
+inline constexpr mywctype_t WCTYPE_ALNUM = PROP_ALNUM;
+inline constexpr mywctype_t WCTYPE_ALPHA = PROP_ALPHA;
+inline constexpr mywctype_t WCTYPE_BLANK = PROP_BLANK;
+inline constexpr mywctype_t WCTYPE_CNTRL = PROP_CNTRL;
+inline constexpr mywctype_t WCTYPE_DIGIT = PROP_DIGIT;
+inline constexpr mywctype_t WCTYPE_GRAPH = PROP_GRAPH;
+inline constexpr mywctype_t WCTYPE_LOWER = PROP_LOWER;
+inline constexpr mywctype_t WCTYPE_PRINT = PROP_PRINT;
+inline constexpr mywctype_t WCTYPE_PUNCT = PROP_PUNCT;
+inline constexpr mywctype_t WCTYPE_SPACE = PROP_SPACE;
+inline constexpr mywctype_t WCTYPE_UPPER = PROP_UPPER;
+inline constexpr mywctype_t WCTYPE_XDIGIT = PROP_XDIGIT;
+
+namespace detail {
+
+// Counts the input in the block profile of MYWCTYPE_PROFILE builds, see
+// block_profiler.h; nothing otherwise
+template <typename Input>
+constexpr void record_profile([[maybe_unused]] Input in) {
+#ifdef MYWCTYPE_PROFILE
+  if !consteval {
+    block_profiler::record(in);
   }
+#endif
+}
 
-  // Fast path: Common CJK ranges (all alphabetic)
-  if ((wc >= 0x4E00 && wc <= 0x9FFF) || // CJK Unified Ideographs
-      (wc >= 0x3400 && wc <= 0x4DBF) || // CJK Extension A
-      (wc >= 0x20000 && wc <= 0x2A6DF)) {
-    // CJK Extension B
-    return 1;
+// Property word of wc; MYWCTYPE_FAST_PATHS puts the checks the generator
+// picked from the block profile in front of the tables. fn is the caller,
+// for the counters of MYWCTYPE_INSTRUMENT builds.
+constexpr uint16_t lookup(wchar_t wc,
+                          [[maybe_unused]] instrument::Function fn) {
+  record_profile(static_cast<wint_t>(wc));
+#ifdef MYWCTYPE_INSTRUMENT
+  if !consteval {
+    instrument::count_lookup(fn, static_cast<wint_t>(wc));
   }
+#endif
+#ifdef MYWCTYPE_FAST_PATHS
+  return wctype_fast_paths::lookup_properties(wc);
+#else
+  return lookup_properties(wc);
+#endif
+}
 
-  return lookup_properties(wc) & PROP_ALPHA;
+// The other counters of MYWCTYPE_INSTRUMENT builds, see instrument.h
+constexpr void count_fast_path([[maybe_unused]] instrument::Function fn) {
+#ifdef MYWCTYPE_INSTRUMENT
+  if !consteval {
+    instrument::count_fast_path(fn);
+  }
+#endif
 }
 
-inline int iswdigit(wchar_t wc) {
-  // Fast path: ASCII digits only in C.UTF-8
-  if (wc >= '0' && wc <= '9') {
-    return 1;
+constexpr void count_case_lookup([[maybe_unused]] instrument::Function fn,
+                                 [[maybe_unused]] bool mapped) {
+#ifdef MYWCTYPE_INSTRUMENT
+  if !consteval {
+    instrument::count_case_lookup(fn, mapped);
   }
-  return 0;
+#endif
 }
 
-inline int iswpunct(wchar_t wc) {
-  // TODO: ASCII fast path
-  return lookup_properties(wc) & PROP_PUNCT;
+} // namespace detail
+
+constexpr int iswalpha(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswalpha) & PROP_ALPHA;
 }
 
-inline int iswalnum(wchar_t wc) {
-  // Fast path: ASCII alphanumeric
-  if (wc <= 0x7F) {
-    return (wc >= 'A' && wc <= 'Z') ||
-           (wc >= 'a' && wc <= 'z') ||
-           (wc >= '0' && wc <= '9');
+constexpr int iswdigit(wchar_t wc) {
+  // Only the ASCII digits in C.UTF-8, so no table needed
+  detail::record_profile(static_cast<wint_t>(wc));
+  detail::count_fast_path(instrument::Function::iswdigit);
+  return static_cast<uint32_t>(wc) - '0' < 10;
+}
+
+constexpr int iswpunct(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswpunct) & PROP_PUNCT;
+}
+
+constexpr int iswalnum(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswalnum) & PROP_ALNUM;
+}
+
+constexpr int iswblank(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswblank) & PROP_BLANK;
+}
+
+constexpr int iswgraph(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswgraph) & PROP_GRAPH;
+}
+
+constexpr int iswlower(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswlower) & PROP_LOWER;
+}
+
+constexpr int iswupper(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswupper) & PROP_UPPER;
+}
+
+constexpr int iswspace(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswspace) & PROP_SPACE;
+}
+
+constexpr int iswprint(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswprint) & PROP_PRINT;
+}
+
+constexpr int iswcntrl(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswcntrl) & PROP_CNTRL;
+}
+
+constexpr int iswxdigit(wchar_t wc) {
+  return detail::lookup(wc, instrument::Function::iswxdigit) & PROP_XDIGIT;
+}
+
+namespace detail {
+
+inline constexpr std::pair<std::string_view, mywctype_t> class_names[] = {
+    {"alnum", WCTYPE_ALNUM}, {"alpha", WCTYPE_ALPHA}, {"blank", WCTYPE_BLANK},
+    {"cntrl", WCTYPE_CNTRL}, {"digit", WCTYPE_DIGIT}, {"graph", WCTYPE_GRAPH},
+    {"lower", WCTYPE_LOWER}, {"print", WCTYPE_PRINT}, {"punct", WCTYPE_PUNCT},
+    {"space", WCTYPE_SPACE}, {"upper", WCTYPE_UPPER},
+    {"xdigit", WCTYPE_XDIGIT}};
+
+// A class name as a template argument, see wctype<Name>()
+template <size_t N>
+struct ClassName {
+  char chars[N];
+
+  consteval ClassName(const char (&name)[N]) {
+    std::copy_n(name, N, chars);
   }
 
-  // Fast path: Common CJK ranges
-  if ((wc >= 0x4E00 && wc <= 0x9FFF) ||
-      (wc >= 0x3400 && wc <= 0x4DBF) ||
-      (wc >= 0x20000 && wc <= 0x2A6DF)) {
-    return 1;
+  constexpr std::string_view view() const { return {chars, N - 1}; }
+};
+
+} // namespace detail
+
+// Usable in constant expressions, e.g. iswctype<wctype("alpha")>(wc)
+constexpr mywctype_t wctype(const char *property) {
+  const std::string_view prop(property);
+  for (const auto &[name, desc] : detail::class_names) {
+    if (prop == name) {
+      return desc;
+    }
   }
+  return 0;
+}
 
-  // only need to check alpha, digit already checked
-  return lookup_properties(wc) & PROP_ALPHA;
+// wctype<"alpha">(): resolved at compile time, and an unknown name does
+// not compile
+template <detail::ClassName Name>
+consteval mywctype_t wctype() {
+  constexpr mywctype_t desc = wctype(Name.chars);
+  static_assert(desc != 0, "unknown character class name");
+  return desc;
 }
 
-inline int iswblank(wchar_t wc) {
-  // TODO: fast path
-  return lookup_properties(wc) & PROP_BLANK;
+// Nonzero when wc is in any class of desc
+constexpr int iswctype(wchar_t wc, mywctype_t desc) {
+  return detail::lookup(wc, instrument::Function::iswctype) &
+         detail::class_mask(desc);
 }
 
-inline int iswgraph(wchar_t wc) {
-  if (wc == 0x00A0) {
-    return 1;
+// iswctype with the descriptor fixed at compile time: the mask is an
+// immediate, and digit needs no table at all
+template <mywctype_t Desc>
+constexpr int iswctype(wchar_t wc) {
+  static_assert(Desc != 0 && detail::class_mask(Desc) == Desc,
+                "not a set of WCTYPE_* classes");
+  if constexpr (Desc == WCTYPE_DIGIT) {
+    return iswdigit(wc);
+  } else {
+    return detail::lookup(wc, instrument::Function::iswctype) & Desc;
   }
-  auto props = lookup_properties(wc);
-  return (props & PROP_PRINT) && !(props & PROP_SPACE);
 }
 
-inline int iswlower(wchar_t wc) {
-  // Fast path: ASCII lowercase
-  if (wc >= 'a' && wc <= 'z') {
-    return 1;
+// Number of uint64_t words in the bitmap of a buffer of n characters
+inline constexpr size_t bitmap_words(size_t n) { return (n + 63) / 64; }
+
+namespace detail {
+
+// Scalar forms of the bulk kernels, for constant evaluation where the SIMD
+// ones can't run
+
+constexpr void class_bitmaps_scalar(std::span<const wchar_t> in,
+                                    std::span<const mywctype_t> descs,
+                                    uint64_t *bitmaps) {
+  const size_t words = bitmap_words(in.size());
+  std::fill_n(bitmaps, descs.size() * words, 0);
+  for (size_t k = 0; k < descs.size(); ++k) {
+    for (size_t i = 0; i < in.size(); ++i) {
+      if (lookup_properties(in[i]) & class_mask(descs[k])) {
+        bitmaps[k * words + i / 64] |= uint64_t{1} << (i % 64);
+      }
+    }
   }
+}
 
-  return lookup_properties(wc) & PROP_LOWER;
+constexpr size_t find_class_scalar(std::span<const wchar_t> s, uint16_t mask,
+                                   bool match) {
+  for (size_t i = 0; i < s.size(); ++i) {
+    if (((lookup_properties(s[i]) & mask) != 0) == match) {
+      return i;
+    }
+  }
+  return s.size();
 }
 
-inline int iswupper(wchar_t wc) {
-  // Fast path: ASCII uppercase
-  if (wc >= 'A' && wc <= 'Z') {
-    return 1;
+} // namespace detail
+
+// Bulk iswctype: for each descs[k], bit i of the bitmap that starts at
+// bitmaps[k * bitmap_words(in.size())] is set iff iswctype(in[i], descs[k]).
+// Bits past the end of the input are cleared.
+constexpr void iswctype_bitmap(std::span<const wchar_t> in,
+                               std::span<const mywctype_t> descs,
+                               std::span<uint64_t> bitmaps) {
+  assert(bitmaps.size() >= descs.size() * bitmap_words(in.size()));
+  if consteval {
+    detail::class_bitmaps_scalar(in, descs, bitmaps.data());
+  } else {
+    detail::record_profile(in);
+    detail::class_bitmaps_n(in.data(), in.size(), descs.data(), descs.size(),
+                            bitmaps.data());
   }
+}
 
-  return lookup_properties(wc) & PROP_UPPER;
+// iswctype_bitmap for a single class, from the per-property bit-planes of
+// wctype_bitplanes.h: bit i of bitmap is set iff iswctype(in[i], desc). A
+// class touches only its own planes, which suits scans for one class such
+// as splitting on spaces.
+constexpr void class_bitmap_lookup(std::span<const wchar_t> in,
+                                   mywctype_t desc,
+                                   std::span<uint64_t> bitmap) {
+  assert(bitmap.size() >= bitmap_words(in.size()));
+  if consteval {
+    detail::class_bitmaps_scalar(in, {&desc, 1}, bitmap.data());
+  } else {
+    detail::record_profile(in);
+    detail::class_bitmap_lookup_n(in.data(), in.size(), desc, bitmap.data());
+  }
 }
 
-inline int iswspace(wchar_t wc) {
-  // TODO: fast path
+template <mywctype_t Desc>
+constexpr void class_bitmap_lookup(std::span<const wchar_t> in,
+                                   std::span<uint64_t> bitmap) {
+  assert(bitmap.size() >= bitmap_words(in.size()));
+  if consteval {
+    class_bitmap_lookup(in, Desc, bitmap);
+  } else {
+    detail::record_profile(in);
+    detail::class_bitmap_lookup_n<Desc>(in.data(), in.size(), bitmap.data());
+  }
+}
+
+// Index of the first character of s in class desc, or s.size() if there is
+// none (wcscspn over a character class)
+constexpr size_t find_first_of_class(std::span<const wchar_t> s,
+                                     mywctype_t desc) {
+  if consteval {
+    return detail::find_class_scalar(s, detail::class_mask(desc), true);
+  } else {
+    detail::record_profile(s);
+    return detail::find_class_n(s.data(), s.size(), detail::class_mask(desc),
+                                true);
+  }
+}
 
-  return lookup_properties(wc) & PROP_SPACE;
+// Same, for a character in any of the classes in descs
+constexpr size_t find_first_of_class(std::span<const wchar_t> s,
+                                     std::span<const mywctype_t> descs) {
+  return find_first_of_class(s,
+                             detail::class_mask(descs.data(), descs.size()));
 }
 
-inline int iswprint(wchar_t wc) {
-  // Fast path: ASCII printable characters
-  if (wc >= 0x20 && wc <= 0x7E) {
-    return 1;
+// Index of the first character of s not in class desc, or s.size() if there
+// is none (wcsspn over a character class)
+constexpr size_t find_first_not_of_class(std::span<const wchar_t> s,
+                                         mywctype_t desc) {
+  if consteval {
+    return detail::find_class_scalar(s, detail::class_mask(desc), false);
+  } else {
+    detail::record_profile(s);
+    return detail::find_class_n(s.data(), s.size(), detail::class_mask(desc),
+                                false);
   }
+}
+
+// Same, for a character in none of the classes in descs
+constexpr size_t find_first_not_of_class(std::span<const wchar_t> s,
+                                         std::span<const mywctype_t> descs) {
+  return find_first_not_of_class(
+      s, detail::class_mask(descs.data(), descs.size()));
+}
 
-  return lookup_properties(wc) & PROP_PRINT;
+constexpr bool all_of_class(std::span<const wchar_t> s, mywctype_t desc) {
+  return find_first_not_of_class(s, desc) == s.size();
 }
 
-inline int iswcntrl(wchar_t wc) {
-  // Fast path: ASCII and C1 control characters
-  if (wc <= 0x1F || (wc >= 0x7F && wc <= 0x9F)) {
-    return 1;
+// The scans above for a class known at compile time, with the class mask
+// and ASCII nibble table folded into the kernel
+template <mywctype_t Desc>
+constexpr size_t find_first_of_class(std::span<const wchar_t> s) {
+  if consteval {
+    return detail::find_class_scalar(s, detail::class_mask(Desc), true);
+  } else {
+    detail::record_profile(s);
+    return detail::find_class_n<detail::class_mask(Desc), true>(s.data(),
+                                                               s.size());
   }
+}
 
-  return lookup_properties(wc) & PROP_CNTRL;
+template <mywctype_t Desc>
+constexpr size_t find_first_not_of_class(std::span<const wchar_t> s) {
+  if consteval {
+    return detail::find_class_scalar(s, detail::class_mask(Desc), false);
+  } else {
+    detail::record_profile(s);
+    return detail::find_class_n<detail::class_mask(Desc), false>(s.data(),
+                                                                s.size());
+  }
+}
+
+template <mywctype_t Desc>
+constexpr bool all_of_class(std::span<const wchar_t> s) {
+  return find_first_not_of_class<Desc>(s) == s.size();
+}
+
+constexpr bool all_of_class(std::span<const wchar_t> s,
+                            std::span<const mywctype_t> descs) {
+  return find_first_not_of_class(s, descs) == s.size();
 }
 
-inline int iswxdigit(wchar_t wc) {
-  if ((wc >= '0' && wc <= '9') ||
-      (wc >= 'A' && wc <= 'F') ||
-      (wc >= 'a' && wc <= 'f')) {
-    return 1;
+// Number of characters in each class, see class_histogram
+struct ClassHistogram {
+  size_t total = 0;
+  // Indexed by the bit of each WCTYPE_* descriptor
+  std::array<size_t, detail::class_count> counts{};
+
+  // For a single class; unions and invalid descriptors count 0
+  constexpr size_t count(mywctype_t desc) const {
+    return std::has_single_bit(detail::class_mask(desc))
+               ? counts[std::countr_zero(desc)]
+               : 0;
   }
-  return 0;
+};
+
+// Counts every class over the whole buffer in a single pass, equivalent to
+// summing iswctype(c, desc) for each of the WCTYPE_* descriptors
+constexpr ClassHistogram class_histogram(std::span<const wchar_t> in) {
+  ClassHistogram histogram;
+  histogram.total = in.size();
+  if consteval {
+    for (wchar_t wc : in) {
+      const uint16_t props = lookup_properties(wc);
+      for (size_t b = 0; b < histogram.counts.size(); ++b) {
+        histogram.counts[b] += (props >> b) & 1;
+      }
+    }
+  } else {
+    detail::record_profile(in);
+    detail::class_counts_n(in.data(), in.size(), histogram.counts.data());
+  }
+  return histogram;
 }
 
-inline mywctype_t wctype(const char *property) {
-  std::string_view prop(property);
-
-  if (prop == "alnum")
-    return WCTYPE_ALNUM;
-  if (prop == "alpha")
-    return WCTYPE_ALPHA;
-  if (prop == "blank")
-    return WCTYPE_BLANK;
-  if (prop == "cntrl")
-    return WCTYPE_CNTRL;
-  if (prop == "digit")
-    return WCTYPE_DIGIT;
-  if (prop == "graph")
-    return WCTYPE_GRAPH;
-  if (prop == "lower")
-    return WCTYPE_LOWER;
-  if (prop == "print")
-    return WCTYPE_PRINT;
-  if (prop == "punct")
-    return WCTYPE_PUNCT;
-  if (prop == "space")
-    return WCTYPE_SPACE;
-  if (prop == "upper")
-    return WCTYPE_UPPER;
-  if (prop == "xdigit")
-    return WCTYPE_XDIGIT;
+// Writes lookup_properties(in[i]) to out[i] for the whole buffer. Runs of
+// ASCII are detected with a single SIMD compare and read straight from the
+// first level2 block, everything else goes through a branchless two-level
+// lookup.
+constexpr void classify(std::span<const wchar_t> in,
+                        std::span<uint16_t> out) {
+  assert(out.size() >= in.size());
+  if consteval {
+    std::ranges::transform(in, out.begin(), lookup_properties);
+  } else {
+    detail::record_profile(in);
+    detail::classify_n(in.data(), in.size(), out.data());
+  }
+}
 
-  return 0;
+// Same output as classify, for input that has no runs to exploit, like
+// dictionary keys or symbol table entries. Table loads of consecutive
+// characters are batched so their memory latency overlaps.
+constexpr void classify_scattered(std::span<const wchar_t> in,
+                                  std::span<uint16_t> out) {
+  assert(out.size() >= in.size());
+  if consteval {
+    std::ranges::transform(in, out.begin(), lookup_properties);
+  } else {
+    detail::record_profile(in);
+    detail::lookup_properties_pipelined(in.data(), in.size(), out.data());
+  }
 }
 
-inline int iswctype(wchar_t wc, mywctype_t desc) {
-  switch (desc) {
-  case WCTYPE_ALNUM:
-    return iswalnum(wc);
-  case WCTYPE_ALPHA:
-    return iswalpha(wc);
-  case WCTYPE_BLANK:
-    return iswblank(wc);
-  case WCTYPE_CNTRL:
-    return iswcntrl(wc);
-  case WCTYPE_DIGIT:
-    return iswdigit(wc);
-  case WCTYPE_GRAPH:
-    return iswgraph(wc);
-  case WCTYPE_LOWER:
-    return iswlower(wc);
-  case WCTYPE_PRINT:
-    return iswprint(wc);
-  case WCTYPE_PUNCT:
-    return iswpunct(wc);
-  case WCTYPE_SPACE:
-    return iswspace(wc);
-  case WCTYPE_UPPER:
-    return iswupper(wc);
-  case WCTYPE_XDIGIT:
-    return iswxdigit(wc);
-  default:
-    return 0;
-  }
-}
-
-inline wint_t towlower(wint_t wc) {
+constexpr wint_t towlower(wint_t wc) {
   // ASCII fast path
   if (wc >= L'A' && wc <= L'Z') {
+    detail::count_fast_path(instrument::Function::towlower);
     return wc + (L'a' - L'A');
   }
   // Other ASCII characters don't need conversion
   if (wc <= 0x7F) {
+    detail::count_fast_path(instrument::Function::towlower);
     return wc;
   }
-  return towlower_impl(wc);
+  const wint_t mapped = towlower_impl(wc);
+  detail::count_case_lookup(instrument::Function::towlower, mapped != wc);
+  return mapped;
 }
 
-inline wint_t towupper(wint_t wc) {
+constexpr wint_t towupper(wint_t wc) {
   // ASCII fast path
   if (wc >= L'a' && wc <= L'z') {
+    detail::count_fast_path(instrument::Function::towupper);
     return wc - (L'a' - L'A');
   }
   // Other ASCII characters don't need conversion
   if (wc <= 0x7F) {
+    detail::count_fast_path(instrument::Function::towupper);
     return wc;
   }
-  return towupper_impl(wc);
+  const wint_t mapped = towupper_impl(wc);
+  detail::count_case_lookup(instrument::Function::towupper, mapped != wc);
+  return mapped;
+}
+
+// A character's property word and one of its case mappings
+struct ClassifiedCase {
+  uint16_t properties;
+  wint_t mapped;
+};
+
+// lookup_properties(wc) and towlower(wc) from one lookup in the combined
+// table of wctype_class_case.h, for callers that test a class and then
+// convert the same character, like case-insensitive matchers
+constexpr ClassifiedCase classify_and_lower(wint_t wc) {
+  detail::record_profile(wc);
+  const auto &entry = wctype_class_case::entry(wc);
+  return {entry.properties, wctype_class_case::apply(wc, entry.lower)};
+}
+
+// lookup_properties(wc) and towupper(wc), as classify_and_lower
+constexpr ClassifiedCase classify_and_upper(wint_t wc) {
+  detail::record_profile(wc);
+  const auto &entry = wctype_class_case::entry(wc);
+  return {entry.properties, wctype_class_case::apply(wc, entry.upper)};
 }
 
 } // namespace my_wctype
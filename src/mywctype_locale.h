@@ -0,0 +1,190 @@
+#ifndef MYWCTYPE_LOCALE_H
+#define MYWCTYPE_LOCALE_H
+
+#include "mywctype.h"
+
+#include <array>
+#include <concepts>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace my_wctype {
+
+// The locales of the _l functions. In C only ASCII is classified and
+// converted: every other codepoint is in no class and maps to itself.
+enum class locale_kind : uint8_t { c, c_utf8 };
+
+// A locale known at compile time: the _l functions resolve it while
+// compiling, so a call costs the same as the function without _l
+template <locale_kind Kind>
+struct static_locale {
+  static constexpr locale_kind kind = Kind;
+};
+
+inline constexpr static_locale<locale_kind::c> c_locale{};
+inline constexpr static_locale<locale_kind::c_utf8> c_utf8_locale{};
+
+// A locale picked at run time, e.g. per request. The _l functions branch on
+// it per call; with_locale moves that branch out of a loop.
+struct mylocale_t {
+  locale_kind kind = locale_kind::c;
+
+  constexpr bool operator==(const mylocale_t &) const = default;
+};
+
+template <typename Locale>
+concept locale_handle = std::same_as<Locale, mylocale_t> ||
+                        std::same_as<Locale, static_locale<locale_kind::c>> ||
+                        std::same_as<Locale, static_locale<locale_kind::c_utf8>>;
+
+// "C" and "POSIX", or "C.UTF-8" and "C.utf8"; nullopt for anything else
+constexpr std::optional<mylocale_t> newlocale(std::string_view name) {
+  if (name == "C" || name == "POSIX") {
+    return mylocale_t{locale_kind::c};
+  }
+  if (name == "C.UTF-8" || name == "C.utf8") {
+    return mylocale_t{locale_kind::c_utf8};
+  }
+  return std::nullopt;
+}
+
+// Calls f with the static_locale of loc, so that f is compiled once per
+// locale and a loop inside it doesn't test the locale again
+template <typename F>
+constexpr decltype(auto) with_locale(mylocale_t loc, F &&f) {
+  if (loc.kind == locale_kind::c) {
+    return std::forward<F>(f)(c_locale);
+  }
+  return std::forward<F>(f)(c_utf8_locale);
+}
+
+namespace detail {
+
+// The C locale's classes: ASCII is classified as in C.UTF-8, so the table
+// is the first 128 entries of the full one
+inline constexpr auto c_properties = [] {
+  std::array<uint16_t, 128> table{};
+  for (uint32_t cp = 0; cp < table.size(); ++cp) {
+    table[cp] = lookup_properties(cp);
+  }
+  return table;
+}();
+
+template <locale_kind Kind>
+constexpr uint16_t lookup_properties_l(wchar_t wc) {
+  if constexpr (Kind == locale_kind::c) {
+    const auto cp = static_cast<uint32_t>(wc);
+    return cp < c_properties.size() ? c_properties[cp] : 0;
+  } else {
+    return lookup_properties(wc);
+  }
+}
+
+} // namespace detail
+
+template <locale_kind Kind>
+constexpr int iswctype_l(wchar_t wc, mywctype_t desc, static_locale<Kind>) {
+  return detail::lookup_properties_l<Kind>(wc) & detail::class_mask(desc);
+}
+
+constexpr int iswctype_l(wchar_t wc, mywctype_t desc, mylocale_t loc) {
+  return with_locale(loc, [=](auto l) { return iswctype_l(wc, desc, l); });
+}
+
+// Both locales know the same class names
+template <locale_handle Locale>
+constexpr mywctype_t wctype_l(const char *property, Locale) {
+  return wctype(property);
+}
+
+template <locale_handle Locale>
+constexpr int iswalnum_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_ALNUM, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswalpha_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_ALPHA, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswblank_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_BLANK, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswcntrl_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_CNTRL, loc);
+}
+
+// The digits are ASCII in both locales, so the locale doesn't matter
+template <locale_handle Locale>
+constexpr int iswdigit_l(wchar_t wc, Locale) {
+  return iswdigit(wc);
+}
+
+template <locale_handle Locale>
+constexpr int iswgraph_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_GRAPH, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswlower_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_LOWER, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswprint_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_PRINT, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswpunct_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_PUNCT, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswspace_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_SPACE, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswupper_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_UPPER, loc);
+}
+
+template <locale_handle Locale>
+constexpr int iswxdigit_l(wchar_t wc, Locale loc) {
+  return iswctype_l(wc, WCTYPE_XDIGIT, loc);
+}
+
+template <locale_kind Kind>
+constexpr wint_t towlower_l(wint_t wc, static_locale<Kind>) {
+  if constexpr (Kind == locale_kind::c) {
+    return wc >= L'A' && wc <= L'Z' ? wc + (L'a' - L'A') : wc;
+  } else {
+    return towlower(wc);
+  }
+}
+
+constexpr wint_t towlower_l(wint_t wc, mylocale_t loc) {
+  return with_locale(loc, [=](auto l) { return towlower_l(wc, l); });
+}
+
+template <locale_kind Kind>
+constexpr wint_t towupper_l(wint_t wc, static_locale<Kind>) {
+  if constexpr (Kind == locale_kind::c) {
+    return wc >= L'a' && wc <= L'z' ? wc - (L'a' - L'A') : wc;
+  } else {
+    return towupper(wc);
+  }
+}
+
+constexpr wint_t towupper_l(wint_t wc, mylocale_t loc) {
+  return with_locale(loc, [=](auto l) { return towupper_l(wc, l); });
+}
+
+} // namespace my_wctype
+
+#endif // MYWCTYPE_LOCALE_H
@@ -0,0 +1,182 @@
+#ifndef CASE_MAPPING_RULE_GENERATOR_H
+#define CASE_MAPPING_RULE_GENERATOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "block_packing.h"
+#include "conversion_generator.h"
+
+// Case mappings as rules "every stride-th codepoint of [first, first +
+// length) maps to codepoint + delta", stride 1 or 2. No mapping lies inside
+// a rule without following it, so the rule starting last at or before a
+// codepoint is the only one that can map it.
+struct CaseRule {
+  uint32_t first;
+  int32_t delta;
+  uint32_t length;
+  uint32_t stride;
+};
+
+// Rules longer than this are split, to keep the length in 16 bits
+inline constexpr uint32_t max_case_rule_length = 0xFFFF;
+
+// Codepoints per block of the rule index
+inline constexpr unsigned case_rule_block_bits = 8;
+
+inline std::vector<CaseRule>
+build_case_rules(const std::vector<CaseMapping> &mappings) {
+  std::vector<CaseRule> rules;
+  for (const auto &m : mappings) {
+    const int32_t delta =
+        static_cast<int32_t>(m.to) - static_cast<int32_t>(m.from);
+    if (!rules.empty()) {
+      auto &rule = rules.back();
+      const uint32_t last = rule.first + rule.length - 1;
+      const uint32_t step = m.from - last;
+      const bool fits = rule.delta == delta &&
+                        rule.length + step <= max_case_rule_length;
+      // A single-codepoint rule takes the stride of its second mapping
+      if (fits && rule.length == 1 && (step == 1 || step == 2)) {
+        rule.stride = step;
+        rule.length += step;
+        continue;
+      }
+      if (fits && step == rule.stride) {
+        rule.length += step;
+        continue;
+      }
+    }
+    rules.push_back({m.from, delta, 1, 1});
+  }
+
+  std::cout << "  Rules: " << rules.size() << " for " << mappings.size()
+      << " mappings\n";
+  return rules;
+}
+
+// Per block, the rule starting last at or before the block's first
+// codepoint; rules[index[b]] through rules[index[b + 1]] are the ones a
+// codepoint of block b can fall under. Rule 0 is a {0, 0, 0, 1} sentinel.
+inline std::vector<uint32_t>
+build_case_rule_index(const std::vector<CaseRule> &rules) {
+  const uint32_t blocks =
+      ((rules.back().first >> case_rule_block_bits) + 1) + 1;
+  std::vector<uint32_t> index(blocks);
+  size_t r = 0;
+  for (uint32_t b = 0; b < blocks; ++b) {
+    while (r + 1 < rules.size() &&
+           rules[r + 1].first <= b << case_rule_block_bits) {
+      ++r;
+    }
+    index[b] = static_cast<uint32_t>(r);
+  }
+  return index;
+}
+
+inline void write_case_rules(std::ofstream &f, const std::string &name,
+                             const std::vector<CaseRule> &rules,
+                             const std::vector<uint32_t> &index) {
+  f << "// " << rules.size() - 1 << " rules, " << index.size()
+    << " index blocks\n";
+  f << "inline constexpr CaseRule " << name << "_rules[" << rules.size()
+    << "] = {\n";
+  for (const auto &rule : rules) {
+    f << "    {0x" << std::hex << std::setw(6) << std::setfill('0')
+      << rule.first << std::dec << std::setfill(' ') << ", " << rule.delta
+      << ", " << rule.length << ", " << rule.stride - 1 << "},\n";
+  }
+  f << "};\n\n";
+
+  f << "inline constexpr " << index_type(index_width(index)) << " " << name
+    << "_rule_index[" << index.size() << "] = {";
+  for (size_t i = 0; i < index.size(); ++i) {
+    f << (i % 12 == 0 ? "\n    " : " ") << index[i] << ",";
+  }
+  f << "\n};\n\n";
+}
+
+inline void generate_case_rule_code(const std::vector<CaseMapping> &to_upper,
+                                    const std::vector<CaseMapping> &to_lower) {
+  std::vector<CaseRule> upper_rules = {{0, 0, 0, 1}};
+  std::vector<CaseRule> lower_rules = {{0, 0, 0, 1}};
+  std::cout << "\nCase rules:\n";
+  std::ranges::copy(build_case_rules(to_upper),
+                    std::back_inserter(upper_rules));
+  std::ranges::copy(build_case_rules(to_lower),
+                    std::back_inserter(lower_rules));
+
+  std::ofstream f("case_mapping_rules.h");
+  if (!f.is_open()) {
+    throw std::runtime_error("Cannot create case_mapping_rules.h");
+  }
+
+  f << R"(// Auto-generated by rule_conversion_generator.h
+// DO NOT EDIT MANUALLY
+
+#ifndef CASE_MAPPING_RULES_H
+#define CASE_MAPPING_RULES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Case mappings as rules: every (stride_mask + 1)-th codepoint of
+// [first, first + length) maps to codepoint + delta. A codepoint can only
+// fall under the rule starting last at or before it; the index narrows the
+// search for that rule to the few starting around the codepoint's block.
+struct CaseRule {
+  uint32_t first;
+  int32_t delta;
+  uint16_t length;
+  uint16_t stride_mask;
+};
+
+inline constexpr unsigned case_rule_block_bits = )" << case_rule_block_bits
+    << R"(;
+
+)";
+  write_case_rules(f, "to_upper", upper_rules,
+                   build_case_rule_index(upper_rules));
+  write_case_rules(f, "to_lower", lower_rules,
+                   build_case_rule_index(lower_rules));
+  f << R"(template <size_t Rules, typename Index, size_t Blocks>
+constexpr uint32_t case_rule_find(const CaseRule (&rules)[Rules],
+                                  const Index (&index)[Blocks], uint32_t cp) {
+  const uint32_t block = cp >> case_rule_block_bits;
+  const CaseRule *rule = &rules[index[Blocks - 1]];
+  if (block < Blocks - 1) {
+    // Branchless search over the rules the block can see
+    rule = &rules[index[block]];
+    size_t len = index[block + 1] - index[block] + 1;
+    while (len > 1) {
+      const size_t half = len / 2;
+      rule = rule[half].first <= cp ? rule + half : rule;
+      len -= half;
+    }
+  }
+  const uint32_t offset = cp - rule->first;
+  return offset < rule->length && (offset & rule->stride_mask) == 0
+             ? cp + rule->delta
+             : cp;
+}
+
+constexpr uint32_t case_rules_towupper(uint32_t cp) {
+  return case_rule_find(to_upper_rules, to_upper_rule_index, cp);
+}
+
+constexpr uint32_t case_rules_towlower(uint32_t cp) {
+  return case_rule_find(to_lower_rules, to_lower_rule_index, cp);
+}
+
+#endif // CASE_MAPPING_RULES_H
+)";
+}
+
+#endif // CASE_MAPPING_RULE_GENERATOR_H
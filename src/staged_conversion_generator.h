@@ -16,6 +16,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "block_packing.h"
+
 struct StagedCaseMappingEntry {
   uint32_t codepoint;
   uint32_t uppercase; // 0 if no uppercase mapping exists
@@ -88,19 +90,54 @@ read_staged_case_mappings(const std::string_view filename) {
   return entries;
 }
 
+// Codes below this one are escapes: code - INT16_MIN indexes a table of the
+// deltas too large for int16_t
+inline constexpr int32_t staged_case_escape_end = INT16_MIN + 64;
+
 struct StagedCaseTable {
-  std::vector<uint16_t> level1; // Maps codepoint >> 8 to level2 offset
-  std::vector<uint32_t> level2; // Target codepoints (or 0 for identity)
+  TableShape shape;
+  std::vector<uint32_t> level1; // Maps codepoint >> block_bits into level2
+  // Target codepoints (or 0 for identity); with deltas, the int16_t codes
+  // of target - codepoint (0 for identity) as uint16_t
+  std::vector<uint32_t> level2;
+  bool deltas = false;
+  std::vector<int32_t> escapes; // Deltas of the escape codes
+
+  size_t entry_width() const { return deltas ? 2 : 4; }
+
+  size_t bytes() const {
+    return level1.size() * index_width(level1) +
+           level2.size() * entry_width() + escapes.size() * 4;
+  }
 };
 
+// The level2 entry of a mapping from codepoint to target, adding its delta
+// to escapes when it doesn't fit int16_t
+inline uint32_t staged_case_code(uint32_t codepoint, uint32_t target,
+                                 std::vector<int32_t> &escapes) {
+  const int32_t delta =
+      static_cast<int32_t>(target) - static_cast<int32_t>(codepoint);
+  if (delta >= staged_case_escape_end && delta <= INT16_MAX) {
+    return static_cast<uint16_t>(delta);
+  }
+  auto it = std::ranges::find(escapes, delta);
+  if (it == escapes.end()) {
+    if (escapes.size() == staged_case_escape_end - INT16_MIN) {
+      throw std::runtime_error("Too many large case mapping deltas");
+    }
+    it = escapes.insert(escapes.end(), delta);
+  }
+  return static_cast<uint16_t>(INT16_MIN + (it - escapes.begin()));
+}
+
 inline StagedCaseTable build_staged_table(
     const std::vector<StagedCaseMappingEntry> &entries,
-    bool to_upper) {
+    bool to_upper, const TableShape &shape = {}, bool deltas = false) {
   constexpr uint32_t unicode_max = 0x110000;
-  constexpr uint32_t block_size = 256;
-  constexpr uint32_t num_blocks = unicode_max / block_size;
+  const uint32_t block_size = 1u << shape.block_bits;
+  const uint32_t num_blocks = unicode_max / block_size;
 
-  using Block = std::array<uint32_t, block_size>;
+  using Block = std::vector<uint32_t>;
 
   std::unordered_map<uint32_t, uint32_t> mappings;
   for (const auto &entry : entries) {
@@ -118,53 +155,79 @@ inline StagedCaseTable build_staged_table(
   std::cout << (to_upper ? "To-upper" : "To-lower") << " mappings: " << mappings
       .size() << "\n";
 
-  // Map: block content -> block index in level2
+  std::vector<int32_t> escapes;
+
+  // Map: block content -> block number, in order of first appearance
   std::map<Block, size_t> blocks;
-  std::vector<uint16_t> level1;
-  std::vector<uint32_t> level2;
+  std::vector<Block> unique_blocks;
+  std::vector<uint32_t> level1;
 
   for (uint32_t block_num = 0; block_num < num_blocks; ++block_num) {
-    Block block_content;
+    Block block_content(block_size);
     for (uint32_t offset = 0; offset < block_size; ++offset) {
-      uint32_t codepoint = (block_num << 8) | offset;
+      uint32_t codepoint = block_num << shape.block_bits | offset;
       auto it = mappings.find(codepoint);
-      if (it != mappings.end()) {
+      if (it != mappings.end() && deltas) {
+        block_content[offset] =
+            staged_case_code(codepoint, it->second, escapes);
+      } else if (it != mappings.end()) {
         block_content[offset] = it->second; // Store target codepoint
       } else {
         block_content[offset] = 0; // No mapping - will return identity
       }
     }
 
-    if (auto it = blocks.find(block_content); it != blocks.end()) {
-      level1.push_back(it->second);
-    } else {
-      const size_t block_index = level2.size();
-      blocks[block_content] = block_index;
+    const auto [it, inserted] =
+        blocks.emplace(block_content, unique_blocks.size());
+    if (inserted) {
+      unique_blocks.push_back(block_content);
+    }
+    level1.push_back(it->second);
+  }
 
-      level2.insert(level2.end(), block_content.begin(), block_content.end());
-      level1.push_back(block_index);
+  // Blocks may overlap in level2 when level1 holds offsets; block numbers
+  // index them block_size apart
+  std::vector<uint32_t> level2;
+  if (shape.block_ids) {
+    for (const auto &block : unique_blocks) {
+      level2.insert(level2.end(), block.begin(), block.end());
+    }
+  } else {
+    auto packed = pack_blocks(unique_blocks);
+    level2 = std::move(packed.data);
+    for (auto &entry : level1) {
+      entry = packed.offsets[entry];
     }
   }
 
   uint32_t max_block = 0;
   for (const auto &[codepoint, _] : mappings) {
-    max_block = std::max(max_block, codepoint >> 8);
+    max_block = std::max(max_block, codepoint >> shape.block_bits);
   }
   max_block = std::min(max_block + 1, num_blocks - 1);
   level1.resize(max_block + 1);
 
+  const StagedCaseTable table{shape, level1, level2, deltas, escapes};
+  std::cout << "  Block size: " << block_size << ", level1 holds "
+      << (shape.block_ids ? "block numbers" : "offsets") << ", level2 holds "
+      << (deltas ? "deltas" : "targets") << "\n";
   std::cout << "  Level 1 entries: " << level1.size() << "\n";
   std::cout << "  Level 2 entries: " << level2.size() << "\n";
   std::cout << "  Unique blocks: " << blocks.size() << "\n";
-  std::cout << "  Block sharing: " << (0x1100 - blocks.size()) <<
+  std::cout << "  Block sharing: " << (num_blocks - blocks.size()) <<
       " blocks saved\n";
-  std::cout << "  Memory: Level1=" << (level1.size() * 2) << " bytes, "
-      << "Level2=" << (level2.size() * 4) << " bytes\n";
+  std::cout << "  Memory: Level1=" << (level1.size() * index_width(level1))
+      << " bytes, " << "Level2=" << (level2.size() * table.entry_width())
+      << " bytes";
+  if (deltas) {
+    std::cout << ", Escapes=" << escapes.size() * 4 << " bytes";
+  }
+  std::cout << "\n";
 
-  return {level1, level2};
+  return table;
 }
 
-inline void generate_level1_inc(const std::vector<uint16_t> &level1,
+inline void generate_level1_inc(const std::vector<uint32_t> &level1,
                                 const std::string_view filename) {
   std::ofstream f(filename.data());
   f << "// Auto-generated level1 table\n";
@@ -180,15 +243,20 @@ inline void generate_level1_inc(const std::vector<uint16_t> &level1,
   }
 }
 
-inline void generate_level2_inc(const std::vector<uint32_t> &level2,
+inline void generate_level2_inc(const StagedCaseTable &table,
                                 const std::string_view filename) {
+  const auto &level2 = table.level2;
   std::ofstream f(filename.data());
   f << "// Auto-generated level2 table\n";
   for (size_t i = 0; i < level2.size(); i += 8) {
     f << "  ";
     for (size_t j = i; j < i + 8 && j < level2.size(); ++j) {
-      f << "0x" << std::hex << std::setw(8) << std::setfill('0') << level2[j] <<
-          std::dec << std::setfill(' ');
+      if (table.deltas) {
+        f << std::setw(6) << static_cast<int16_t>(level2[j]);
+      } else {
+        f << "0x" << std::hex << std::setw(8) << std::setfill('0')
+          << level2[j] << std::dec << std::setfill(' ');
+      }
       if (j + 1 < level2.size()) {
         f << ", ";
       }
@@ -197,16 +265,69 @@ inline void generate_level2_inc(const std::vector<uint32_t> &level2,
   }
 }
 
+// Level2 and, with deltas, the escapes of one direction, and the function
+// that turns a codepoint and its level2 index into the target
+inline void write_staged_level2(std::ofstream &f, const std::string &name,
+                                const StagedCaseTable &table,
+                                const std::string &inc) {
+  if (!table.deltas) {
+    f << R"(// Level 2: target codepoints (0 = no mapping, return identity)
+inline constexpr uint32_t )" << name << "_level2[" << table.level2.size()
+      << R"(] = {
+#include ")" << inc << R"("
+};
+
+constexpr wint_t )" << name << R"(_target(wint_t wc, unsigned l2_idx) {
+  const uint32_t target = )" << name << R"(_level2[l2_idx];
+  return target ? target : wc;
+}
+
+)";
+    return;
+  }
+
+  f << R"(// Level 2: target - codepoint (0 = no mapping, return identity); codes
+// below staged_case_escape_end stand for the escapes entry code - INT16_MIN
+inline constexpr int16_t )" << name << "_level2[" << table.level2.size()
+    << R"(] = {
+#include ")" << inc << R"("
+};
+
+inline constexpr int32_t )" << name << "_escapes["
+    << std::max<size_t>(table.escapes.size(), 1) << "] = {";
+  for (size_t i = 0; i < table.escapes.size(); ++i) {
+    f << (i % 8 == 0 ? "\n    " : " ") << table.escapes[i] << ",";
+  }
+  f << R"(
+};
+
+constexpr wint_t )" << name << R"(_target(wint_t wc, unsigned l2_idx) {
+  const int32_t code = )" << name << R"(_level2[l2_idx];
+  if (code < staged_case_escape_end) [[unlikely]] {
+    return wc + )" << name << R"(_escapes[code - INT16_MIN];
+  }
+  return wc + code;
+}
+
+)";
+}
+
 inline void generate_staged_case_code(
     const StagedCaseTable &to_upper_table,
     const StagedCaseTable &to_lower_table) {
+  // Both directions share the lookup code, so they share a shape
+  assert(to_upper_table.shape.block_bits == to_lower_table.shape.block_bits &&
+         to_upper_table.shape.block_ids == to_lower_table.shape.block_ids &&
+         to_upper_table.deltas == to_lower_table.deltas);
+  const TableShape &shape = to_upper_table.shape;
+
   generate_level1_inc(to_upper_table.level1,
                       "case_mapping_upper_level1_staged.inc");
-  generate_level2_inc(to_upper_table.level2,
+  generate_level2_inc(to_upper_table,
                       "case_mapping_upper_level2_staged.inc");
   generate_level1_inc(to_lower_table.level1,
                       "case_mapping_lower_level1_staged.inc");
-  generate_level2_inc(to_lower_table.level2,
+  generate_level2_inc(to_lower_table,
                       "case_mapping_lower_level2_staged.inc");
 
   std::ofstream f("case_mapping_staged.h");
@@ -224,32 +345,40 @@ inline void generate_staged_case_code(
 #include <stdint.h>
 #include <wctype.h>
 
-
-// Level 1: maps upper 8 bits to level2 offset
-inline constexpr uint16_t to_upper_level1[)" << to_upper_table.level1.size() <<
-      R"(] = {
+// )" << (1u << shape.block_bits) << R"(-codepoint blocks; level1 holds )"
+      << (shape.block_ids ? "block numbers" : "level2 offsets")
+      << ", level2 " << (to_upper_table.deltas ? "deltas" : "targets") << R"(
+inline constexpr unsigned staged_case_block_bits = )" << shape.block_bits
+      << R"(;
+inline constexpr unsigned staged_case_index_shift = )"
+      << (shape.block_ids ? shape.block_bits : 0) << R"(;
+inline constexpr unsigned staged_case_block_mask =
+    (1u << staged_case_block_bits) - 1;
+)";
+  if (to_upper_table.deltas) {
+    f << "inline constexpr int32_t staged_case_escape_end = INT16_MIN + "
+      << staged_case_escape_end - INT16_MIN << ";\n";
+  }
+  f << R"(
+// Level 1: maps codepoint >> staged_case_block_bits to level2 offset
+inline constexpr )" << index_type(index_width(to_upper_table.level1))
+      << " to_upper_level1[" << to_upper_table.level1.size() << R"(] = {
 #include "case_mapping_upper_level1_staged.inc"
 };
 
-// Level 2: target codepoints (0 = no mapping, return identity)
-inline constexpr uint32_t to_upper_level2[)" << to_upper_table.level2.size() <<
-      R"(] = {
-#include "case_mapping_upper_level2_staged.inc"
-};
-
-// Level 1: maps upper 8 bits to level2 offset
-inline constexpr uint16_t to_lower_level1[)" << to_lower_table.level1.size() <<
-      R"(] = {
+)";
+  write_staged_level2(f, "to_upper", to_upper_table,
+                      "case_mapping_upper_level2_staged.inc");
+  f << R"(// Level 1: maps codepoint >> staged_case_block_bits to level2 offset
+inline constexpr )" << index_type(index_width(to_lower_table.level1))
+      << " to_lower_level1[" << to_lower_table.level1.size() << R"(] = {
 #include "case_mapping_lower_level1_staged.inc"
 };
 
-// Level 2: target codepoints (0 = no mapping, return identity)
-inline constexpr uint32_t to_lower_level2[)" << to_lower_table.level2.size() <<
-      R"(] = {
-#include "case_mapping_lower_level2_staged.inc"
-};
-
-inline wint_t towupper_impl(wint_t wc) {
+)";
+  write_staged_level2(f, "to_lower", to_lower_table,
+                      "case_mapping_lower_level2_staged.inc");
+  f << R"(constexpr wint_t towupper_impl(wint_t wc) {
   if (wc == WEOF) {
     return WEOF;
   }
@@ -266,19 +395,18 @@ inline wint_t towupper_impl(wint_t wc) {
     return wc;  // ASCII non-letters
   }
 
-  unsigned l1_idx = wc >> 8;
+  unsigned l1_idx = wc >> staged_case_block_bits;
   if (l1_idx >= )" << to_upper_table.level1.size() << R"() {
     return wc;  // Beyond table range
   }
 
-  unsigned l2_offset = to_upper_level1[l1_idx];
-  unsigned l2_idx = l2_offset + (wc & 0xFF);
+  unsigned l2_offset = to_upper_level1[l1_idx] << staged_case_index_shift;
+  unsigned l2_idx = l2_offset + (wc & staged_case_block_mask);
 
-  uint32_t target = to_upper_level2[l2_idx];
-  return target ? target : wc;
+  return to_upper_target(wc, l2_idx);
 }
 
-inline wint_t towlower_impl(wint_t wc) {
+constexpr wint_t towlower_impl(wint_t wc) {
   if (wc == WEOF) {
     return WEOF;
   }
@@ -296,16 +424,62 @@ inline wint_t towlower_impl(wint_t wc) {
     return wc;  // ASCII non-letters
   }
 
-  unsigned l1_idx = wc >> 8;
+  unsigned l1_idx = wc >> staged_case_block_bits;
   if (l1_idx >= )" << to_lower_table.level1.size() << R"() {
     return wc;  // Beyond table range
   }
 
-  unsigned l2_offset = to_lower_level1[l1_idx];
-  unsigned l2_idx = l2_offset + (wc & 0xFF);
+  unsigned l2_offset = to_lower_level1[l1_idx] << staged_case_index_shift;
+  unsigned l2_idx = l2_offset + (wc & staged_case_block_mask);
 
-  uint32_t target = to_lower_level2[l2_idx];
-  return target ? target : wc;
+  return to_lower_target(wc, l2_idx);
+}
+
+// Batched lookups for scattered input, in two stages per group: all level1
+// loads of the group are issued first, prefetching the level2 lines they
+// point to, and only then are the level2 loads resolved.
+template <typename Index, size_t L1, typename Entry, size_t L2,
+          typename Target>
+inline void staged_case_batch(const Index (&level1)[L1],
+                              const Entry (&level2)[L2], Target target,
+                              const wint_t *in, wint_t *out, size_t n) {
+  constexpr size_t group = 16;
+  uint32_t offsets[group];
+
+  // Anything past the table, WEOF included, maps to itself like U+0000
+  auto index = [](wint_t wc) -> wint_t {
+    return wc < (L1 << staged_case_block_bits) ? wc : 0;
+  };
+
+  for (size_t base = 0; base < n; base += group) {
+    const size_t len = n - base < group ? n - base : group;
+    for (size_t i = 0; i < len; ++i) {
+      const wint_t idx = index(in[base + i]);
+      offsets[i] = (level1[idx >> staged_case_block_bits]
+                    << staged_case_index_shift) +
+                   (idx & staged_case_block_mask);
+      __builtin_prefetch(&level2[offsets[i]]);
+    }
+    for (size_t i = 0; i < len; ++i) {
+      out[base + i] = target(in[base + i], offsets[i]);
+    }
+  }
+}
+
+// out[i] = towupper_impl(in[i]) for n scattered characters
+inline void towupper_batch_impl(const wint_t *in, wint_t *out, size_t n) {
+  staged_case_batch(
+      to_upper_level1, to_upper_level2,
+      [](wint_t wc, unsigned l2_idx) { return to_upper_target(wc, l2_idx); },
+      in, out, n);
+}
+
+// out[i] = towlower_impl(in[i]) for n scattered characters
+inline void towlower_batch_impl(const wint_t *in, wint_t *out, size_t n) {
+  staged_case_batch(
+      to_lower_level1, to_lower_level2,
+      [](wint_t wc, unsigned l2_idx) { return to_lower_target(wc, l2_idx); },
+      in, out, n);
 }
 
 #endif // CASE_MAPPING_STAGED_H
@@ -0,0 +1,284 @@
+#ifndef TABLE_AUTOTUNE_H
+#define TABLE_AUTOTUNE_H
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "generator.h"
+#include "staged_conversion_generator.h"
+
+// Sweep of two-level table shapes: every block size from 32 to 1024 with
+// level1 holding either level2 offsets (packed level2) or block numbers
+// (narrower level1, unpacked level2), scored by size and by the cost of
+// looking up a corpus through it.
+
+// One shape of a table and what it costs
+struct TuneResult {
+  TableShape shape;
+  size_t index_width;
+  size_t bytes;
+  size_t lines; // Distinct cache lines the corpus reads from both levels
+  double ns; // Per lookup, median of several runs
+  bool pareto = false;
+};
+
+inline constexpr unsigned tune_min_block_bits = 5;
+inline constexpr unsigned tune_max_block_bits = 10;
+
+// Smallest shape whose lookups are at most this much slower than the
+// fastest one's
+inline constexpr double tune_slowdown = 1.10;
+
+// Codepoints of typical text: blocks drawn by their hits in profile, or
+// assigned codepoints when there is no profile
+inline std::vector<uint32_t> tune_corpus(
+    const std::unordered_map<uint32_t, uint16_t> &properties,
+    const BlockProfile &profile) {
+  std::vector<uint32_t> pool;
+  std::unordered_map<uint32_t, size_t> per_block;
+  for (const auto &[codepoint, props] : properties) {
+    if (props != 0 && (profile.empty() || profile.contains(codepoint >> 8))) {
+      pool.push_back(codepoint);
+      ++per_block[codepoint >> 8];
+    }
+  }
+  std::ranges::sort(pool);
+
+  // A block's hits are spread over its codepoints
+  std::vector<double> weights;
+  for (uint32_t codepoint : pool) {
+    const uint32_t block = codepoint >> 8;
+    weights.push_back(profile.empty() ? 1.0
+                                      : static_cast<double>(profile.at(block)) /
+                                            per_block[block]);
+  }
+
+  std::mt19937 rng(42);
+  std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+  std::vector<uint32_t> corpus(1 << 16);
+  for (auto &codepoint : corpus) {
+    codepoint = pool[pick(rng)];
+  }
+  return corpus;
+}
+
+// One pass over corpus, with level1 as narrow as the generated header
+// declares it
+template <typename Index, typename T>
+double time_lookups(const std::vector<Index> &level1,
+                    const std::vector<T> &level2, const TableShape &shape,
+                    const std::vector<uint32_t> &corpus) {
+  const unsigned shift = shape.block_ids ? shape.block_bits : 0;
+  const uint32_t mask = (1u << shape.block_bits) - 1;
+  const size_t limit = level1.size() << shape.block_bits;
+
+  const auto start = std::chrono::steady_clock::now();
+  uint64_t acc = 0;
+  for (uint32_t cp : corpus) {
+    if (cp < limit) {
+      acc += level2[(level1[cp >> shape.block_bits] << shift) + (cp & mask)];
+    }
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  volatile uint64_t sink = acc;
+  (void)sink;
+  return elapsed.count() / corpus.size();
+}
+
+// A shape under test: its size and footprint, and a timed pass over the
+// corpus
+struct TuneCandidate {
+  TuneResult result;
+  std::function<double()> time;
+};
+
+template <typename T>
+TuneCandidate tune_candidate(const std::vector<uint32_t> &level1,
+                             const std::vector<T> &level2,
+                             const TableShape &shape,
+                             const std::vector<uint32_t> &corpus) {
+  TuneResult result{shape, index_width(level1), 0, 0, 0};
+  result.bytes = level1.size() * result.index_width + level2.size() * sizeof(T);
+
+  // Tables are cache-line aligned, so lines count from the start of each
+  const unsigned shift = shape.block_ids ? shape.block_bits : 0;
+  std::set<size_t> level1_lines;
+  std::set<size_t> level2_lines;
+  for (uint32_t cp : corpus) {
+    const size_t l1 = cp >> shape.block_bits;
+    if (l1 < level1.size()) {
+      const size_t l2 =
+          (size_t{level1[l1]} << shift) + (cp & ((1u << shape.block_bits) - 1));
+      level1_lines.insert(l1 * result.index_width / 64);
+      level2_lines.insert(l2 * sizeof(T) / 64);
+    }
+  }
+  result.lines = level1_lines.size() + level2_lines.size();
+
+  const auto timer = [&]<typename Index>() -> std::function<double()> {
+    return [=, level1 = std::vector<Index>(level1.begin(), level1.end())] {
+      return time_lookups(level1, level2, shape, corpus);
+    };
+  };
+  switch (result.index_width) {
+  case 1:
+    return {result, timer.template operator()<uint8_t>()};
+  case 2:
+    return {result, timer.template operator()<uint16_t>()};
+  default:
+    return {result, timer.template operator()<uint32_t>()};
+  }
+}
+
+// Median pass of each candidate, taking turns so that a noisy stretch of
+// the run doesn't land on one of them only
+inline std::vector<TuneResult> measure(std::vector<TuneCandidate> &candidates) {
+  constexpr size_t rounds = 31;
+  std::vector<std::vector<double>> passes(candidates.size());
+  for (size_t round = 0; round < rounds; ++round) {
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      passes[i].push_back(candidates[i].time());
+    }
+  }
+  std::vector<TuneResult> results;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    std::ranges::nth_element(passes[i], passes[i].begin() + rounds / 2);
+    results.push_back(candidates[i].result);
+    results.back().ns = passes[i][rounds / 2];
+  }
+  return results;
+}
+
+// Marks the results no other result beats on both size and lookup cost,
+// and returns the smallest of those within tune_slowdown of the fastest
+inline const TuneResult &pick_shape(std::vector<TuneResult> &results) {
+  double fastest = 1e300;
+  for (auto &r : results) {
+    r.pareto = std::ranges::none_of(results, [&](const TuneResult &other) {
+      return other.bytes <= r.bytes && other.ns <= r.ns &&
+             (other.bytes < r.bytes || other.ns < r.ns);
+    });
+    fastest = std::min(fastest, r.ns);
+  }
+  const TuneResult *pick = nullptr;
+  for (const auto &r : results) {
+    if (r.pareto && r.ns <= fastest * tune_slowdown &&
+        (!pick || r.bytes < pick->bytes)) {
+      pick = &r;
+    }
+  }
+  return *pick;
+}
+
+inline const char *level1_index_name(const TableShape &shape) {
+  return shape.block_ids ? "block_id" : "offset";
+}
+
+inline void print_tune_results(const std::string_view title,
+                               const std::vector<TuneResult> &results,
+                               const TuneResult &pick) {
+  std::cout << "\n" << title << "\n";
+  std::cout << "  block  level1         bytes  lines  ns/lookup\n";
+  for (const auto &r : results) {
+    std::cout << "  " << std::setw(5) << (1u << r.shape.block_bits) << "  "
+        << std::left << std::setw(9) << level1_index_name(r.shape)
+        << std::right << std::setw(3)
+        << ("u" + std::to_string(r.index_width * 8))
+        << std::setw(8) << r.bytes << std::setw(7) << r.lines
+        << std::setw(11) << std::fixed << std::setprecision(3) << r.ns
+        << (r.pareto ? "  pareto" : "") << (&r == &pick ? ", picked" : "")
+        << "\n";
+  }
+}
+
+// A staged case table under test, level2 as wide as its encoding
+inline TuneCandidate tune_case_candidate(const StagedCaseTable &table,
+                                        const std::vector<uint32_t> &corpus) {
+  if (!table.deltas) {
+    return tune_candidate(table.level1, table.level2, table.shape, corpus);
+  }
+  const std::vector<int16_t> level2(table.level2.begin(), table.level2.end());
+  auto candidate = tune_candidate(table.level1, level2, table.shape, corpus);
+  candidate.result.bytes += table.escapes.size() * sizeof(int32_t);
+  return candidate;
+}
+
+// Prints both sweeps and writes the picked shapes to table_config.cmake,
+// an initial cache for `cmake -C`. The case tables are swept in the given
+// encoding.
+inline void autotune_tables(
+    const std::unordered_map<uint32_t, uint16_t> &properties,
+    const std::vector<StagedCaseMappingEntry> &case_mappings,
+    const BlockProfile &profile, bool case_deltas) {
+  const auto corpus = tune_corpus(properties, profile);
+
+  // The builders report on every table, which isn't wanted here
+  std::vector<TuneCandidate> classification_candidates;
+  std::vector<TuneCandidate> case_candidates;
+  std::cout.setstate(std::ios::failbit);
+  for (unsigned bits = tune_min_block_bits; bits <= tune_max_block_bits;
+       ++bits) {
+    for (bool block_ids : {false, true}) {
+      const TableShape shape{bits, block_ids};
+      const auto table = build_lookup_tables(properties, 0, profile, shape);
+      classification_candidates.push_back(
+          tune_candidate(table.level1, table.level2, shape, corpus));
+
+      // Both directions share a shape, so they are scored together
+      const auto upper =
+          build_staged_table(case_mappings, true, shape, case_deltas);
+      const auto lower =
+          build_staged_table(case_mappings, false, shape, case_deltas);
+      auto both = tune_case_candidate(upper, corpus);
+      auto to_lower = tune_case_candidate(lower, corpus);
+      both.result.index_width =
+          std::max(both.result.index_width, to_lower.result.index_width);
+      both.result.bytes += to_lower.result.bytes;
+      both.result.lines += to_lower.result.lines;
+      both.time = [upper = both.time, lower = to_lower.time] {
+        return (upper() + lower()) / 2;
+      };
+      case_candidates.push_back(std::move(both));
+    }
+  }
+  std::cout.clear();
+
+  auto classification = measure(classification_candidates);
+  auto case_tables = measure(case_candidates);
+  const TuneResult &pick = pick_shape(classification);
+  const TuneResult &case_pick = pick_shape(case_tables);
+  std::cout << "Lookups of " << corpus.size() << " codepoints"
+      << (profile.empty() ? "" : " drawn by the block profile")
+      << "; picked: smallest Pareto shape within "
+      << std::lround((tune_slowdown - 1) * 100) << "% of the fastest\n";
+  print_tune_results("Two-level classification table:", classification, pick);
+  print_tune_results("Staged case tables (upper + lower):", case_tables,
+                     case_pick);
+
+  std::ofstream f("table_config.cmake");
+  if (!f.is_open()) {
+    throw std::runtime_error("Cannot create table_config.cmake");
+  }
+  f << "# Written by generator --autotune\n"
+    << "set(MYWCTYPE_BLOCK_BITS " << pick.shape.block_bits
+    << " CACHE STRING \"\" FORCE)\n"
+    << "set(MYWCTYPE_LEVEL1_INDEX " << level1_index_name(pick.shape)
+    << " CACHE STRING \"\" FORCE)\n"
+    << "set(MYWCTYPE_CASE_BLOCK_BITS " << case_pick.shape.block_bits
+    << " CACHE STRING \"\" FORCE)\n"
+    << "set(MYWCTYPE_CASE_LEVEL1_INDEX " << level1_index_name(case_pick.shape)
+    << " CACHE STRING \"\" FORCE)\n";
+  std::cout << "\nWrote table_config.cmake\n";
+}
+
+#endif // TABLE_AUTOTUNE_H
@@ -0,0 +1,46 @@
+#include "wctype_test_base.h"
+#include "case_mapping_hash.h"
+
+#include <unordered_map>
+#include <wctype.h>
+
+static_assert(case_hash_towlower(0x00C4) == 0x00E4);
+static_assert(case_hash_towupper(0x0431) == 0x0411);
+static_assert(case_hash_towupper(0x0030) == 0x0030);
+
+class CaseHashTest : public WctypeTest {
+protected:
+  // The maps ht.h used to build
+  static inline const std::unordered_map<wint_t, wint_t> upper_map = {
+#include "case_mapping_upper.inc"
+  };
+  static inline const std::unordered_map<wint_t, wint_t> lower_map = {
+#include "case_mapping_lower.inc"
+  };
+
+  static wint_t find(const std::unordered_map<wint_t, wint_t> &map,
+                     wint_t wc) {
+    const auto it = map.find(wc);
+    return it == map.end() ? wc : it->second;
+  }
+};
+
+TEST_F(CaseHashTest, MatchesUnorderedMaps) {
+  for (uint32_t cp = 0; cp <= 0x110100; ++cp) {
+    ASSERT_EQ(case_hash_towupper(cp), find(upper_map, cp))
+      << "U+" << std::hex << cp;
+    ASSERT_EQ(case_hash_towlower(cp), find(lower_map, cp))
+      << "U+" << std::hex << cp;
+  }
+}
+
+TEST_F(CaseHashTest, OneSlotPerMapping) {
+  EXPECT_EQ(std::size(to_upper_hash_slots), upper_map.size());
+  EXPECT_EQ(std::size(to_lower_hash_slots), lower_map.size());
+  for (const auto &[from, to] : upper_map) {
+    ASSERT_EQ(case_hash_towupper(from), to) << "U+" << std::hex << from;
+  }
+  for (const auto &[from, to] : lower_map) {
+    ASSERT_EQ(case_hash_towlower(from), to) << "U+" << std::hex << from;
+  }
+}
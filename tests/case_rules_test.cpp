@@ -0,0 +1,51 @@
+#include "wctype_test_base.h"
+#include "case_mapping_rules.h"
+
+#include <unordered_map>
+#include <wctype.h>
+
+static_assert(case_rules_towlower(0x00C4) == 0x00E4);
+static_assert(case_rules_towupper(0x0431) == 0x0411);
+static_assert(case_rules_towupper(0x0030) == 0x0030);
+
+class CaseRulesTest : public WctypeTest {
+protected:
+  // The mapping lists the rules were derived from
+  static inline const std::unordered_map<wint_t, wint_t> upper_map = {
+#include "case_mapping_upper.inc"
+  };
+  static inline const std::unordered_map<wint_t, wint_t> lower_map = {
+#include "case_mapping_lower.inc"
+  };
+
+  static wint_t find(const std::unordered_map<wint_t, wint_t> &map,
+                     wint_t wc) {
+    const auto it = map.find(wc);
+    return it == map.end() ? wc : it->second;
+  }
+};
+
+TEST_F(CaseRulesTest, MatchesUnorderedMaps) {
+  for (uint32_t cp = 0; cp <= 0x110100; ++cp) {
+    ASSERT_EQ(case_rules_towupper(cp), find(upper_map, cp))
+      << "U+" << std::hex << cp;
+    ASSERT_EQ(case_rules_towlower(cp), find(lower_map, cp))
+      << "U+" << std::hex << cp;
+  }
+}
+
+// Each rule ends before the next starts, so the last one starting at or
+// before a codepoint is the only candidate
+TEST_F(CaseRulesTest, RulesAreDisjoint) {
+  const auto check = [](const auto &rules) {
+    for (size_t i = 1; i < std::size(rules); ++i) {
+      EXPECT_LE(rules[i - 1].first + rules[i - 1].length, rules[i].first)
+        << "rule " << i;
+      EXPECT_LE(rules[i].stride_mask, 1) << "rule " << i;
+    }
+  };
+  check(to_upper_rules);
+  check(to_lower_rules);
+  EXPECT_LT(std::size(to_upper_rules), upper_map.size() / 4);
+  EXPECT_LT(std::size(to_lower_rules), lower_map.size() / 4);
+}
@@ -0,0 +1,69 @@
+#include "wctype_test_base.h"
+#include "case_mapping.h"
+
+#include <algorithm>
+#include <vector>
+#include <unordered_map>
+#include <wctype.h>
+
+static_assert(case_search_towlower(0x00C4) == 0x00E4);
+static_assert(case_search_towupper(0x0431) == 0x0411);
+static_assert(case_search_towupper(0x0030) == 0x0030);
+static_assert(case_search_levels(std::size(to_upper_search_keys) /
+                                 case_search_node_keys) == 3);
+
+class CaseSearchTest : public WctypeTest {
+protected:
+  static inline const std::unordered_map<wint_t, wint_t> upper_map = {
+#include "case_mapping_upper.inc"
+  };
+  static inline const std::unordered_map<wint_t, wint_t> lower_map = {
+#include "case_mapping_lower.inc"
+  };
+
+  static wint_t find(const std::unordered_map<wint_t, wint_t> &map,
+                     wint_t wc) {
+    const auto it = map.find(wc);
+    return it == map.end() ? wc : it->second;
+  }
+
+  // Walks the tree in order, as build_case_search_tree filled it
+  template <size_t Keys>
+  static void in_order(const int32_t (&keys)[Keys], size_t node,
+                       std::vector<int32_t> &out) {
+    if (node >= Keys / case_search_node_keys) {
+      return;
+    }
+    for (size_t i = 0; i <= case_search_node_keys; ++i) {
+      in_order(keys, node * (case_search_node_keys + 1) + i + 1, out);
+      if (i < case_search_node_keys) {
+        out.push_back(keys[node * case_search_node_keys + i]);
+      }
+    }
+  }
+};
+
+TEST_F(CaseSearchTest, MatchesUnorderedMaps) {
+  for (uint32_t cp = 0; cp <= 0x110100; ++cp) {
+    ASSERT_EQ(case_search_towupper(cp), find(upper_map, cp))
+      << "U+" << std::hex << cp;
+    ASSERT_EQ(case_search_towlower(cp), find(lower_map, cp))
+      << "U+" << std::hex << cp;
+  }
+  EXPECT_EQ(case_search_towlower(0xFFFFFFFF), 0xFFFFFFFF);
+}
+
+TEST_F(CaseSearchTest, KeysSortedInOrder) {
+  std::vector<int32_t> upper;
+  std::vector<int32_t> lower;
+  in_order(to_upper_search_keys, 0, upper);
+  in_order(to_lower_search_keys, 0, lower);
+  EXPECT_EQ(upper.size(), std::size(to_upper_search_keys));
+  EXPECT_EQ(lower.size(), std::size(to_lower_search_keys));
+  EXPECT_TRUE(std::ranges::is_sorted(upper));
+  EXPECT_TRUE(std::ranges::is_sorted(lower));
+  EXPECT_EQ(std::ranges::count(upper, INT32_MAX) + upper_map.size(),
+            upper.size());
+  EXPECT_EQ(std::ranges::count(lower, INT32_MAX) + lower_map.size(),
+            lower.size());
+}
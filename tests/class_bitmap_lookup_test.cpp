@@ -0,0 +1,110 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <random>
+#include <vector>
+
+class ClassBitmapLookupTest : public WctypeTest {
+protected:
+  static constexpr my_wctype::mywctype_t all_descs[] = {
+      my_wctype::WCTYPE_ALNUM, my_wctype::WCTYPE_ALPHA,
+      my_wctype::WCTYPE_BLANK, my_wctype::WCTYPE_CNTRL,
+      my_wctype::WCTYPE_DIGIT, my_wctype::WCTYPE_GRAPH,
+      my_wctype::WCTYPE_LOWER, my_wctype::WCTYPE_PRINT,
+      my_wctype::WCTYPE_PUNCT, my_wctype::WCTYPE_SPACE,
+      my_wctype::WCTYPE_UPPER, my_wctype::WCTYPE_XDIGIT};
+
+  static std::vector<uint64_t> lookup(const std::vector<wchar_t> &text,
+                                      my_wctype::mywctype_t desc) {
+    std::vector<uint64_t> bitmap(my_wctype::bitmap_words(text.size()),
+                                 ~uint64_t{0});
+    my_wctype::class_bitmap_lookup(text, desc, bitmap);
+    return bitmap;
+  }
+};
+
+TEST_F(ClassBitmapLookupTest, MatchesIswctypeOnEveryCodepoint) {
+  std::vector<wchar_t> text;
+  for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    text.push_back(static_cast<wchar_t>(cp));
+  }
+
+  for (auto desc : all_descs) {
+    const auto bitmap = lookup(text, desc);
+    for (size_t i = 0; i < text.size(); ++i) {
+      ASSERT_EQ((bitmap[i / 64] >> (i % 64)) & 1,
+                my_wctype::iswctype(text[i], desc) != 0)
+        << "desc " << int(desc) << " U+" << std::hex
+        << static_cast<uint32_t>(text[i]);
+    }
+  }
+}
+
+// ASCII runs take the in-register path, the rest the planes
+TEST_F(ClassBitmapLookupTest, MatchesIswctypeBitmapOnText) {
+  static const wchar_t pool[] =
+      L"abcdefghijXYZ0123456789 \t\n!.,-_()éÀß αΩЖж中文　 \U0001F600";
+  std::mt19937 rng(7);
+  for (size_t n : {0u, 1u, 63u, 64u, 65u, 1000u, 4096u}) {
+    std::vector<wchar_t> text(n, L'x');
+    // Mostly ASCII, with a few other characters here and there
+    for (auto &c : text) {
+      c = pool[rng() % 24];
+      if (rng() % 97 == 0) {
+        c = pool[rng() % (std::size(pool) - 1)];
+      }
+    }
+
+    const size_t words = my_wctype::bitmap_words(n);
+    std::vector<uint64_t> expected(std::size(all_descs) * words);
+    my_wctype::iswctype_bitmap(text, all_descs, expected);
+    for (size_t k = 0; k < std::size(all_descs); ++k) {
+      const std::vector<uint64_t> row(expected.begin() + k * words,
+                                      expected.begin() + (k + 1) * words);
+      EXPECT_EQ(lookup(text, all_descs[k]), row)
+        << "n " << n << " desc " << int(all_descs[k]);
+    }
+  }
+}
+
+TEST_F(ClassBitmapLookupTest, TailBitsAreCleared) {
+  std::vector<wchar_t> text(70, L' ');
+  const auto bitmap = lookup(text, my_wctype::WCTYPE_SPACE);
+  EXPECT_EQ(bitmap[0], ~uint64_t{0});
+  EXPECT_EQ(bitmap[1], (uint64_t{1} << 6) - 1);
+}
+
+// Like the other bulk functions, and unlike iswcntrl(WEOF)
+TEST_F(ClassBitmapLookupTest, InvalidCodepointsAreInNoClass) {
+  std::vector<wchar_t> text;
+  for (wint_t wc : {0xD800u, 0xDFFFu, 0x110000u, 0x7FFFFFFFu, WEOF}) {
+    text.push_back(static_cast<wchar_t>(wc));
+  }
+  for (auto desc : all_descs) {
+    EXPECT_EQ(lookup(text, desc)[0], 0u) << "desc " << int(desc);
+  }
+}
+
+// A union has no plane of its own
+TEST_F(ClassBitmapLookupTest, UnionMatchesIswctype) {
+  const my_wctype::mywctype_t desc =
+      my_wctype::WCTYPE_ALPHA | my_wctype::WCTYPE_DIGIT;
+  std::vector<wchar_t> text;
+  for (wchar_t wc : L"ab12 !éß中\U0001F600") {
+    text.push_back(wc);
+  }
+  const auto bitmap = lookup(text, desc);
+  for (size_t i = 0; i < text.size(); ++i) {
+    EXPECT_EQ((bitmap[0] >> i) & 1, my_wctype::iswctype(text[i], desc) != 0)
+      << "index " << i;
+  }
+}
+
+TEST_F(ClassBitmapLookupTest, InvalidDescriptorIsEmpty) {
+  std::vector<wchar_t> text(100, L'a');
+  for (my_wctype::mywctype_t desc : {0, 0x1000, 0xF000}) {
+    for (uint64_t word : lookup(text, desc)) {
+      EXPECT_EQ(word, 0u);
+    }
+  }
+}
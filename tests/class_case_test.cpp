@@ -0,0 +1,34 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <wctype.h>
+
+static_assert(my_wctype::classify_and_lower(0x00C4).mapped == 0x00E4);
+static_assert(my_wctype::classify_and_lower(0x00C4).properties &
+              my_wctype::WCTYPE_UPPER);
+static_assert(my_wctype::classify_and_upper(0x0431).mapped == 0x0411);
+static_assert(my_wctype::classify_and_lower(WEOF).mapped == WEOF);
+static_assert(my_wctype::classify_and_lower(WEOF).properties == 0);
+
+class ClassCaseTest : public WctypeTest {};
+
+TEST_F(ClassCaseTest, MatchesSeparateLookups) {
+  for (uint32_t cp = 0; cp <= 0x110100; ++cp) {
+    const auto lower = my_wctype::classify_and_lower(cp);
+    const auto upper = my_wctype::classify_and_upper(cp);
+    ASSERT_EQ(lower.properties, lookup_properties(cp)) << "U+" << std::hex
+                                                       << cp;
+    ASSERT_EQ(upper.properties, lookup_properties(cp)) << "U+" << std::hex
+                                                       << cp;
+    ASSERT_EQ(lower.mapped, my_wctype::towlower(cp)) << "U+" << std::hex << cp;
+    ASSERT_EQ(upper.mapped, my_wctype::towupper(cp)) << "U+" << std::hex << cp;
+  }
+}
+
+TEST_F(ClassCaseTest, LargeDeltas) {
+  // Through the escapes, both ways
+  EXPECT_EQ(my_wctype::classify_and_lower(0xA7AE).mapped, 0x026A);
+  EXPECT_EQ(my_wctype::classify_and_upper(0x026A).mapped, 0xA7AE);
+  EXPECT_EQ(my_wctype::classify_and_lower(0x13A0).mapped, 0xAB70);
+  EXPECT_EQ(my_wctype::classify_and_upper(0xAB70).mapped, 0x13A0);
+}
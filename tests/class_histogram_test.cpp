@@ -0,0 +1,72 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <random>
+#include <vector>
+
+class ClassHistogramTest : public WctypeTest {
+protected:
+  static my_wctype::ClassHistogram naive_histogram(
+      std::span<const wchar_t> s) {
+    my_wctype::ClassHistogram histogram;
+    histogram.total = s.size();
+    for (wchar_t wc : s) {
+      for (unsigned bit = 0; bit < 12; ++bit) {
+        histogram.counts[bit] += my_wctype::iswctype(wc, 1 << bit) != 0;
+      }
+    }
+    return histogram;
+  }
+
+  static void expect_same(const my_wctype::ClassHistogram &actual,
+                          const my_wctype::ClassHistogram &expected) {
+    EXPECT_EQ(actual.total, expected.total);
+    for (unsigned bit = 0; bit < 12; ++bit) {
+      EXPECT_EQ(actual.count(1 << bit), expected.count(1 << bit)) << "bit "
+        << bit;
+    }
+  }
+};
+
+TEST_F(ClassHistogramTest, MatchesIswctypeOnEveryCodepoint) {
+  std::vector<wchar_t> text;
+  for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    text.push_back(static_cast<wchar_t>(cp));
+  }
+  expect_same(my_wctype::class_histogram(text), naive_histogram(text));
+}
+
+TEST_F(ClassHistogramTest, RandomSlices) {
+  static const wchar_t pool[] =
+      L"abcXYZ019 \t\n!.,-_()éÀß αΩЖж中文　 \U0001F600";
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<size_t> pick(0, std::size(pool) - 2);
+  std::vector<wchar_t> text(5000);
+  for (auto &c : text) {
+    c = pool[pick(rng)];
+  }
+
+  for (size_t len : {0u, 1u, 15u, 16u, 33u, 100u, 5000u}) {
+    std::span<const wchar_t> slice(text.data(), len);
+    expect_same(my_wctype::class_histogram(slice), naive_histogram(slice));
+  }
+}
+
+TEST_F(ClassHistogramTest, LaneCountersDoNotWrap) {
+  // Far more runs than a 16-bit lane counter can hold between flushes
+  std::vector<wchar_t> text(3'000'000, L'7');
+  const auto histogram = my_wctype::class_histogram(text);
+  EXPECT_EQ(histogram.count(my_wctype::WCTYPE_DIGIT), text.size());
+  EXPECT_EQ(histogram.count(my_wctype::WCTYPE_ALNUM), text.size());
+  EXPECT_EQ(histogram.count(my_wctype::WCTYPE_ALPHA), 0u);
+}
+
+TEST_F(ClassHistogramTest, InvalidDescriptor) {
+  const auto histogram = my_wctype::class_histogram(std::wstring(10, L'a'));
+  EXPECT_EQ(histogram.count(0), 0u);
+  EXPECT_EQ(histogram.count(0x1000), 0u);
+  // Counts are per class, not per union of classes
+  EXPECT_EQ(histogram.count(my_wctype::WCTYPE_LOWER | my_wctype::WCTYPE_ALPHA),
+            0u);
+  EXPECT_EQ(histogram.count(my_wctype::WCTYPE_LOWER), 10u);
+}
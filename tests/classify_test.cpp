@@ -0,0 +1,122 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class ClassifyTest : public WctypeTest {
+protected:
+  static std::vector<wchar_t> all_codepoints() {
+    std::vector<wchar_t> text;
+    for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+      text.push_back(static_cast<wchar_t>(cp));
+    }
+    return text;
+  }
+};
+
+TEST_F(ClassifyTest, MatchesLookupOnEveryCodepoint) {
+  const auto text = all_codepoints();
+  std::vector<uint16_t> props(text.size());
+  my_wctype::classify(text, props);
+
+  for (size_t i = 0; i < text.size(); ++i) {
+    ASSERT_EQ(props[i], lookup_properties(text[i]))
+      << "Mismatch for U+" << std::hex << static_cast<uint32_t>(text[i]);
+  }
+}
+
+TEST_F(ClassifyTest, MatchesScalarFunctions) {
+  const auto text = all_codepoints();
+  std::vector<uint16_t> props(text.size());
+  my_wctype::classify(text, props);
+
+  for (size_t i = 0; i < text.size(); ++i) {
+    const wchar_t wc = text[i];
+    const uint16_t p = props[i];
+    ASSERT_EQ((p & PROP_ALPHA) != 0, my_wctype::iswalpha(wc) != 0)
+      << "alpha mismatch for U+" << std::hex << static_cast<uint32_t>(wc);
+    ASSERT_EQ((p & PROP_UPPER) != 0, my_wctype::iswupper(wc) != 0)
+      << "upper mismatch for U+" << std::hex << static_cast<uint32_t>(wc);
+    ASSERT_EQ((p & PROP_LOWER) != 0, my_wctype::iswlower(wc) != 0)
+      << "lower mismatch for U+" << std::hex << static_cast<uint32_t>(wc);
+    ASSERT_EQ((p & PROP_SPACE) != 0, my_wctype::iswspace(wc) != 0)
+      << "space mismatch for U+" << std::hex << static_cast<uint32_t>(wc);
+    ASSERT_EQ((p & PROP_PRINT) != 0, my_wctype::iswprint(wc) != 0)
+      << "print mismatch for U+" << std::hex << static_cast<uint32_t>(wc);
+    ASSERT_EQ((p & PROP_BLANK) != 0, my_wctype::iswblank(wc) != 0)
+      << "blank mismatch for U+" << std::hex << static_cast<uint32_t>(wc);
+    ASSERT_EQ((p & PROP_CNTRL) != 0, my_wctype::iswcntrl(wc) != 0)
+      << "cntrl mismatch for U+" << std::hex << static_cast<uint32_t>(wc);
+    ASSERT_EQ((p & PROP_PUNCT) != 0, my_wctype::iswpunct(wc) != 0)
+      << "punct mismatch for U+" << std::hex << static_cast<uint32_t>(wc);
+  }
+}
+
+TEST_F(ClassifyTest, InvalidCodepoints) {
+  // Surrogates and values outside Unicode, including negative wchar_t
+  std::vector<wchar_t> text = {
+      static_cast<wchar_t>(0xD800),   static_cast<wchar_t>(0xDFFF),
+      static_cast<wchar_t>(0x110000), static_cast<wchar_t>(0x7FFFFFFF),
+      static_cast<wchar_t>(-1),       static_cast<wchar_t>(WEOF)};
+  // Pad to a full SIMD run so the vector path sees them as well
+  text.resize(64, static_cast<wchar_t>(-2));
+  std::vector<uint16_t> props(text.size(), 0xFF);
+  my_wctype::classify(text, props);
+
+  for (size_t i = 0; i < text.size(); ++i) {
+    EXPECT_EQ(props[i], 0) << "Index " << i;
+  }
+}
+
+TEST_F(ClassifyTest, UnalignedSlices) {
+  std::vector<wchar_t> text;
+  const wchar_t *sample = L"The Quick Brown Fox 123! \tÀ é α Ж 中文 \x1F600\n";
+  for (int i = 0; i < 8; ++i) {
+    for (const wchar_t *p = sample; *p; ++p) {
+      text.push_back(*p);
+    }
+  }
+
+  for (size_t begin = 0; begin < 8; ++begin) {
+    for (size_t len = 0; begin + len <= text.size(); len += 7) {
+      std::span<const wchar_t> slice(text.data() + begin, len);
+      std::vector<uint16_t> props(len);
+      my_wctype::classify(slice, props);
+      for (size_t i = 0; i < len; ++i) {
+        ASSERT_EQ(props[i], lookup_properties(slice[i]))
+          << "begin=" << begin << " len=" << len << " i=" << i;
+      }
+    }
+  }
+}
+
+TEST_F(ClassifyTest, ScatteredMatchesLookup) {
+  auto text = all_codepoints();
+  text.push_back(static_cast<wchar_t>(0x110000));
+  text.push_back(static_cast<wchar_t>(-1));
+  std::shuffle(text.begin(), text.end(), std::mt19937(7));
+
+  // Lengths around the group size, then everything
+  for (size_t len : {0u, 1u, 15u, 16u, 17u, 100u}) {
+    std::vector<uint16_t> props(len, 0xAA);
+    my_wctype::classify_scattered(std::span(text.data(), len), props);
+    for (size_t i = 0; i < len; ++i) {
+      ASSERT_EQ(props[i], lookup_properties(text[i])) << "len=" << len;
+    }
+  }
+
+  std::vector<uint16_t> props(text.size());
+  my_wctype::classify_scattered(text, props);
+  for (size_t i = 0; i < text.size(); ++i) {
+    ASSERT_EQ(props[i], lookup_properties(text[i]))
+      << "Mismatch for U+" << std::hex << static_cast<uint32_t>(text[i]);
+  }
+}
+
+TEST_F(ClassifyTest, EmptyInput) {
+  std::vector<uint16_t> props;
+  my_wctype::classify(std::span<const wchar_t>(), props);
+  EXPECT_TRUE(props.empty());
+}
@@ -0,0 +1,112 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+// Everything here is checked by the compiler; the tests at the bottom only
+// compare the constant-evaluated bulk functions with their SIMD kernels
+
+// Classification
+static_assert(my_wctype::iswalpha(L'a'));
+static_assert(!my_wctype::iswalpha(L'1'));
+static_assert(my_wctype::iswalpha(0x4E00));    // CJK ideograph
+static_assert(my_wctype::iswupper(0x0391));    // GREEK CAPITAL LETTER ALPHA
+static_assert(my_wctype::iswspace(0x3000));    // IDEOGRAPHIC SPACE
+static_assert(!my_wctype::iswspace(0x00A0));   // NO-BREAK SPACE
+static_assert(my_wctype::iswgraph(0x00A0));
+static_assert(my_wctype::iswdigit(L'7') && !my_wctype::iswdigit(0x0660));
+static_assert(my_wctype::iswxdigit(L'f') && !my_wctype::iswxdigit(L'g'));
+static_assert(!my_wctype::iswprint(static_cast<wchar_t>(WEOF)));
+static_assert(my_wctype::iswctype(L'5', my_wctype::WCTYPE_ALPHA |
+                                            my_wctype::WCTYPE_DIGIT));
+static_assert(my_wctype::iswctype<my_wctype::WCTYPE_PUNCT>(L'!'));
+
+// Case conversion
+static_assert(my_wctype::towlower(L'A') == L'a');
+static_assert(my_wctype::towlower(0x00C4) == 0x00E4); // Ä -> ä
+static_assert(my_wctype::towupper(0x03C9) == 0x03A9); // ω -> Ω
+static_assert(my_wctype::towupper(0x1E9E) == 0x1E9E); // ẞ stays
+static_assert(my_wctype::towupper(L'1') == L'1');
+static_assert(my_wctype::towlower(WEOF) == WEOF);
+
+// Scans and counts over string literals
+static_assert(my_wctype::find_first_not_of_class(L"hello world"sv,
+                                                 my_wctype::WCTYPE_ALPHA) ==
+              5);
+static_assert(my_wctype::find_first_of_class<my_wctype::WCTYPE_SPACE>(
+                  L"key　value"sv) == 3);
+static_assert(my_wctype::all_of_class<my_wctype::WCTYPE_DIGIT>(L"2024"sv));
+static_assert(!my_wctype::all_of_class(L"x1"sv, my_wctype::WCTYPE_DIGIT));
+static_assert(my_wctype::class_histogram(L"Ab 1!"sv)
+                  .count(my_wctype::WCTYPE_UPPER) == 1);
+static_assert(my_wctype::class_histogram(L"Ab 1!"sv)
+                  .count(my_wctype::WCTYPE_ALNUM) == 3);
+
+// A keyword table case-folded by the compiler
+template <size_t N>
+static constexpr auto fold(const wchar_t (&word)[N]) {
+  std::array<wchar_t, N - 1> folded{};
+  for (size_t i = 0; i + 1 < N; ++i) {
+    folded[i] = static_cast<wchar_t>(my_wctype::towlower(word[i]));
+  }
+  return folded;
+}
+
+static constexpr auto kSelect = fold(L"SÉLECT");
+static_assert(std::wstring_view(kSelect.data(), kSelect.size()) ==
+              L"sélect"sv);
+
+// Bitmaps of a constant buffer
+static constexpr std::wstring_view kSample =
+    L"Grüße, мир! 你好 123\t\U0001F600 ABC def ΓΕΙΑ σου";
+
+static constexpr auto kSampleBitmaps = [] {
+  constexpr my_wctype::mywctype_t descs[] = {my_wctype::WCTYPE_ALPHA,
+                                             my_wctype::WCTYPE_SPACE};
+  std::array<uint64_t, 2> bitmaps{};
+  my_wctype::iswctype_bitmap(kSample, descs, bitmaps);
+  return bitmaps;
+}();
+static_assert((kSampleBitmaps[0] & 0x1F) == 0x1F); // "Grüße"
+static_assert((kSampleBitmaps[1] >> 6 & 1) == 1);  // The first space
+
+static constexpr auto kSampleProperties = [] {
+  std::array<uint16_t, kSample.size()> props{};
+  my_wctype::classify(kSample, props);
+  return props;
+}();
+
+class ConstexprTest : public WctypeTest {};
+
+TEST_F(ConstexprTest, BitmapsMatchKernels) {
+  const my_wctype::mywctype_t descs[] = {my_wctype::WCTYPE_ALPHA,
+                                         my_wctype::WCTYPE_SPACE};
+  std::vector<uint64_t> bitmaps(2);
+  my_wctype::iswctype_bitmap(kSample, descs, bitmaps);
+  EXPECT_EQ(bitmaps[0], kSampleBitmaps[0]);
+  EXPECT_EQ(bitmaps[1], kSampleBitmaps[1]);
+
+  std::vector<uint64_t> bitmap(1);
+  my_wctype::class_bitmap_lookup<my_wctype::WCTYPE_SPACE>(kSample, bitmap);
+  EXPECT_EQ(bitmap[0], kSampleBitmaps[1]);
+}
+
+TEST_F(ConstexprTest, ClassifyMatchesKernels) {
+  std::vector<uint16_t> props(kSample.size());
+  my_wctype::classify(kSample, props);
+  EXPECT_TRUE(std::ranges::equal(props, kSampleProperties));
+
+  my_wctype::classify_scattered(kSample, props);
+  EXPECT_TRUE(std::ranges::equal(props, kSampleProperties));
+}
+
+TEST_F(ConstexprTest, HistogramMatchesKernels) {
+  constexpr auto expected = my_wctype::class_histogram(kSample);
+  const auto histogram = my_wctype::class_histogram(kSample);
+  EXPECT_EQ(histogram.total, expected.total);
+  EXPECT_EQ(histogram.counts, expected.counts);
+}
@@ -0,0 +1,143 @@
+#include "wctype_test_base.h"
+#include "dispatch.h"
+
+#include <random>
+#include <vector>
+
+using my_wctype::dispatch::Isa;
+
+// Runs every test once per instruction set; variants this CPU can't run
+// are skipped
+class DispatchTest : public WctypeTest,
+                     public ::testing::WithParamInterface<Isa> {
+protected:
+  void SetUp() override {
+    if (!my_wctype::dispatch::force_isa(GetParam())) {
+      GTEST_SKIP() << my_wctype::dispatch::isa_name(GetParam())
+                   << " not supported here";
+    }
+  }
+
+  void TearDown() override { my_wctype::dispatch::reset_isa(); }
+
+  static constexpr my_wctype::mywctype_t all_descs[] = {
+      my_wctype::WCTYPE_ALNUM, my_wctype::WCTYPE_ALPHA,
+      my_wctype::WCTYPE_BLANK, my_wctype::WCTYPE_CNTRL,
+      my_wctype::WCTYPE_DIGIT, my_wctype::WCTYPE_GRAPH,
+      my_wctype::WCTYPE_LOWER, my_wctype::WCTYPE_PRINT,
+      my_wctype::WCTYPE_PUNCT, my_wctype::WCTYPE_SPACE,
+      my_wctype::WCTYPE_UPPER, my_wctype::WCTYPE_XDIGIT};
+
+  static std::vector<wchar_t> all_codepoints() {
+    std::vector<wchar_t> text;
+    for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+      text.push_back(static_cast<wchar_t>(cp));
+    }
+    text.push_back(static_cast<wchar_t>(0x110000));
+    text.push_back(static_cast<wchar_t>(-1));
+    return text;
+  }
+
+  // Long ASCII stretches with other scripts mixed in
+  static std::vector<wchar_t> random_text(size_t n, unsigned seed) {
+    static const wchar_t pool[] =
+        L"abcdefghijXYZ0123456789 \t\n!.,-_()éÀß αΩЖж中文　 \U0001F600";
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, std::size(pool) - 2);
+    std::vector<wchar_t> text(n);
+    for (auto &c : text) {
+      c = pool[pick(rng)];
+    }
+    return text;
+  }
+};
+
+TEST_P(DispatchTest, ActiveIsaIsForced) {
+  EXPECT_EQ(my_wctype::dispatch::active_isa(), GetParam());
+}
+
+TEST_P(DispatchTest, ClassifyMatchesHeader) {
+  const auto text = all_codepoints();
+  std::vector<uint16_t> expected(text.size());
+  my_wctype::classify(text, expected);
+
+  std::vector<uint16_t> props(text.size());
+  my_wctype::dispatch::classify(text, props);
+  EXPECT_EQ(props, expected);
+
+  std::fill(props.begin(), props.end(), 0xAA);
+  my_wctype::dispatch::classify_scattered(text, props);
+  EXPECT_EQ(props, expected);
+}
+
+TEST_P(DispatchTest, BitmapsMatchHeader) {
+  const auto text = all_codepoints();
+  const size_t words = my_wctype::bitmap_words(text.size());
+  std::vector<uint64_t> expected(std::size(all_descs) * words);
+  my_wctype::iswctype_bitmap(text, all_descs, expected);
+
+  std::vector<uint64_t> bitmaps(expected.size(), ~uint64_t{0});
+  my_wctype::dispatch::iswctype_bitmap(text, all_descs, bitmaps);
+  EXPECT_EQ(bitmaps, expected);
+}
+
+TEST_P(DispatchTest, HistogramMatchesHeader) {
+  for (const auto &text : {all_codepoints(), random_text(100'000, 1)}) {
+    const auto expected = my_wctype::class_histogram(text);
+    const auto histogram = my_wctype::dispatch::class_histogram(text);
+    EXPECT_EQ(histogram.total, expected.total);
+    EXPECT_EQ(histogram.counts, expected.counts);
+  }
+}
+
+TEST_P(DispatchTest, FindMatchesHeader) {
+  const my_wctype::mywctype_t word[] = {my_wctype::WCTYPE_ALPHA,
+                                        my_wctype::WCTYPE_DIGIT};
+  for (unsigned seed = 0; seed < 40; ++seed) {
+    const auto text = random_text(seed * 13, seed);
+    for (auto desc : all_descs) {
+      EXPECT_EQ(my_wctype::dispatch::find_first_of_class(text, desc),
+                my_wctype::find_first_of_class(text, desc))
+        << "seed " << seed << " desc " << int(desc);
+      EXPECT_EQ(my_wctype::dispatch::find_first_not_of_class(text, desc),
+                my_wctype::find_first_not_of_class(text, desc))
+        << "seed " << seed << " desc " << int(desc);
+    }
+    EXPECT_EQ(my_wctype::dispatch::find_first_not_of_class(text, word),
+              my_wctype::find_first_not_of_class(text, word));
+    EXPECT_EQ(my_wctype::dispatch::all_of_class(text, word),
+              my_wctype::all_of_class(text, word));
+  }
+
+  // A single outlier deep inside a long ASCII run
+  std::vector<wchar_t> text(1000, L'a');
+  text[777] = L'中';
+  EXPECT_EQ(my_wctype::dispatch::find_first_not_of_class(
+                text, my_wctype::WCTYPE_LOWER),
+            777u);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AllIsas, DispatchTest,
+    ::testing::Values(Isa::Scalar, Isa::SSE42, Isa::AVX2, Isa::AVX512),
+    [](const ::testing::TestParamInfo<Isa> &info) {
+      switch (info.param) {
+      case Isa::Scalar:
+        return "Scalar";
+      case Isa::SSE42:
+        return "SSE42";
+      case Isa::AVX2:
+        return "AVX2";
+      case Isa::AVX512:
+        return "AVX512";
+      }
+      return "Unknown";
+    });
+
+TEST(DispatchSelection, ForceAndReset) {
+  const Isa best = my_wctype::dispatch::best_isa();
+  EXPECT_TRUE(my_wctype::dispatch::force_isa(Isa::Scalar));
+  EXPECT_EQ(my_wctype::dispatch::active_isa(), Isa::Scalar);
+  my_wctype::dispatch::reset_isa();
+  EXPECT_EQ(my_wctype::dispatch::active_isa(), best);
+}
@@ -0,0 +1,65 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+#include "block_profiler.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+class FastPathsTest : public WctypeTest {};
+
+TEST_F(FastPathsTest, MatchesTables) {
+  for (uint32_t cp = 0; cp <= 0x110100; ++cp) {
+    ASSERT_EQ(wctype_fast_paths::lookup_properties(cp), lookup_properties(cp))
+      << "U+" << std::hex << cp;
+  }
+  EXPECT_EQ(wctype_fast_paths::lookup_properties(WEOF), 0);
+  EXPECT_EQ(my_wctype::iswalpha(-1), 0);
+}
+
+TEST_F(FastPathsTest, ProfilerCountsBlocks) {
+  namespace profiler = my_wctype::block_profiler;
+  profiler::reset();
+  profiler::record(L"abc дом 中"sv);
+  profiler::record(0x0430);
+  profiler::record(0x110000); // Past Unicode, not counted
+
+  const std::vector<std::pair<uint32_t, uint64_t>> expected = {
+      {0x00, 5}, {0x04, 4}, {0x4E, 1}};
+  EXPECT_EQ(profiler::snapshot(), expected);
+}
+
+TEST_F(FastPathsTest, ProfilerWritesGeneratorFormat) {
+  namespace profiler = my_wctype::block_profiler;
+  profiler::reset();
+  profiler::record(L"ab\U0001F600"sv);
+
+  const std::string filename =
+      ::testing::TempDir() + "fast_paths_test_profile.txt";
+  ASSERT_TRUE(profiler::write_block_profile(filename.c_str()));
+
+  // Read back the way read_block_profile in generator.h does
+  std::ifstream file(filename);
+  std::vector<std::pair<uint32_t, uint64_t>> blocks;
+  std::string line;
+  while (std::getline(file, line)) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields(line);
+    uint32_t block;
+    uint64_t hits;
+    if (fields >> std::hex >> block >> std::dec >> hits) {
+      blocks.emplace_back(block, hits);
+    }
+  }
+  std::remove(filename.c_str());
+
+  const std::vector<std::pair<uint32_t, uint64_t>> expected = {{0x00, 2},
+                                                               {0x1F6, 1}};
+  EXPECT_EQ(blocks, expected);
+  profiler::reset();
+}
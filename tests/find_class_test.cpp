@@ -0,0 +1,108 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+class FindClassTest : public WctypeTest {
+protected:
+  static constexpr my_wctype::mywctype_t all_descs[] = {
+      my_wctype::WCTYPE_ALNUM, my_wctype::WCTYPE_ALPHA,
+      my_wctype::WCTYPE_BLANK, my_wctype::WCTYPE_CNTRL,
+      my_wctype::WCTYPE_DIGIT, my_wctype::WCTYPE_GRAPH,
+      my_wctype::WCTYPE_LOWER, my_wctype::WCTYPE_PRINT,
+      my_wctype::WCTYPE_PUNCT, my_wctype::WCTYPE_SPACE,
+      my_wctype::WCTYPE_UPPER, my_wctype::WCTYPE_XDIGIT};
+
+  static size_t naive_find(std::span<const wchar_t> s,
+                           my_wctype::mywctype_t desc, bool match) {
+    for (size_t i = 0; i < s.size(); ++i) {
+      if ((my_wctype::iswctype(s[i], desc) != 0) == match) {
+        return i;
+      }
+    }
+    return s.size();
+  }
+
+  // Mostly ASCII with some Latin-1 and other scripts mixed in
+  static std::vector<wchar_t> random_text(size_t n, unsigned seed) {
+    static const wchar_t pool[] =
+        L"abcXYZ019 \t\n!.,-_()éÀß αΩЖж中文　 \U0001F600";
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, std::size(pool) - 2);
+    std::vector<wchar_t> text(n);
+    for (auto &c : text) {
+      c = pool[pick(rng)];
+    }
+    return text;
+  }
+};
+
+TEST_F(FindClassTest, MatchesNaiveScan) {
+  for (unsigned seed = 0; seed < 50; ++seed) {
+    const auto text = random_text(seed * 7, seed);
+    for (auto desc : all_descs) {
+      EXPECT_EQ(my_wctype::find_first_of_class(text, desc),
+                naive_find(text, desc, true))
+        << "seed " << seed << " desc " << int(desc);
+      EXPECT_EQ(my_wctype::find_first_not_of_class(text, desc),
+                naive_find(text, desc, false))
+        << "seed " << seed << " desc " << int(desc);
+    }
+  }
+}
+
+TEST_F(FindClassTest, StopsAtEveryPosition) {
+  // A long run of one class with a single outlier, placed at every offset so
+  // that prologue, SIMD runs and the scalar tail are all covered
+  for (size_t len : {1u, 5u, 16u, 33u, 100u}) {
+    for (size_t pos = 0; pos < len; ++pos) {
+      std::wstring text(len, L'a');
+      text[pos] = L' ';
+      EXPECT_EQ(my_wctype::find_first_of_class(text, my_wctype::WCTYPE_SPACE),
+                pos);
+      EXPECT_EQ(
+          my_wctype::find_first_not_of_class(text, my_wctype::WCTYPE_ALPHA),
+          pos);
+
+      text[pos] = L'中';
+      EXPECT_EQ(
+          my_wctype::find_first_not_of_class(text, my_wctype::WCTYPE_LOWER),
+          pos);
+    }
+  }
+}
+
+TEST_F(FindClassTest, NotFoundReturnsSize) {
+  std::wstring text(1000, L'x');
+  EXPECT_EQ(my_wctype::find_first_of_class(text, my_wctype::WCTYPE_DIGIT),
+            text.size());
+  EXPECT_EQ(my_wctype::find_first_not_of_class(text, my_wctype::WCTYPE_LOWER),
+            text.size());
+  EXPECT_EQ(my_wctype::find_first_of_class(std::wstring_view(),
+                                           my_wctype::WCTYPE_ALPHA),
+            0u);
+}
+
+TEST_F(FindClassTest, ClassSets) {
+  const my_wctype::mywctype_t word[] = {my_wctype::WCTYPE_ALPHA,
+                                        my_wctype::WCTYPE_DIGIT};
+  std::wstring text = L"hello42world_rest";
+  EXPECT_EQ(my_wctype::find_first_not_of_class(text, word), 12u);
+  EXPECT_EQ(my_wctype::find_first_of_class(L"  \t42"sv, word), 3u);
+  EXPECT_TRUE(my_wctype::all_of_class(L"abc123"sv, word));
+  EXPECT_FALSE(my_wctype::all_of_class(L"abc 123"sv, word));
+}
+
+TEST_F(FindClassTest, AllOfClass) {
+  EXPECT_TRUE(my_wctype::all_of_class(L""sv, my_wctype::WCTYPE_ALPHA));
+  EXPECT_TRUE(my_wctype::all_of_class(L" \t\n\r"sv, my_wctype::WCTYPE_SPACE));
+  EXPECT_TRUE(my_wctype::all_of_class(L"0123456789abcdefABCDEF"sv,
+                                      my_wctype::WCTYPE_XDIGIT));
+  EXPECT_FALSE(my_wctype::all_of_class(L"0123456789abcdefg"sv,
+                                       my_wctype::WCTYPE_XDIGIT));
+  EXPECT_FALSE(my_wctype::all_of_class(L"abc"sv, 0));
+}
@@ -0,0 +1,95 @@
+// Built into its own executable with MYWCTYPE_INSTRUMENT defined, since the
+// counted functions must not meet the uncounted ones in one program
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace instrument = my_wctype::instrument;
+
+// Constant evaluation counts nothing and still works
+static_assert(my_wctype::iswalpha(L'a'));
+static_assert(my_wctype::towlower(0x00C4) == 0x00E4);
+
+class InstrumentTest : public WctypeTest {
+protected:
+  void SetUp() override { instrument::reset(); }
+};
+
+TEST_F(InstrumentTest, CountsPerFunction) {
+  for (wchar_t wc : {L'a', L'b', L'c', static_cast<wchar_t>(0x4E00)}) {
+    my_wctype::iswalpha(wc);
+  }
+  my_wctype::iswdigit(L'5');
+  my_wctype::towlower(L'A');
+  my_wctype::towlower(0x00C4); // Ä, mapped
+  my_wctype::towlower(0x4E00); // No case
+
+  const auto total = instrument::snapshot();
+#ifdef MYWCTYPE_FAST_PATHS
+  EXPECT_EQ(total[instrument::Function::iswalpha].calls(), 4u);
+#else
+  EXPECT_EQ(total[instrument::Function::iswalpha].table, 4u);
+  EXPECT_EQ(total[instrument::Function::iswalpha].fast_path, 0u);
+#endif
+  EXPECT_EQ(total[instrument::Function::iswdigit].fast_path, 1u);
+  EXPECT_EQ(total[instrument::Function::towlower].fast_path, 1u);
+  EXPECT_EQ(total[instrument::Function::towlower].table, 2u);
+  EXPECT_EQ(total[instrument::Function::towlower].unmapped, 1u);
+  EXPECT_EQ(total[instrument::Function::towupper].calls(), 0u);
+}
+
+TEST_F(InstrumentTest, HeatmapCountsTableReads) {
+  my_wctype::iswspace(L' ');
+  my_wctype::iswspace(L'x');
+  my_wctype::iswctype(0x4E00, my_wctype::WCTYPE_ALPHA);
+  my_wctype::iswctype(0x110000, my_wctype::WCTYPE_ALPHA); // No table read
+
+  const auto total = instrument::snapshot();
+  EXPECT_EQ(total[instrument::Function::iswctype].calls(), 2u);
+#ifndef MYWCTYPE_FAST_PATHS
+  EXPECT_EQ(std::accumulate(total.heatmap.begin(), total.heatmap.end(),
+                            uint64_t{0}),
+            3u);
+  EXPECT_EQ(total.heatmap[instrument::table_chunk(L' ')], 2u);
+  EXPECT_GE(total.heatmap[instrument::table_chunk(0x4E00)], 1u);
+#endif
+}
+
+TEST_F(InstrumentTest, AddsUpThreads) {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([] {
+      for (int i = 0; i < 1000; ++i) {
+        my_wctype::iswupper(L'A' + i % 26);
+      }
+    });
+  }
+  // A live thread is counted too
+  my_wctype::iswupper(L'Q');
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(instrument::snapshot()[instrument::Function::iswupper].calls(),
+            4001u);
+
+  instrument::reset();
+  EXPECT_EQ(instrument::snapshot()[instrument::Function::iswupper].calls(),
+            0u);
+}
+
+TEST_F(InstrumentTest, DumpListsCalledFunctions) {
+  my_wctype::iswpunct(L'!');
+  my_wctype::towupper(0x00E9);
+
+  std::ostringstream out;
+  instrument::dump(out);
+  const std::string text = out.str();
+  EXPECT_NE(text.find("iswpunct"), std::string::npos);
+  EXPECT_NE(text.find("towupper"), std::string::npos);
+  EXPECT_EQ(text.find("iswalpha"), std::string::npos);
+  EXPECT_NE(text.find("table chunk"), std::string::npos);
+}
@@ -0,0 +1,76 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <vector>
+
+class IswctypeBitmapTest : public WctypeTest {
+protected:
+  static constexpr my_wctype::mywctype_t all_descs[] = {
+      my_wctype::WCTYPE_ALNUM, my_wctype::WCTYPE_ALPHA,
+      my_wctype::WCTYPE_BLANK, my_wctype::WCTYPE_CNTRL,
+      my_wctype::WCTYPE_DIGIT, my_wctype::WCTYPE_GRAPH,
+      my_wctype::WCTYPE_LOWER, my_wctype::WCTYPE_PRINT,
+      my_wctype::WCTYPE_PUNCT, my_wctype::WCTYPE_SPACE,
+      my_wctype::WCTYPE_UPPER, my_wctype::WCTYPE_XDIGIT};
+
+  static bool test_bit(const std::vector<uint64_t> &bitmaps, size_t row,
+                       size_t words, size_t i) {
+    return (bitmaps[row * words + i / 64] >> (i % 64)) & 1;
+  }
+};
+
+TEST_F(IswctypeBitmapTest, MatchesIswctypeOnEveryCodepoint) {
+  std::vector<wchar_t> text;
+  for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    text.push_back(static_cast<wchar_t>(cp));
+  }
+
+  const size_t words = my_wctype::bitmap_words(text.size());
+  std::vector<uint64_t> bitmaps(std::size(all_descs) * words);
+  my_wctype::iswctype_bitmap(text, all_descs, bitmaps);
+
+  for (size_t k = 0; k < std::size(all_descs); ++k) {
+    for (size_t i = 0; i < text.size(); ++i) {
+      ASSERT_EQ(test_bit(bitmaps, k, words, i),
+                my_wctype::iswctype(text[i], all_descs[k]) != 0)
+        << "desc " << int(all_descs[k]) << " U+" << std::hex
+        << static_cast<uint32_t>(text[i]);
+    }
+  }
+}
+
+TEST_F(IswctypeBitmapTest, TailBitsAreCleared) {
+  // 70 characters: one full word and a partial one
+  std::vector<wchar_t> text(70, L'a');
+  text[3] = L' ';
+  text[69] = L' ';
+
+  const my_wctype::mywctype_t descs[] = {my_wctype::WCTYPE_ALPHA,
+                                         my_wctype::WCTYPE_SPACE};
+  std::vector<uint64_t> bitmaps(2 * my_wctype::bitmap_words(text.size()),
+                                ~uint64_t{0});
+  my_wctype::iswctype_bitmap(text, descs, bitmaps);
+
+  EXPECT_EQ(bitmaps[0], ~uint64_t{0} & ~(uint64_t{1} << 3));
+  EXPECT_EQ(bitmaps[1], (uint64_t{1} << 5) - 1);
+  EXPECT_EQ(bitmaps[2], uint64_t{1} << 3);
+  EXPECT_EQ(bitmaps[3], uint64_t{1} << 5);
+}
+
+TEST_F(IswctypeBitmapTest, InvalidDescriptorIsEmpty) {
+  std::vector<wchar_t> text(100, L'a');
+  const my_wctype::mywctype_t descs[] = {0, 0x1000, 0xF000};
+  std::vector<uint64_t> bitmaps(3 * my_wctype::bitmap_words(text.size()), 1);
+  my_wctype::iswctype_bitmap(text, descs, bitmaps);
+
+  for (uint64_t word : bitmaps) {
+    EXPECT_EQ(word, 0u);
+  }
+}
+
+TEST_F(IswctypeBitmapTest, EmptyInput) {
+  const my_wctype::mywctype_t descs[] = {my_wctype::WCTYPE_ALPHA};
+  std::vector<uint64_t> bitmaps;
+  my_wctype::iswctype_bitmap(std::span<const wchar_t>(), descs, bitmaps);
+  EXPECT_TRUE(bitmaps.empty());
+}
@@ -0,0 +1,109 @@
+#include "wctype_test_base.h"
+#include "mywctype.h"
+
+#include <random>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+class IswctypeTemplateTest : public WctypeTest {
+protected:
+  static std::vector<wchar_t> all_codepoints() {
+    std::vector<wchar_t> text;
+    for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+      text.push_back(static_cast<wchar_t>(cp));
+    }
+    return text;
+  }
+
+  // Mostly ASCII, with other scripts here and there
+  static std::vector<wchar_t> random_text(size_t n, unsigned seed) {
+    static const wchar_t pool[] =
+        L"abcdefghijXYZ0123456789 \t\n!.,-_()éÀß αΩЖж中文　 \U0001F600";
+    std::mt19937 rng(seed);
+    std::vector<wchar_t> text(n);
+    for (auto &c : text) {
+      c = pool[rng() % 24];
+      if (rng() % 31 == 0) {
+        c = pool[rng() % (std::size(pool) - 1)];
+      }
+    }
+    return text;
+  }
+
+  // Every per-class function against its runtime counterpart
+  template <my_wctype::mywctype_t Desc>
+  static void expect_same_as_runtime() {
+    for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+      ASSERT_EQ(my_wctype::iswctype<Desc>(cp) != 0,
+                my_wctype::iswctype(cp, Desc) != 0)
+        << "desc " << Desc << " U+" << std::hex << cp;
+    }
+
+    for (unsigned seed = 0; seed < 20; ++seed) {
+      const auto text = random_text(seed * 37, seed);
+      EXPECT_EQ(my_wctype::find_first_of_class<Desc>(text),
+                my_wctype::find_first_of_class(text, Desc))
+        << "desc " << Desc << " seed " << seed;
+      EXPECT_EQ(my_wctype::find_first_not_of_class<Desc>(text),
+                my_wctype::find_first_not_of_class(text, Desc))
+        << "desc " << Desc << " seed " << seed;
+      EXPECT_EQ(my_wctype::all_of_class<Desc>(text),
+                my_wctype::all_of_class(text, Desc));
+
+      const size_t words = my_wctype::bitmap_words(text.size());
+      std::vector<uint64_t> expected(words);
+      std::vector<uint64_t> bitmap(words, ~uint64_t{0});
+      my_wctype::class_bitmap_lookup(text, Desc, expected);
+      my_wctype::class_bitmap_lookup<Desc>(text, bitmap);
+      EXPECT_EQ(bitmap, expected) << "desc " << Desc << " seed " << seed;
+    }
+  }
+};
+
+TEST_F(IswctypeTemplateTest, EveryClassMatchesRuntime) {
+  expect_same_as_runtime<my_wctype::WCTYPE_ALNUM>();
+  expect_same_as_runtime<my_wctype::WCTYPE_ALPHA>();
+  expect_same_as_runtime<my_wctype::WCTYPE_BLANK>();
+  expect_same_as_runtime<my_wctype::WCTYPE_CNTRL>();
+  expect_same_as_runtime<my_wctype::WCTYPE_DIGIT>();
+  expect_same_as_runtime<my_wctype::WCTYPE_GRAPH>();
+  expect_same_as_runtime<my_wctype::WCTYPE_LOWER>();
+  expect_same_as_runtime<my_wctype::WCTYPE_PRINT>();
+  expect_same_as_runtime<my_wctype::WCTYPE_PUNCT>();
+  expect_same_as_runtime<my_wctype::WCTYPE_SPACE>();
+  expect_same_as_runtime<my_wctype::WCTYPE_UPPER>();
+  expect_same_as_runtime<my_wctype::WCTYPE_XDIGIT>();
+}
+
+TEST_F(IswctypeTemplateTest, UnionMatchesRuntime) {
+  expect_same_as_runtime<my_wctype::WCTYPE_ALPHA | my_wctype::WCTYPE_DIGIT>();
+  expect_same_as_runtime<my_wctype::WCTYPE_SPACE | my_wctype::WCTYPE_PUNCT>();
+}
+
+TEST_F(IswctypeTemplateTest, WctypeAtCompileTime) {
+  static_assert(my_wctype::wctype<"alpha">() == my_wctype::WCTYPE_ALPHA);
+  static_assert(my_wctype::wctype<"xdigit">() == my_wctype::WCTYPE_XDIGIT);
+  static_assert(my_wctype::wctype("space") == my_wctype::WCTYPE_SPACE);
+  static_assert(my_wctype::wctype("invalid") == 0);
+
+  EXPECT_NE(0, my_wctype::iswctype<my_wctype::wctype<"alpha">()>(L'a'));
+  EXPECT_EQ(0, my_wctype::iswctype<my_wctype::wctype<"alpha">()>(L'5'));
+  EXPECT_NE(0, my_wctype::iswctype<my_wctype::wctype("digit")>(L'5'));
+}
+
+TEST_F(IswctypeTemplateTest, ScanEndsAtOutlier) {
+  // Long enough for the whole-run path, with the outlier past the prologue
+  std::vector<wchar_t> text(1000, L'a');
+  text[777] = L'中';
+  EXPECT_EQ(
+      my_wctype::find_first_not_of_class<my_wctype::WCTYPE_LOWER>(text),
+      777u);
+  EXPECT_EQ(my_wctype::find_first_of_class<my_wctype::WCTYPE_DIGIT>(text),
+            text.size());
+  EXPECT_TRUE(my_wctype::all_of_class<my_wctype::WCTYPE_ALPHA>(
+      std::span<const wchar_t>(text)));
+  EXPECT_TRUE(
+      my_wctype::all_of_class<my_wctype::WCTYPE_ALPHA>(L"abcé"sv));
+}
@@ -141,6 +141,24 @@ TEST_F(IswctypeTest, InvalidDescriptor) {
   EXPECT_EQ(0, my_wctype::iswctype(L'a', 0));
   EXPECT_EQ(0, my_wctype::iswctype(L'5', 0));
   EXPECT_EQ(0, my_wctype::iswctype(L' ', 0));
+  EXPECT_EQ(0, my_wctype::iswctype(L'a', 0x1000));
+}
+
+TEST_F(IswctypeTest, UnionOfClasses) {
+  const auto desc = my_wctype::WCTYPE_ALPHA | my_wctype::WCTYPE_DIGIT;
+
+  EXPECT_NE(0, my_wctype::iswctype(L'a', desc));
+  EXPECT_NE(0, my_wctype::iswctype(L'5', desc));
+  EXPECT_NE(0, my_wctype::iswctype(0x00E9, desc));
+  EXPECT_EQ(0, my_wctype::iswctype(L' ', desc));
+  EXPECT_EQ(0, my_wctype::iswctype(L'!', desc));
+
+  // Every class of the union, and nothing else
+  for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    ASSERT_EQ(my_wctype::iswctype(cp, desc) != 0,
+              my_wctype::iswalnum(cp) != 0)
+      << std::hex << cp;
+  }
 }
 
 TEST_F(IswctypeTest, WctypeIntegration) {
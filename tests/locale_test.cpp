@@ -0,0 +1,116 @@
+#include "wctype_test_base.h"
+#include "mywctype_locale.h"
+
+#include <clocale>
+#include <wctype.h>
+
+static_assert(my_wctype::iswalpha_l(L'a', my_wctype::c_locale));
+static_assert(!my_wctype::iswalpha_l(0x00E9, my_wctype::c_locale)); // é
+static_assert(my_wctype::iswalpha_l(0x00E9, my_wctype::c_utf8_locale));
+static_assert(my_wctype::towupper_l(0x00E9, my_wctype::c_locale) == 0x00E9);
+static_assert(my_wctype::towupper_l(0x00E9, my_wctype::c_utf8_locale) ==
+              0x00C9);
+static_assert(my_wctype::newlocale("POSIX")->kind == my_wctype::locale_kind::c);
+static_assert(!my_wctype::newlocale("en_US.UTF-8"));
+
+class LocaleTest : public WctypeTest {
+protected:
+  // glibc's own C locale, independent of the global one
+  static void SetUpTestSuite() {
+    WctypeTest::SetUpTestSuite();
+    glibc_c = ::newlocale(LC_ALL_MASK, "C", nullptr);
+    ASSERT_NE(glibc_c, nullptr);
+  }
+
+  static void TearDownTestSuite() { ::freelocale(glibc_c); }
+
+  static inline ::locale_t glibc_c = nullptr;
+
+  static constexpr std::pair<const char *, my_wctype::mywctype_t> classes[] = {
+      {"alnum", my_wctype::WCTYPE_ALNUM}, {"alpha", my_wctype::WCTYPE_ALPHA},
+      {"blank", my_wctype::WCTYPE_BLANK}, {"cntrl", my_wctype::WCTYPE_CNTRL},
+      {"digit", my_wctype::WCTYPE_DIGIT}, {"graph", my_wctype::WCTYPE_GRAPH},
+      {"lower", my_wctype::WCTYPE_LOWER}, {"print", my_wctype::WCTYPE_PRINT},
+      {"punct", my_wctype::WCTYPE_PUNCT}, {"space", my_wctype::WCTYPE_SPACE},
+      {"upper", my_wctype::WCTYPE_UPPER}, {"xdigit", my_wctype::WCTYPE_XDIGIT},
+  };
+};
+
+TEST_F(LocaleTest, CMatchesGlibc) {
+  for (const auto &[name, desc] : classes) {
+    const ::wctype_t glibc_desc = ::wctype_l(name, glibc_c);
+    for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+      ASSERT_EQ(my_wctype::iswctype_l(cp, desc, my_wctype::c_locale) != 0,
+                ::iswctype_l(cp, glibc_desc, glibc_c) != 0)
+        << name << " U+" << std::hex << cp;
+    }
+  }
+  for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    ASSERT_EQ(my_wctype::towlower_l(cp, my_wctype::c_locale),
+              ::towlower_l(cp, glibc_c))
+      << "U+" << std::hex << cp;
+    ASSERT_EQ(my_wctype::towupper_l(cp, my_wctype::c_locale),
+              ::towupper_l(cp, glibc_c))
+      << "U+" << std::hex << cp;
+  }
+}
+
+TEST_F(LocaleTest, CUtf8MatchesDefault) {
+  for (uint32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    const auto wc = static_cast<wchar_t>(cp);
+    const auto loc = my_wctype::c_utf8_locale;
+    ASSERT_EQ(my_wctype::iswalnum_l(wc, loc), my_wctype::iswalnum(wc));
+    ASSERT_EQ(my_wctype::iswalpha_l(wc, loc), my_wctype::iswalpha(wc));
+    ASSERT_EQ(my_wctype::iswblank_l(wc, loc), my_wctype::iswblank(wc));
+    ASSERT_EQ(my_wctype::iswcntrl_l(wc, loc), my_wctype::iswcntrl(wc));
+    ASSERT_EQ(my_wctype::iswdigit_l(wc, loc), my_wctype::iswdigit(wc));
+    ASSERT_EQ(my_wctype::iswgraph_l(wc, loc), my_wctype::iswgraph(wc));
+    ASSERT_EQ(my_wctype::iswlower_l(wc, loc), my_wctype::iswlower(wc));
+    ASSERT_EQ(my_wctype::iswprint_l(wc, loc), my_wctype::iswprint(wc));
+    ASSERT_EQ(my_wctype::iswpunct_l(wc, loc), my_wctype::iswpunct(wc));
+    ASSERT_EQ(my_wctype::iswspace_l(wc, loc), my_wctype::iswspace(wc));
+    ASSERT_EQ(my_wctype::iswupper_l(wc, loc), my_wctype::iswupper(wc));
+    ASSERT_EQ(my_wctype::iswxdigit_l(wc, loc), my_wctype::iswxdigit(wc));
+    ASSERT_EQ(my_wctype::towlower_l(cp, loc), my_wctype::towlower(cp));
+    ASSERT_EQ(my_wctype::towupper_l(cp, loc), my_wctype::towupper(cp));
+  }
+}
+
+TEST_F(LocaleTest, RuntimeHandleMatchesStatic) {
+  const auto c = my_wctype::newlocale("C");
+  const auto c_utf8 = my_wctype::newlocale("C.UTF-8");
+  ASSERT_TRUE(c && c_utf8);
+  EXPECT_EQ(my_wctype::newlocale("C.utf8"), c_utf8);
+
+  for (uint32_t cp = 0; cp < 0x3000; ++cp) {
+    for (const auto &[name, desc] : classes) {
+      ASSERT_EQ(my_wctype::iswctype_l(cp, desc, *c),
+                my_wctype::iswctype_l(cp, desc, my_wctype::c_locale));
+      ASSERT_EQ(my_wctype::iswctype_l(cp, desc, *c_utf8),
+                my_wctype::iswctype_l(cp, desc, my_wctype::c_utf8_locale));
+    }
+    ASSERT_EQ(my_wctype::towlower_l(cp, *c),
+              my_wctype::towlower_l(cp, my_wctype::c_locale));
+    ASSERT_EQ(my_wctype::towupper_l(cp, *c_utf8),
+              my_wctype::towupper_l(cp, my_wctype::c_utf8_locale));
+  }
+  EXPECT_EQ(my_wctype::wctype_l("punct", *c), my_wctype::WCTYPE_PUNCT);
+  EXPECT_EQ(my_wctype::wctype_l("punct", my_wctype::c_utf8_locale),
+            my_wctype::WCTYPE_PUNCT);
+}
+
+TEST_F(LocaleTest, WithLocaleHoistsTheBranch) {
+  const std::wstring text = L"Grüße, мир! ABC";
+  const auto count_alpha = [&](auto loc) {
+    size_t n = 0;
+    for (wchar_t wc : text) {
+      n += my_wctype::iswalpha_l(wc, loc) != 0;
+    }
+    return n;
+  };
+  EXPECT_EQ(my_wctype::with_locale(*my_wctype::newlocale("C"), count_alpha),
+            6u);
+  EXPECT_EQ(
+      my_wctype::with_locale(*my_wctype::newlocale("C.UTF-8"), count_alpha),
+      11u);
+}
@@ -0,0 +1,66 @@
+#include "wctype_test_base.h"
+#include "wctype_table.h"
+
+// Every layout in wctype_table.h must agree with the two-level table, which
+// is the reference since it is what the generator started out with
+class TableLayoutTest : public WctypeTest {
+protected:
+  static constexpr wint_t invalid[] = {0xD800, 0xDBFF, 0xDFFF, 0x110000,
+                                       0x7FFFFFFF, WEOF};
+
+  template <uint16_t (*Lookup)(wint_t)>
+  static void expect_matches_two_level() {
+    for (wint_t wc = 0; wc <= 0x10FFFF; ++wc) {
+      ASSERT_EQ(Lookup(wc), wctype_two_level::lookup_properties(wc))
+        << "Mismatch for U+" << std::hex << wc;
+    }
+    for (wint_t wc : invalid) {
+      EXPECT_EQ(Lookup(wc), 0) << std::hex << wc;
+    }
+  }
+
+  // The bulk kernels index Latin-1 straight from entry(0)
+  template <const uint16_t *(*Entry)(uint32_t)>
+  static void expect_latin1_run() {
+    for (uint32_t cp = 0; cp < 0x100; ++cp) {
+      ASSERT_EQ(Entry(cp), Entry(0) + cp) << "U+" << std::hex << cp;
+    }
+  }
+};
+
+TEST_F(TableLayoutTest, FlatBmpMatchesTwoLevel) {
+  expect_matches_two_level<wctype_flat_bmp::lookup_properties>();
+}
+
+TEST_F(TableLayoutTest, ThreeStageMatchesTwoLevel) {
+  expect_matches_two_level<wctype_three_stage::lookup_properties>();
+}
+
+TEST_F(TableLayoutTest, Latin1IsContiguous) {
+  expect_latin1_run<wctype_two_level::entry>();
+  expect_latin1_run<wctype_flat_bmp::entry>();
+  expect_latin1_run<wctype_three_stage::entry>();
+}
+
+TEST_F(TableLayoutTest, SelectedLayoutMatchesTwoLevel) {
+  for (wint_t wc = 0; wc <= 0x10FFFF; ++wc) {
+    ASSERT_EQ(lookup_properties(wc), wctype_two_level::lookup_properties(wc))
+      << "Mismatch for U+" << std::hex << wc;
+    ASSERT_EQ(*wctype_layout::entry(wc), lookup_properties(wc))
+      << "Mismatch for U+" << std::hex << wc;
+  }
+}
+
+TEST_F(TableLayoutTest, TablesAreAligned) {
+  const auto aligned = [](const void *table, uintptr_t alignment) {
+    return reinterpret_cast<uintptr_t>(table) % alignment == 0;
+  };
+  EXPECT_TRUE(aligned(wctype_two_level::level1, 64));
+  EXPECT_TRUE(aligned(wctype_two_level::level2, 4096));
+  EXPECT_TRUE(aligned(wctype_flat_bmp::bmp, 4096));
+  EXPECT_TRUE(aligned(wctype_flat_bmp::level1, 64));
+  EXPECT_TRUE(aligned(wctype_flat_bmp::level2, 4096));
+  EXPECT_TRUE(aligned(wctype_three_stage::level1, 64));
+  EXPECT_TRUE(aligned(wctype_three_stage::level2, 64));
+  EXPECT_TRUE(aligned(wctype_three_stage::level3, 4096));
+}
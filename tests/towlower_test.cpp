@@ -1,12 +1,16 @@
 #include "wctype_test_base.h"
 #include "mywctype.h"
 
+#include <unordered_map>
+
 struct ConversionTestCase {
   wint_t input;
   wint_t expected;
   const char *name;
 };
 
+class TowlowerTestTables : public WctypeTest {};
+
 class TowlowerTest : public WctypeTest,
                      public ::testing::WithParamInterface<ConversionTestCase> {
 };
@@ -25,6 +29,19 @@ TEST_P(TowlowerTest, Towlower) {
     << " - std returned U+" << std_result << " but we returned U+" << my_result;
 }
 
+// Every codepoint against the mapping list, whichever level2 encoding the
+// staged tables were generated with
+TEST_F(TowlowerTestTables, MatchesMappingList) {
+  const std::unordered_map<wint_t, wint_t> mappings = {
+#include "case_mapping_lower.inc"
+  };
+  for (wint_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    const auto it = mappings.find(cp);
+    const wint_t expected = it == mappings.end() ? cp : it->second;
+    ASSERT_EQ(my_wctype::towlower(cp), expected) << "U+" << std::hex << cp;
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(TowlowerTests, TowlowerTest, ::testing::Values(
                            // ASCII uppercase letters should convert to lowercase
                            ConversionTestCase{0x0041, 0x0061,
@@ -139,6 +156,12 @@ INSTANTIATE_TEST_SUITE_P(TowlowerTests, TowlowerTest, ::testing::Values(
                            ConversionTestCase{0x05D0, 0x05D0,
                            "HEBREW LETTER ALEF -> UNCHANGED"},
 
+                           // Deltas too large for int16_t
+                           ConversionTestCase{0xA7AE, 0x026A,
+                           "LATIN CAPITAL LETTER SMALL CAPITAL I -> small"},
+                           ConversionTestCase{0x13A0, 0xAB70,
+                           "CHEROKEE LETTER A -> small"},
+
                            // Special cases
                            ConversionTestCase{0x0000, 0x0000, "NULL -> NULL"},
                            ConversionTestCase{0xFFFD, 0xFFFD,
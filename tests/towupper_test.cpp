@@ -1,12 +1,16 @@
 #include "wctype_test_base.h"
 #include "mywctype.h"
 
+#include <unordered_map>
+
 struct ConversionTestCase {
   wint_t input;
   wint_t expected;
   const char *name;
 };
 
+class TowupperTestTables : public WctypeTest {};
+
 class TowupperTest : public WctypeTest,
                      public ::testing::WithParamInterface<ConversionTestCase> {
 };
@@ -25,6 +29,19 @@ TEST_P(TowupperTest, Towupper) {
     << " - std returned U+" << std_result << " but we returned U+" << my_result;
 }
 
+// Every codepoint against the mapping list, whichever level2 encoding the
+// staged tables were generated with
+TEST_F(TowupperTestTables, MatchesMappingList) {
+  const std::unordered_map<wint_t, wint_t> mappings = {
+#include "case_mapping_upper.inc"
+  };
+  for (wint_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    const auto it = mappings.find(cp);
+    const wint_t expected = it == mappings.end() ? cp : it->second;
+    ASSERT_EQ(my_wctype::towupper(cp), expected) << "U+" << std::hex << cp;
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(TowupperTests, TowupperTest, ::testing::Values(
                            // ASCII lowercase letters should convert to uppercase
                            ConversionTestCase{0x0061, 0x0041,
@@ -139,6 +156,12 @@ INSTANTIATE_TEST_SUITE_P(TowupperTests, TowupperTest, ::testing::Values(
                            ConversionTestCase{0x05D0, 0x05D0,
                            "HEBREW LETTER ALEF -> UNCHANGED"},
 
+                           // Deltas too large for int16_t
+                           ConversionTestCase{0x026A, 0xA7AE,
+                           "LATIN LETTER SMALL CAPITAL I -> capital"},
+                           ConversionTestCase{0xAB70, 0x13A0,
+                           "CHEROKEE SMALL LETTER A -> capital"},
+
                            // Special cases
                            ConversionTestCase{0x0000, 0x0000, "NULL -> NULL"},
                            ConversionTestCase{0xFFFD, 0xFFFD,